@@ -75,6 +75,7 @@ if(ENABLE_ECL_INPUT)
     src/opm/input/eclipse/EclipseState/EndpointScaling.cpp
     src/opm/input/eclipse/EclipseState/Grid/FieldProps.cpp
     src/opm/input/eclipse/EclipseState/Grid/FieldPropsManager.cpp
+    src/opm/input/eclipse/EclipseState/Grid/ActiveIndexMap.cpp
     src/opm/input/eclipse/EclipseState/Grid/Box.cpp
     src/opm/input/eclipse/EclipseState/Grid/BoxManager.cpp
     src/opm/input/eclipse/EclipseState/Grid/EclipseGrid.cpp
@@ -106,6 +107,7 @@ if(ENABLE_ECL_INPUT)
     src/opm/input/eclipse/Schedule/Action/Actions.cpp
     src/opm/input/eclipse/Schedule/Action/ActionX.cpp
     src/opm/input/eclipse/Schedule/Action/ActionParser.cpp
+    src/opm/input/eclipse/Schedule/Action/ActionProgram.cpp
     src/opm/input/eclipse/Schedule/Action/ActionValue.cpp
     src/opm/input/eclipse/Schedule/Action/ASTNode.cpp
     src/opm/input/eclipse/Schedule/Action/Condition.cpp
@@ -139,6 +141,7 @@ if(ENABLE_ECL_INPUT)
     src/opm/input/eclipse/Schedule/Network/ExtNetwork.cpp
     src/opm/input/eclipse/Schedule/Network/Node.cpp
     src/opm/input/eclipse/Schedule/OilVaporizationProperties.cpp
+    src/opm/input/eclipse/Schedule/PreparedKeywords.cpp
     src/opm/input/eclipse/Schedule/RFTConfig.cpp
     src/opm/input/eclipse/Schedule/RPTConfig.cpp
     src/opm/input/eclipse/Schedule/RSTConfig.cpp
@@ -204,6 +207,7 @@ if(ENABLE_ECL_INPUT)
     src/opm/input/eclipse/Schedule/UDQ/UDQASTNode.cpp
     src/opm/input/eclipse/Schedule/UDQ/UDQParams.cpp
     src/opm/input/eclipse/Schedule/UDQ/UDQParser.cpp
+    src/opm/input/eclipse/Schedule/UDQ/UDQProgram.cpp
     src/opm/input/eclipse/Schedule/UDQ/UDQSet.cpp
     src/opm/input/eclipse/Schedule/UDQ/UDQActive.cpp
     src/opm/input/eclipse/Schedule/UDQ/UDQAssign.cpp
@@ -281,7 +285,9 @@ if(ENABLE_ECL_INPUT)
 endif()
 if(ENABLE_ECL_OUTPUT)
   list( APPEND MAIN_SOURCE_FILES
+          src/opm/io/eclipse/EclCompression.cpp
           src/opm/io/eclipse/EclFile.cpp
+          src/opm/io/eclipse/EclFileIndex.cpp
           src/opm/io/eclipse/EclOutput.cpp
           src/opm/io/eclipse/EclUtil.cpp
           src/opm/io/eclipse/EGrid.cpp
@@ -320,6 +326,7 @@ if(ENABLE_ECL_OUTPUT)
           src/opm/output/eclipse/AggregateUDQData.cpp
           src/opm/output/eclipse/AggregateWellData.cpp
           src/opm/output/eclipse/AggregateWListData.cpp
+          src/opm/output/eclipse/ConcurrentAggregation.cpp
           src/opm/output/eclipse/CreateActionRSTDims.cpp
           src/opm/output/eclipse/CreateDoubHead.cpp
           src/opm/output/eclipse/CreateInteHead.cpp
@@ -339,6 +346,7 @@ if(ENABLE_ECL_OUTPUT)
           src/opm/output/eclipse/UDQDims.cpp
           src/opm/output/eclipse/RegionCache.cpp
           src/opm/output/eclipse/RestartValue.cpp
+          src/opm/output/eclipse/ResultsBus.cpp
           src/opm/output/eclipse/WriteInit.cpp
           src/opm/output/eclipse/WriteRFT.cpp
           src/opm/output/eclipse/WriteRPT.cpp
@@ -483,6 +491,7 @@ if(ENABLE_ECL_OUTPUT)
           tests/test_Summary_Group.cpp
           tests/test_Tables.cpp
           tests/test_Wells.cpp
+          tests/test_ResultsBus.cpp
           tests/test_WindowedArray.cpp
           tests/test_restartwellinfo.cpp
       )
@@ -601,6 +610,8 @@ if(ENABLE_ECL_INPUT)
     examples/rst_deck.cpp
     examples/wellgraph.cpp
     examples/make_ext_smry.cpp
+    examples/grid_setup_bench.cpp
+    examples/rst_state_bench.cpp
   )
 endif()
 
@@ -686,6 +697,7 @@ if(ENABLE_ECL_INPUT)
        opm/input/eclipse/EclipseState/Util/IOrderSet.hpp
        opm/input/eclipse/EclipseState/Util/OrderedMap.hpp
        opm/input/eclipse/EclipseState/SummaryConfig/SummaryConfig.hpp
+       opm/input/eclipse/EclipseState/Grid/ActiveIndexMap.hpp
        opm/input/eclipse/EclipseState/Grid/FieldData.hpp
        opm/input/eclipse/EclipseState/Grid/Keywords.hpp
        opm/input/eclipse/EclipseState/Grid/GridDims.hpp
@@ -805,6 +817,7 @@ if(ENABLE_ECL_INPUT)
        opm/input/eclipse/EclipseState/Aquifer/NumericalAquifer/NumericalAquifers.hpp
        opm/input/eclipse/Schedule/Action/ActionAST.hpp
        opm/input/eclipse/Schedule/Action/ActionContext.hpp
+       opm/input/eclipse/Schedule/Action/ActionProgram.hpp
        opm/input/eclipse/Schedule/Action/ActionResult.hpp
        opm/input/eclipse/Schedule/Action/ActionValue.hpp
        opm/input/eclipse/Schedule/Action/Actdims.hpp
@@ -869,6 +882,7 @@ if(ENABLE_ECL_INPUT)
        opm/input/eclipse/Schedule/CompletedCells.hpp
        opm/input/eclipse/Schedule/Events.hpp
        opm/input/eclipse/Schedule/OilVaporizationProperties.hpp
+       opm/input/eclipse/Schedule/PreparedKeywords.hpp
        opm/input/eclipse/Schedule/MSW/icd.hpp
        opm/input/eclipse/Schedule/MSW/Segment.hpp
        opm/input/eclipse/Schedule/MSW/Segment.hpp
@@ -891,6 +905,7 @@ if(ENABLE_ECL_INPUT)
        opm/input/eclipse/Schedule/UDQ/UDQConfig.hpp
        opm/input/eclipse/Schedule/UDQ/UDQEnums.hpp
        opm/input/eclipse/Schedule/UDQ/UDQParams.hpp
+       opm/input/eclipse/Schedule/UDQ/UDQProgram.hpp
        opm/input/eclipse/Schedule/UDQ/UDQInput.hpp
        opm/input/eclipse/Schedule/UDQ/UDQActive.hpp
        opm/input/eclipse/Schedule/UDQ/UDQSet.hpp
@@ -914,7 +929,9 @@ if(ENABLE_ECL_INPUT)
 endif()
 if(ENABLE_ECL_OUTPUT)
   list(APPEND PUBLIC_HEADER_FILES
+        opm/io/eclipse/EclCompression.hpp
         opm/io/eclipse/EclFile.hpp
+        opm/io/eclipse/EclFileIndex.hpp
         opm/io/eclipse/EclIOdata.hpp
         opm/io/eclipse/EclOutput.hpp
         opm/io/eclipse/EclUtil.hpp
@@ -978,7 +995,9 @@ if(ENABLE_ECL_OUTPUT)
         opm/output/eclipse/LogiHEAD.hpp
         opm/output/eclipse/RegionCache.hpp
         opm/output/eclipse/RestartIO.hpp
+        opm/output/eclipse/RestartOutputContext.hpp
         opm/output/eclipse/RestartValue.hpp
+        opm/output/eclipse/ResultsBus.hpp
         opm/output/eclipse/Inplace.hpp
         opm/output/eclipse/Summary.hpp
         opm/output/eclipse/Tables.hpp
@@ -0,0 +1,116 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <opm/input/eclipse/EclipseState/Grid/EclipseGrid.hpp>
+#include <opm/input/eclipse/EclipseState/Grid/GridDims.hpp>
+
+/*
+  Small timing driver for the grid setup passes which scale with the number
+  of cells: the ZCORN fixup and the construction of the active <-> global
+  index maps in EclipseGrid::resetACTNUM(). The grid is synthetic; the
+  default dimensions 500 x 500 x 400 give a 100M cell model and require
+  roughly 8GB of memory.
+
+     grid_setup_bench [NX NY NZ]
+*/
+
+namespace {
+
+template <typename F>
+double time_it(F&& func) {
+    const auto start = std::chrono::steady_clock::now();
+    func();
+    const auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(stop - start).count();
+}
+
+// Layered zcorn where every 7th pillar corner has the bottom of the cell
+// pulled above the top, i.e. something fixupZCORN() has to repair.
+std::vector<double> make_zcorn(std::size_t nx, std::size_t ny, std::size_t nz) {
+    const Opm::ZcornMapper mapper(nx, ny, nz);
+    std::vector<double> zcorn(mapper.size());
+
+    for (std::size_t k = 0; k < nz; k++) {
+        for (std::size_t j = 0; j < ny; j++) {
+            for (std::size_t i = 0; i < nx; i++) {
+                for (int c = 0; c < 4; c++) {
+                    const double top = k * 1.0;
+                    const double bottom = ((i + j + k + c) % 7 == 0) ? top - 0.5 : top + 1.0;
+                    zcorn[mapper.index(i, j, k, c)] = top;
+                    zcorn[mapper.index(i, j, k, c + 4)] = bottom;
+                }
+            }
+        }
+    }
+
+    return zcorn;
+}
+
+std::vector<int> make_actnum(std::size_t global_size) {
+    std::vector<int> actnum(global_size, 1);
+    for (std::size_t g = 0; g < global_size; g += 3)
+        actnum[g] = 0;
+
+    return actnum;
+}
+
+}
+
+int main(int argc, char** argv) {
+    std::size_t nx = 500;
+    std::size_t ny = 500;
+    std::size_t nz = 400;
+
+    if (argc == 4) {
+        nx = std::strtoul(argv[1], nullptr, 10);
+        ny = std::strtoul(argv[2], nullptr, 10);
+        nz = std::strtoul(argv[3], nullptr, 10);
+    } else if (argc != 1) {
+        std::cerr << "Usage: grid_setup_bench [NX NY NZ]" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    const std::size_t global_size = nx * ny * nz;
+    std::cout << fmt::format("Grid: {} x {} x {} = {} cells\n", nx, ny, nz, global_size);
+
+    {
+        auto zcorn = make_zcorn(nx, ny, nz);
+        Opm::ZcornMapper mapper(nx, ny, nz);
+        std::size_t adjusted = 0;
+        const auto seconds = time_it([&]() { adjusted = mapper.fixupZCORN(zcorn); });
+        std::cout << fmt::format("fixupZCORN:  {:8.3f} s  ({} corners adjusted)\n", seconds, adjusted);
+    }
+
+    {
+        const auto actnum = make_actnum(global_size);
+        Opm::EclipseGrid grid { Opm::GridDims(nx, ny, nz) };
+        const auto seconds = time_it([&]() { grid.resetACTNUM(actnum); });
+        std::cout << fmt::format("resetACTNUM: {:8.3f} s  ({} active cells)\n", seconds, grid.getNumActive());
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,247 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <opm/common/utility/TimeService.hpp>
+
+#include <opm/input/eclipse/Deck/Deck.hpp>
+#include <opm/input/eclipse/EclipseState/EclipseState.hpp>
+#include <opm/input/eclipse/EclipseState/Grid/EclipseGrid.hpp>
+#include <opm/input/eclipse/Parser/Parser.hpp>
+#include <opm/input/eclipse/Python/Python.hpp>
+#include <opm/input/eclipse/Schedule/Action/State.hpp>
+#include <opm/input/eclipse/Schedule/Schedule.hpp>
+#include <opm/input/eclipse/Schedule/SummaryState.hpp>
+#include <opm/input/eclipse/Schedule/Well/WellTestState.hpp>
+
+#include <opm/io/eclipse/ERst.hpp>
+#include <opm/io/eclipse/OutputStream.hpp>
+#include <opm/io/eclipse/RestartFileView.hpp>
+#include <opm/io/eclipse/rst/state.hpp>
+
+#include <opm/output/data/Wells.hpp>
+#include <opm/output/eclipse/AggregateConnectionData.hpp>
+#include <opm/output/eclipse/AggregateGroupData.hpp>
+#include <opm/output/eclipse/AggregateWellData.hpp>
+#include <opm/output/eclipse/WriteRestartHelpers.hpp>
+
+/*
+  Small timing driver for RestartIO::RstState::load(), i.e., the
+  reconstruction of wells, connections and groups from a restart file.  The
+  model is synthetic: one vertical producer with NCONN connections in each
+  column of the grid, in ten groups.  The restart file for report step 2 is
+  written to the current directory with the restart aggregators, and then
+  loaded with one thread and with all available threads.
+
+     rst_state_bench [NWELLS [NCONN]]
+*/
+
+namespace {
+
+template <typename F>
+double time_it(F&& func) {
+    const auto start = std::chrono::steady_clock::now();
+    func();
+    const auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(stop - start).count();
+}
+
+Opm::Deck make_deck(int num_wells, int num_conn) {
+    auto nx = 1;
+    while (nx * nx < num_wells)
+        nx++;
+
+    const auto num_cells = nx * nx * num_conn;
+
+    auto input = fmt::format(R"(RUNSPEC
+OIL
+GAS
+WATER
+UNIFOUT
+DIMENS
+ {0} {0} {1} /
+WELLDIMS
+ {2} {1} 10 {2} /
+GRID
+DXV
+{0}*100 /
+DYV
+{0}*100 /
+DZV
+{1}*10 /
+TOPS
+{3}*2000 /
+PORO
+{4}*0.2 /
+PERMX
+{4}*100 /
+PERMY
+{4}*100 /
+PERMZ
+{4}*10 /
+SCHEDULE
+TSTEP
+ 1 /
+)", nx, num_conn, num_wells, nx * nx, num_cells);
+
+    input += "WELSPECS\n";
+    for (int w = 0; w < num_wells; w++)
+        input += fmt::format(" 'W{}' 'G{}' {} {} 1* 'OIL' /\n", w + 1, w % 10 + 1, w % nx + 1, w / nx + 1);
+
+    input += "/\nCOMPDAT\n";
+    for (int w = 0; w < num_wells; w++)
+        input += fmt::format(" 'W{}' 2* 1 {} 'OPEN' 2* 0.3 /\n", w + 1, num_conn);
+
+    input += "/\nWCONPROD\n 'W*' 'OPEN' 'ORAT' 100 4* 50 /\n/\nTSTEP\n 1 /\n";
+
+    return Opm::Parser{}.parseString(input);
+}
+
+void write_restart(const Opm::EclipseState& es, const Opm::EclipseGrid& grid,
+                   const Opm::Schedule& sched, const std::string& base_name, int report_step) {
+    const auto sim_step = static_cast<std::size_t>(report_step - 1);
+    const auto& units = es.getUnits();
+
+    const auto sum_state = Opm::SummaryState { Opm::TimeService::now() };
+    const auto action_state = Opm::Action::State{};
+    const auto wtest_state = Opm::WellTestState{};
+
+    const auto ih = Opm::RestartIO::Helpers::createInteHead(es, grid, sched, 0, sim_step, sim_step, sim_step);
+    const auto lh = Opm::RestartIO::Helpers::createLogiHead(es);
+    const auto dh = Opm::RestartIO::Helpers::createDoubHead(es, sched, sim_step, sim_step + 1, 0, 0);
+
+    auto well_data = Opm::RestartIO::Helpers::AggregateWellData(ih);
+    well_data.captureDeclaredWellData(sched, es.tracer(), sim_step, action_state, wtest_state, sum_state, ih);
+    well_data.captureDynamicWellData(sched, es.tracer(), sim_step, {}, sum_state);
+
+    auto conn_data = Opm::RestartIO::Helpers::AggregateConnectionData(ih);
+    conn_data.captureDeclaredConnData(sched, grid, units, {}, sum_state, sim_step);
+
+    auto group_data = Opm::RestartIO::Helpers::AggregateGroupData(ih);
+    group_data.captureDeclaredGroupData(sched, units, sim_step, sum_state, ih);
+
+    Opm::EclIO::OutputStream::Restart rst_file {
+        Opm::EclIO::OutputStream::ResultSet { "./", base_name },
+        report_step,
+        Opm::EclIO::OutputStream::Formatted { false },
+        Opm::EclIO::OutputStream::Unified { true }
+    };
+
+    rst_file.write("INTEHEAD", ih);
+    rst_file.write("DOUBHEAD", dh);
+    rst_file.write("LOGIHEAD", lh);
+
+    rst_file.write("IGRP", group_data.getIGroup());
+    rst_file.write("SGRP", group_data.getSGroup());
+    rst_file.write("XGRP", group_data.getXGroup());
+    rst_file.write("ZGRP", group_data.getZGroup());
+
+    rst_file.write("IWEL", well_data.getIWell());
+    rst_file.write("SWEL", well_data.getSWell());
+    rst_file.write("XWEL", well_data.getXWell());
+    rst_file.write("ZWEL", well_data.getZWell());
+
+    rst_file.write("ICON", conn_data.getIConn());
+    rst_file.write("SCON", conn_data.getSConn());
+    rst_file.write("XCON", conn_data.getXConn());
+}
+
+// Time RstState::load(), excluding the scan of the restart file and the
+// loading of the arrays of the report step.
+double time_load(const Opm::EclipseState& es, const Opm::Parser& parser,
+                 const std::string& file_name, int report_step, std::size_t& num_conn) {
+    auto rst_view = std::make_shared<Opm::EclIO::RestartFileView>
+        (std::make_shared<Opm::EclIO::ERst>(file_name), report_step);
+
+    num_conn = 0;
+    return time_it([&]() {
+        const auto state = Opm::RestartIO::RstState::load(rst_view, es.runspec(), parser);
+        for (const auto& well : state.wells)
+            num_conn += well.connections.size();
+    });
+}
+
+}
+
+int main(int argc, char** argv) {
+    int num_wells = 10000;
+    int num_conn = 10;
+
+    if (argc >= 2 && argc <= 3) {
+        num_wells = std::atoi(argv[1]);
+        if (argc == 3)
+            num_conn = std::atoi(argv[2]);
+    } else if (argc != 1) {
+        std::cerr << "Usage: rst_state_bench [NWELLS [NCONN]]" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    if (num_wells < 1 || num_conn < 1) {
+        std::cerr << "NWELLS and NCONN must be positive" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    const auto deck = make_deck(num_wells, num_conn);
+    const auto es = Opm::EclipseState { deck };
+    const auto grid = Opm::EclipseGrid { deck };
+    const auto sched = Opm::Schedule { deck, es, std::make_shared<Opm::Python>() };
+    const auto parser = Opm::Parser{};
+
+    const auto base_name = std::string { "RST_STATE_BENCH" };
+    const auto report_step = 2;
+
+    const auto write_seconds = time_it([&]() { write_restart(es, grid, sched, base_name, report_step); });
+    std::cout << fmt::format("Restart file: {} wells, {} connections per well, written in {:.3f} s\n",
+                             num_wells, num_conn, write_seconds);
+
+    const auto file_name = base_name + ".UNRST";
+    std::size_t loaded_conn = 0;
+
+#ifdef _OPENMP
+    const auto max_threads = omp_get_max_threads();
+    omp_set_num_threads(1);
+    const auto sequential = time_load(es, parser, file_name, report_step, loaded_conn);
+    std::cout << fmt::format("RstState::load, threads = 1: {:8.3f} s  ({} connections)\n", sequential, loaded_conn);
+
+    omp_set_num_threads(max_threads);
+    const auto concurrent = time_load(es, parser, file_name, report_step, loaded_conn);
+    std::cout << fmt::format("RstState::load, threads = {}: {:8.3f} s  ({} connections)\n", max_threads, concurrent, loaded_conn);
+#else
+    const auto sequential = time_load(es, parser, file_name, report_step, loaded_conn);
+    std::cout << fmt::format("RstState::load: {:8.3f} s  ({} connections)\n", sequential, loaded_conn);
+#endif
+
+    std::filesystem::remove(file_name);
+
+    return EXIT_SUCCESS;
+}
@@ -20,6 +20,7 @@
 #ifndef OPM_UTILITY_SHMATCH_HPP
 #define OPM_UTILITY_SHMATCH_HPP
 
+#include <memory>
 #include <string>
 
 namespace Opm {
@@ -32,6 +33,32 @@ namespace Opm {
 
 bool shmatch(const std::string& pattern, const std::string& symbol);
 
+/*
+  The ShellPattern class is a precompiled shell pattern with the same
+  semantics as shmatch(), for matching one pattern against many names. The
+  common patterns consisting of literal characters and the wildcards '*' and
+  '?' are matched directly without going through std::regex; patterns with
+  other regular expression special characters use a std::regex which is
+  compiled once. The literal prefix of the pattern, i.e. the characters before
+  the first wildcard, is available as prefix() and can be used to restrict the
+  candidate names.
+*/
+
+class ShellPattern {
+public:
+    explicit ShellPattern(const std::string& pattern);
+
+    bool match(const std::string& symbol) const;
+    const std::string& prefix() const;
+
+private:
+    struct Regex;
+
+    std::string m_pattern;
+    std::string m_prefix;
+    std::shared_ptr<const Regex> m_regex;
+};
+
 
 }
 #endif //OPM_UTILITY_STRING_HPP
@@ -0,0 +1,69 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_ACTIVE_INDEX_MAP_HPP
+#define OPM_ACTIVE_INDEX_MAP_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Opm {
+
+/*
+  Compact representation of ACTNUM and the global <-> active cell index
+  mappings. The active flags are stored as a bit vector, with the number of
+  active cells preceding every block of 512 cells stored alongside. The
+  global -> active mapping is then a rank query and the active -> global
+  mapping is a select query; in total the structure uses roughly 1.1 bit
+  per cell, compared to 64 bits per cell for an int ACTNUM vector and an
+  int global -> active vector.
+*/
+
+class ActiveIndexMap {
+public:
+    ActiveIndexMap() = default;
+    explicit ActiveIndexMap(const std::vector<int>& actnum);
+
+    std::size_t size() const;
+    std::size_t numActive() const;
+
+    bool cellActive(std::size_t global_index) const;
+
+    // Returns -1 if the cell is not active.
+    int activeIndex(std::size_t global_index) const;
+
+    // The argument must be in the range [0, numActive()).
+    std::size_t globalIndex(std::size_t active_index) const;
+
+    std::vector<int> actnum() const;
+    std::vector<int> activeToGlobal() const;
+    std::vector<int> globalToActive() const;
+
+    bool operator==(const ActiveIndexMap& other) const;
+
+private:
+    std::size_t m_size = 0;
+    std::vector<std::uint64_t> m_bits;
+    std::vector<std::uint64_t> m_block_rank;
+};
+
+}
+
+#endif
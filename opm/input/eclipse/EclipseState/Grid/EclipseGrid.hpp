@@ -20,6 +20,7 @@
 #ifndef OPM_PARSER_ECLIPSE_GRID_HPP
 #define OPM_PARSER_ECLIPSE_GRID_HPP
 
+#include <opm/input/eclipse/EclipseState/Grid/ActiveIndexMap.hpp>
 #include <opm/input/eclipse/EclipseState/Grid/GridDims.hpp>
 #include <opm/input/eclipse/EclipseState/Grid/MapAxes.hpp>
 #include <opm/input/eclipse/EclipseState/Grid/MinpvMode.hpp>
@@ -27,6 +28,7 @@
 
 #include <array>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <stdexcept>
 #include <unordered_set>
@@ -207,6 +209,21 @@ namespace Opm {
         void resetACTNUM();
         void resetACTNUM( const std::vector<int>& actnum);
 
+        /*
+          Compact storage for very large models. compressACTNUM() replaces the
+          ACTNUM vector and the active <-> global index maps with a bit packed
+          ActiveIndexMap; the grid stays in this mode also through later calls
+          to resetACTNUM(). compressZCORN() stores ZCORN in single precision,
+          provided no value changes by more than max_error (SI units); the
+          return value tells whether the compression was carried out.
+
+          The vector accessors getACTNUM(), getActiveMap() and getZCORN() are
+          still available on a compressed grid, but will then create a full
+          copy of the data on first use.
+        */
+        void compressACTNUM();
+        bool compressZCORN(double max_error);
+
         bool equal(const EclipseGrid& other) const;
         static bool hasDVDEPTHZKeywords(const Deck&);
         
@@ -248,6 +265,25 @@ namespace Opm {
         // Numerical aquifer cells, needs to be active
         std::unordered_set<size_t> m_aquifer_cells;
 
+        // Compact storage; replaces m_actnum, m_active_to_global,
+        // m_global_to_active and m_zcorn respectively when in use.
+        std::optional<ActiveIndexMap> m_active_map;
+        std::vector<float> m_zcorn_compact;
+        mutable std::optional<std::vector<int>> expanded_actnum;
+        mutable std::optional<std::vector<int>> expanded_active_map;
+        mutable std::optional<std::vector<double>> expanded_zcorn;
+
+        // The expanded arrays are created on first access through the const
+        // accessors, which may be called from several threads at once.
+        struct ExpansionLock {
+            ExpansionLock() = default;
+            ExpansionLock(const ExpansionLock&) {}
+            ExpansionLock& operator=(const ExpansionLock&) { return *this; }
+
+            std::mutex mutex;
+        };
+        mutable ExpansionLock expansion_lock;
+
         // Radial grids need this for volume calculations.
         std::optional<std::vector<double>> m_thetav;
         std::optional<std::vector<double>> m_rv;
@@ -60,9 +60,25 @@ namespace Fieldprops
         std::optional<std::vector<value::status>> global_value_status;
         mutable bool all_set;
 
+        /*
+          When all the elements of a keyword have the same status the
+          value_status vector is dropped with finalize(); the common status
+          is then kept in uniform_status. Code which reads the status of
+          individual elements should go through status(), and code which
+          modifies the data must call thaw() first.
+        */
+        std::optional<value::status> uniform_status;
+
         bool operator==(const FieldData& other) const {
+            if (this->size() != other.size())
+                return false;
+
+            for (std::size_t i = 0; i < this->size(); i++) {
+                if (this->status(i) != other.status(i))
+                    return false;
+            }
+
             return this->data == other.data &&
-                   this->value_status == other.value_status &&
                    this->kw_info == other.kw_info &&
                    this->global_data == other.global_data &&
                    this->global_value_status == other.global_value_status;
@@ -91,10 +107,47 @@ namespace Fieldprops
             return this->data.size();
         }
 
+        value::status status(std::size_t index) const {
+            if (this->uniform_status.has_value())
+                return *this->uniform_status;
+
+            return this->value_status[index];
+        }
+
+        bool finalize() {
+            if (this->uniform_status.has_value())
+                return true;
+
+            if (this->value_status.empty())
+                return false;
+
+            const auto first = this->value_status.front();
+            if (!std::all_of(this->value_status.begin(), this->value_status.end(), [first](const value::status& status) { return status == first; }))
+                return false;
+
+            this->uniform_status = first;
+            std::vector<value::status>().swap(this->value_status);
+            return true;
+        }
+
+        void thaw() {
+            if (!this->uniform_status.has_value())
+                return;
+
+            this->value_status.assign(this->data.size(), *this->uniform_status);
+            this->uniform_status.reset();
+        }
+
         bool valid() const {
             if (this->all_set)
                 return true;
 
+            if (this->uniform_status.has_value()) {
+                this->all_set = *this->uniform_status != value::status::uninitialized &&
+                                *this->uniform_status != value::status::empty_default;
+                return this->all_set;
+            }
+
             static const std::array<value::status,2> invalid_value = {value::status::uninitialized, value::status::empty_default};
             const auto& it = std::find_first_of(this->value_status.begin(), this->value_status.end(), invalid_value.begin(), invalid_value.end());
             this->all_set = (it == this->value_status.end());
@@ -103,19 +156,23 @@ namespace Fieldprops
         }
 
         bool valid_default() const {
+            if (this->uniform_status.has_value())
+                return *this->uniform_status == value::status::valid_default;
+
             return std::all_of( this->value_status.begin(), this->value_status.end(), [] (const value::status& status) {return status == value::status::valid_default; });
         }
 
 
         void compress(const std::vector<bool>& active_map) {
             Fieldprops::compress(this->data, active_map);
-            Fieldprops::compress(this->value_status, active_map);
+            if (!this->uniform_status.has_value())
+                Fieldprops::compress(this->value_status, active_map);
         }
 
         void copy(const FieldData<T>& src, const std::vector<Box::cell_index>& index_list) {
             for (const auto& ci : index_list) {
                 this->data[ci.active_index] = src.data[ci.active_index];
-                this->value_status[ci.active_index] = src.value_status[ci.active_index];
+                this->value_status[ci.active_index] = src.status(ci.active_index);
             }
         }
 
@@ -20,8 +20,10 @@
 #define FIELDPROPS_HPP
 
 #include <limits>
+#include <memory>
 #include <optional>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -411,11 +413,12 @@ public:
         if (!allow_unsupported && !FieldProps::supported<T>(keyword))
             return FieldDataManager<T>(keyword, GetStatus::NOT_SUPPPORTED_KEYWORD, nullptr);
 
-        const Fieldprops::FieldData<T> * field_data;
-        bool has0 = this->has<T>(keyword);
+        const Fieldprops::FieldData<T> * field_data = this->find<T>(keyword);
+        bool has0 = (field_data != nullptr);
 
-        field_data = std::addressof(this->init_get<T>(keyword,
-                                                      std::is_same<T,double>::value && allow_unsupported));
+        if (!has0)
+            field_data = std::addressof(this->init_get<T>(keyword,
+                                                          std::is_same<T,double>::value && allow_unsupported));
         if (field_data->valid() || allow_unsupported)
             return FieldDataManager<T>(keyword, GetStatus::OK, field_data);
 
@@ -468,15 +471,24 @@ public:
 
     template <typename T>
     std::vector<bool> defaulted(const std::string& keyword) {
-        const auto& field = this->init_get<T>(keyword);
+        const auto* field_ptr = this->find<T>(keyword);
+        const auto& field = (field_ptr != nullptr) ? *field_ptr : this->init_get<T>(keyword);
         std::vector<bool> def(field.size());
 
         for (std::size_t i=0; i < def.size(); i++)
-            def[i] = value::defaulted( field.value_status[i]);
+            def[i] = value::defaulted( field.status(i));
 
         return def;
     }
 
+    /*
+      Drop the value_status vector of all fully initialized keywords where all
+      elements have the same status, see FieldData::finalize(). The status is
+      restored by init_get() if a keyword is modified later, e.g. by
+      handle_schedule_keywords().
+    */
+    void finalize_keywords();
+
 
     template <typename T>
     std::vector<T> global_copy(const std::vector<T>& data, const std::optional<T>& default_value) const {
@@ -526,6 +538,9 @@ private:
     template <typename T>
     void erase(const std::string& keyword);
 
+    template <typename T>
+    const Fieldprops::FieldData<T>* find(const std::string& keyword) const;
+
     template <typename T>
     std::vector<T> extract(const std::string& keyword);
 
@@ -571,8 +586,14 @@ private:
     TableManager tables;
     std::optional<satfunc::RawTableEndPoints> m_rtep;
     std::vector<MultregpRecord> multregp;
-    std::unordered_map<std::string, Fieldprops::FieldData<int>> int_data;
-    std::unordered_map<std::string, Fieldprops::FieldData<double>> double_data;
+    /*
+      The keyword data is reference counted and shared between copies of a
+      FieldProps instance, e.g. when a FieldPropsManager is copied. A keyword
+      is only duplicated when it is about to be modified; all modifying access
+      goes through init_get(), which takes care of that.
+    */
+    std::unordered_map<std::string, std::shared_ptr<Fieldprops::FieldData<int>>> int_data;
+    std::unordered_map<std::string, std::shared_ptr<Fieldprops::FieldData<double>>> double_data;
 
     Fieldprops::TranMap tran;
 };
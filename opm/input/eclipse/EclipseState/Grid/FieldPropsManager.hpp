@@ -50,9 +50,26 @@ public:
     virtual std::vector<int> actnum() const;
     virtual std::vector<double> porv(bool global = false) const;
 
+    /*
+      The ACTNUM vector which maps the active sized field data to global
+      cells, returned by reference.  Contrary to actnum() cells with zero
+      pore volume are not deactivated.
+    */
+    const std::vector<int>& actnumRaw() const;
+
 
     void apply_schedule_keywords(const std::vector<DeckKeyword>& keywords);
 
+    /*
+      Copies of a FieldPropsManager share the keyword data; the data is only
+      duplicated when one of the copies is modified with reset_actnum(),
+      apply_schedule_keywords() or apply_numerical_aquifers().
+
+      Keywords where all elements have the same value status after the deck
+      has been processed keep that status once, in uniform_status, instead
+      of in the per element value_status vector; see FieldData::status().
+    */
+
     /// \brief Whether we can call methods on the manager
     bool is_usable() const;
 
@@ -268,6 +285,8 @@ private:
     template <typename T>
     std::vector<T> get_global(const std::string& keyword) const;
 
+    void detach();
+
     std::shared_ptr<FieldProps> fp;
 };
 
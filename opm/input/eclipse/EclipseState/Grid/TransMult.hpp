@@ -30,9 +30,12 @@
 #define OPM_PARSER_TRANSMULT_HPP
 
 
+#include <algorithm>
+#include <array>
 #include <cstddef>
 #include <map>
 #include <memory>
+#include <vector>
 
 #include <opm/input/eclipse/EclipseState/Grid/FaceDir.hpp>
 #include <opm/input/eclipse/EclipseState/Grid/MULTREGTScanner.hpp>
@@ -54,6 +57,27 @@ namespace Opm {
 
         double getMultiplier(size_t globalIndex, FaceDir::DirEnum faceDir) const;
         double getMultiplier(size_t i , size_t j , size_t k, FaceDir::DirEnum faceDir) const;
+
+        /*
+          Batch version of getMultiplier(): multipliers[c] is set to the
+          multiplier of face faceDir of cell globalIndices[c]. The global
+          indices are not range checked.
+        */
+        template <typename IndexVector>
+        void getMultipliers(const IndexVector& globalIndices, FaceDir::DirEnum faceDir, std::vector<double>& multipliers) const
+        {
+            multipliers.resize(globalIndices.size());
+            const auto* data = this->getDirectionData(faceDir);
+            if (data == nullptr) {
+                std::fill(multipliers.begin(), multipliers.end(), 1.0);
+                return;
+            }
+
+            std::size_t c = 0;
+            for (const auto globalIndex : globalIndices)
+                multipliers[c++] = (*data)[globalIndex];
+        }
+
         double getRegionMultiplier( size_t globalCellIndex1, size_t globalCellIndex2, FaceDir::DirEnum faceDir) const;
         void applyMULT(const std::vector<double>& srcMultProp, FaceDir::DirEnum faceDir);
         void applyMULTFLT(const FaultCollection& faults);
@@ -78,9 +102,13 @@ namespace Opm {
         double getMultiplier__(size_t globalIndex , FaceDir::DirEnum faceDir) const;
         bool hasDirectionProperty(FaceDir::DirEnum faceDir) const;
         std::vector<double>& getDirectionProperty(FaceDir::DirEnum faceDir);
+        const std::vector<double>* getDirectionData(FaceDir::DirEnum faceDir) const;
+        static std::size_t directionSlot(FaceDir::DirEnum faceDir);
 
         size_t m_nx = 0, m_ny = 0, m_nz = 0;
-        std::map<FaceDir::DirEnum , std::vector<double> > m_trans;
+        // One slot per face direction, indexed with directionSlot(); the
+        // slots for directions without any multipliers are left empty.
+        std::array<std::vector<double>, 6> m_trans;
         std::map<FaceDir::DirEnum , std::string> m_names;
         MULTREGTScanner m_multregtScanner;
     };
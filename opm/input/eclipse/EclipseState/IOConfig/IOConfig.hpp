@@ -156,6 +156,10 @@ namespace Opm {
 
         void setEclCompatibleRST(bool ecl_rst);
         bool getEclCompatibleRST() const;
+        /// Write INIT and restart files in the compressed binary format of
+        /// EclCompression.hpp.  Ignored for formatted output.
+        void setCompressedOutput(bool compressed);
+        bool getCompressedOutput() const;
         bool getWriteEGRIDFile() const;
         bool getWriteINITFile() const;
         bool getUNIFOUT() const;
@@ -203,6 +207,7 @@ namespace Opm {
             serializer(m_nosim);
             serializer(m_base_name);
             serializer(ecl_compatible_rst);
+            serializer(compressed_output);
         }
 
     private:
@@ -218,6 +223,7 @@ namespace Opm {
         bool            m_nosim;
         std::string     m_base_name;
         bool            ecl_compatible_rst = true;
+        bool            compressed_output = false;
 
         IOConfig( const GRIDSection&,
                   const RUNSPECSection&,
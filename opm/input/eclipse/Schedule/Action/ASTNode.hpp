@@ -47,6 +47,8 @@ public:
     }
 
 private:
+    friend class Program;
+
     std::vector<std::string> arg_list;
     double number = 0.0;
 
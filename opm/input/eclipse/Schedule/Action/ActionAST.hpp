@@ -33,6 +33,7 @@ namespace Action {
 
 class Context;
 class ASTNode;
+class Program;
 
 
 /*
@@ -46,6 +47,13 @@ public:
     AST() = default;
     explicit AST(const std::vector<std::string>& tokens);
 
+    // The compiled program caches state from the evaluations, every copy
+    // therefore gets a program of its own.
+    AST(const AST& other);
+    AST(AST&& other) = default;
+    AST& operator=(const AST& other);
+    AST& operator=(AST&& other) = default;
+
     static AST serializationTestObject();
 
     Result eval(const Context& context) const;
@@ -56,6 +64,8 @@ public:
     void serializeOp(Serializer& serializer)
     {
         serializer(condition);
+        if (!serializer.isSerializing())
+            this->compile();
     }
     void required_summary(std::unordered_set<std::string>& required_summary) const;
 
@@ -67,6 +77,16 @@ private:
       shared_ptr does not imply any shared ownership of the ASTNode.
     */
     std::shared_ptr<ASTNode> condition;
+
+    /*
+      Compiled form of the condition, which is used for the evaluation. This
+      is nullptr if the condition could not be compiled; the condition is
+      then evaluated with ASTNode::eval(). The program is not shared between
+      copies of the AST.
+    */
+    std::shared_ptr<const Program> program;
+
+    void compile();
 };
 }
 }
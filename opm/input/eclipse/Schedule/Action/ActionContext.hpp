@@ -21,6 +21,7 @@
 #ifndef ActionContext_HPP
 #define ActionContext_HPP
 
+#include <cstddef>
 #include <string>
 #include <map>
 
@@ -40,6 +41,12 @@ class Context {
 public:
     explicit Context(const SummaryState& summary_state, const WListManager& wlm);
 
+    /*
+      A context created with a mutable SummaryState can in addition register
+      handles for the summary values, see handle().
+    */
+    explicit Context(SummaryState& summary_state, const WListManager& wlm);
+
     /*
       The get methods will first check the internal storage in the 'values' map
       and then subsequently query the SummaryState member.
@@ -50,11 +57,26 @@ public:
     double get(const std::string& func) const;
     void   add(const std::string& func, double value);
 
+    /*
+      Summary values which are read in every evaluation can be read through
+      a SummaryState handle, registered with handle(). The handles are tied
+      to the SummaryState of the context, identified by handle_owner(). The
+      values added to the context still take precedence.
+
+      Handles can only be registered when the context was created with a
+      mutable SummaryState; otherwise handle_owner() returns zero and the
+      values must be read by key.
+    */
+    SummaryState::Handle handle(const std::string& key) const;
+    std::size_t handle_owner() const;
+    double get(SummaryState::Handle handle, const std::string& key) const;
+
     std::vector<std::string> wells(const std::string& func) const;
     const WListManager& wlist_manager() const;
 
 private:
     const SummaryState& summary_state;
+    SummaryState* handle_registry = nullptr;
     const WListManager& wlm;
     std::map<std::string, double> values;
 };
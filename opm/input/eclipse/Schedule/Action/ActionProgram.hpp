@@ -0,0 +1,137 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef ACTION_PROGRAM_HPP
+#define ACTION_PROGRAM_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <opm/input/eclipse/Schedule/Action/ActionResult.hpp>
+#include <opm/input/eclipse/Schedule/Action/ActionValue.hpp>
+#include <opm/input/eclipse/Schedule/SummaryState.hpp>
+
+namespace Opm {
+namespace Action {
+
+class ASTNode;
+class Context;
+
+/*
+  The Action::Program class is a compiled form of an ACTIONX condition. When
+  the condition is compiled the summary keys are assembled, the special
+  treatment of numeric MNTH comparisons is resolved and every well argument
+  is classified as a single well, a well name pattern or a WLIST.
+
+  The wells matching a pattern or a WLIST are resolved the first time the
+  condition is evaluated, and then again only when the list of wells with
+  the summary variable - or the content of the WLIST - has changed. While
+  evaluating, the set of matching wells is represented as a bitset over all
+  wells seen by the program, and converted to a Result with well names at
+  the very end.
+
+  Conditions with an unexpected structure - which the ASTNode evaluation
+  will reject with an exception - are not compiled; Program::compile()
+  returns nullptr for those, and the caller should evaluate the ASTNode
+  directly. The summary values are read through SummaryState handles when
+  the context can register them, and the handles are registered again when
+  the program is evaluated with a different SummaryState. The resolved well sets are cached in the Program instance, and
+  evaluation is therefore not thread safe. Every copy of an Action::AST has a
+  Program instance of its own.
+*/
+
+class Program {
+public:
+    static std::shared_ptr<const Program> compile(const ASTNode& condition);
+
+    Result eval(const Context& context) const;
+
+private:
+    using Bits = std::vector<std::uint64_t>;
+
+    struct Truth {
+        bool value = false;
+        bool has_wells = false;
+        Bits wells;
+    };
+
+    struct WellCache {
+        bool valid = false;
+        std::vector<std::string> source;
+        std::vector<std::string> keys;
+        std::vector<SummaryState::Handle> handles;
+        std::vector<std::size_t> wells;
+    };
+
+    enum class Kind {
+        Number,
+        Scalar,
+        Well,
+        WellPattern,
+        WList
+    };
+
+    struct Operand {
+        Kind kind = Kind::Number;
+        double number = 0;
+        std::string key;
+        std::string func;
+        std::string pattern;
+        std::size_t well = 0;
+        std::size_t cache = 0;
+        std::size_t handle = 0;
+    };
+
+    struct Node {
+        TokenType type = TokenType::error;
+        std::vector<Node> children;
+        Operand lhs;
+        Operand rhs;
+    };
+
+    Program() = default;
+
+    bool compile_node(const ASTNode& ast_node, Node& node);
+    bool compile_operand(const ASTNode& ast_node, Operand& operand);
+
+    Truth eval_node(const Node& node, const Context& context) const;
+    Truth eval_cmp(const Node& node, const Context& context) const;
+    const WellCache& resolve(const Operand& operand, const Context& context) const;
+    double value(const Operand& operand, const Context& context) const;
+    void bind(const Context& context) const;
+    std::size_t well_index(const std::string& well) const;
+
+    Node root;
+    std::size_t num_caches = 0;
+    std::vector<std::string> keys;
+
+    mutable std::size_t handle_owner = 0;
+    mutable std::vector<SummaryState::Handle> handles;
+    mutable std::vector<WellCache> caches;
+    mutable std::vector<std::string> well_names;
+    mutable std::unordered_map<std::string, std::size_t> well_lookup;
+};
+
+}
+}
+#endif
@@ -0,0 +1,90 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef PREPARED_KEYWORDS_HPP
+#define PREPARED_KEYWORDS_HPP
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
+#include <opm/input/eclipse/Schedule/MSW/WellSegments.hpp>
+#include <opm/input/eclipse/Schedule/VFPInjTable.hpp>
+#include <opm/input/eclipse/Schedule/VFPProdTable.hpp>
+
+namespace Opm {
+
+class DeckKeyword;
+class ScheduleDeck;
+class UnitSystem;
+
+/*
+  Some of the SCHEDULE keywords are expensive to internalize, but the result
+  only depends on the keyword itself and a few static properties of the
+  deck - not on the state of the schedule when the keyword is encountered.
+  For those keywords - currently VFPPROD, VFPINJ and WELSEGS - the
+  PreparedKeywords class assembles the internal objects for a range of
+  report steps up front, spread over all available threads. The ordinary
+  sequential processing in Schedule::iterateScheduleSection() then picks up
+  the prepared objects with take() instead of creating them.
+
+  Warnings emitted while assembling an object are held back and logged in
+  take(), so the log output is the same as for sequential processing. If
+  assembling an object fails, nothing is stored for the keyword; the error
+  is then raised with the full context when the keyword is processed
+  sequentially.
+
+  The prepared objects are identified by the address of the DeckKeyword
+  instance, copies of a PreparedKeywords instance are therefore empty.
+*/
+
+class PreparedKeywords {
+public:
+    PreparedKeywords() = default;
+    PreparedKeywords(const ScheduleDeck& sched_deck,
+                     std::size_t load_start,
+                     std::size_t load_end,
+                     bool gaslift_opt_active,
+                     const UnitSystem& unit_system);
+
+    PreparedKeywords(const PreparedKeywords&);
+    PreparedKeywords(PreparedKeywords&&) = default;
+    PreparedKeywords& operator=(const PreparedKeywords&);
+    PreparedKeywords& operator=(PreparedKeywords&&) = default;
+
+    template <typename T>
+    std::optional<T> take(const DeckKeyword& keyword);
+
+    std::size_t size() const;
+
+private:
+    struct Entry {
+        std::variant<VFPProdTable, VFPInjTable, WellSegments> value;
+        std::vector<std::string> warnings;
+    };
+
+    std::unordered_map<const DeckKeyword*, Entry> entries;
+};
+
+}
+
+#endif
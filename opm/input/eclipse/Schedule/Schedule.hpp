@@ -19,10 +19,12 @@
 #ifndef SCHEDULE_HPP
 #define SCHEDULE_HPP
 
+#include <atomic>
 #include <cstddef>
 #include <ctime>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <iosfwd>
 #include <string>
@@ -38,6 +40,7 @@
 #include <opm/input/eclipse/Schedule/Group/GuideRateConfig.hpp>
 #include <opm/input/eclipse/Schedule/MessageLimits.hpp>
 #include <opm/input/eclipse/Schedule/Network/ExtNetwork.hpp>
+#include <opm/input/eclipse/Schedule/PreparedKeywords.hpp>
 #include <opm/input/eclipse/Schedule/RPTConfig.hpp>
 #include <opm/input/eclipse/Schedule/ScheduleDeck.hpp>
 #include <opm/input/eclipse/Schedule/ScheduleState.hpp>
@@ -249,6 +252,8 @@ namespace Opm
         const Well& getWellatEnd(const std::string& well_name) const;
         std::vector<Well> getWells(std::size_t timeStep) const;
         std::vector<Well> getWellsatEnd() const;
+        ScheduleState::WellsView getWellsView(std::size_t timeStep) const;
+        ScheduleState::WellsView getWellsViewatEnd() const;
         void shut_well(const std::string& well_name, std::size_t report_step);
         void stop_well(const std::string& well_name, std::size_t report_step);
         void open_well(const std::string& well_name, std::size_t report_step);
@@ -321,6 +326,7 @@ namespace Opm
         template<class Serializer>
         void serializeOp(Serializer& serializer)
         {
+            this->materialize();
             serializer(this->m_static);
             serializer(this->m_sched_deck);
             serializer(this->action_wgnames);
@@ -545,6 +551,73 @@ namespace Opm
         WriteRestartFileEvents restart_output;
         CompletedCells completed_cells;
 
+        /*
+          When an ACTIONX or PYACTION has added keywords to report step N all
+          the following report steps must be reprocessed. That is deferred:
+          the snapshots vector is truncated to [0, N] and the remaining steps
+          are recreated by materialize() when they are first requested. With
+          actions firing frequently the simulator typically only ever asks
+          for the next report step before the schedule is modified again.
+        */
+        struct PendingReplay {
+            std::size_t end;
+            std::unordered_map<std::string, double> target_wellpi;
+            std::string prefix;
+            bool log_to_debug;
+            bool started = false;
+        };
+
+        /*
+          While a replay is pending the snapshots past its start are in
+          effect a cache, filled on demand by materialize() from the const
+          accessors. This member holds the bookkeeping of that cache and is
+          therefore mutable; it is not part of the observable state of the
+          Schedule.
+
+          The const accessors may be called concurrently, and the replay is
+          therefore serialized with a mutex. The end of the pending replay -
+          zero if there is none - is mirrored in an atomic so the accessors
+          can skip the mutex when nothing is pending. The mutex is recursive
+          because the keyword handlers use the accessors while replaying.
+          The snapshots vector has capacity for all report steps while a
+          replay is pending, references to the existing snapshots therefore
+          remain valid while new steps are appended.
+        */
+        struct ReplayCache {
+            ReplayCache() = default;
+            ReplayCache(const ReplayCache& other) : pending(other.pending), end(other.end.load()) {}
+            ReplayCache& operator=(const ReplayCache& other) {
+                this->pending = other.pending;
+                this->end = other.end.load();
+                return *this;
+            }
+
+            std::optional<PendingReplay> pending;
+            std::recursive_mutex mutex;
+            std::atomic<std::size_t> end{0};
+        };
+        mutable ReplayCache replay_cache;
+
+        /*
+          Objects assembled in parallel from the keywords of the report steps
+          currently being loaded by iterateScheduleSection(). This is only
+          populated during the loading, and is not part of the state of the
+          Schedule.
+        */
+        PreparedKeywords prepared_keywords;
+
+        void defer_replay(std::size_t report_step,
+                          const std::unordered_map<std::string, double>& target_wellpi,
+                          const std::string& prefix,
+                          bool log_to_debug);
+        void materialize(std::size_t report_step) const;
+        void materialize() const;
+
+        // Last report step, after any pending replay has completed. While
+        // replaying, i.e. when called from the keyword handlers, this is the
+        // report step being processed.
+        std::size_t last_step() const;
+
         void load_rst(const RestartIO::RstState& rst,
                       const TracerConfig& tracer_config,
                       const ScheduleGrid& grid,
@@ -577,7 +650,8 @@ namespace Opm
                                     const ScheduleGrid& grid,
                                     const std::unordered_map<std::string, double> * target_wellpi,
                                     const std::string& prefix,
-                                    const bool log_to_debug = false);
+                                    const bool log_to_debug = false,
+                                    const bool log_header = true);
         void addACTIONX(const Action::ActionX& action);
         void addGroupToGroup( const std::string& parent_group, const std::string& child_group);
         void addGroup(const std::string& groupName , std::size_t timeStep);
@@ -22,6 +22,7 @@
 
 #include <chrono>
 #include <cstddef>
+#include <iterator>
 #include <memory>
 #include <optional>
 #include <unordered_map>
@@ -130,6 +131,14 @@ namespace Opm {
                 return *this->m_data;
             }
 
+            /*
+              Shared read only access to the current instance, which remains
+              valid also if this member is later updated.
+            */
+            std::shared_ptr<const T> shared() const {
+                return this->m_data;
+            }
+
         private:
             std::shared_ptr<T> m_data;
         };
@@ -270,6 +279,95 @@ namespace Opm {
         };
 
 
+        /*
+          Non-owning view of the wells in a ScheduleState, ordered as in
+          well_order(). The Well objects are looked up when they are accessed,
+          no Well is copied. The view is valid for as long as a reference to
+          the ScheduleState it was created from is valid.
+        */
+
+        class WellsView {
+        public:
+            class const_iterator {
+            public:
+                using iterator_category = std::forward_iterator_tag;
+                using value_type = Well;
+                using difference_type = std::ptrdiff_t;
+                using pointer = const Well*;
+                using reference = const Well&;
+
+                const_iterator(const WellsView* view, std::size_t index)
+                    : m_view(view)
+                    , m_index(index)
+                {}
+
+                reference operator*() const {
+                    return (*this->m_view)[this->m_index];
+                }
+
+                pointer operator->() const {
+                    return &(*this->m_view)[this->m_index];
+                }
+
+                const_iterator& operator++() {
+                    this->m_index++;
+                    return *this;
+                }
+
+                const_iterator operator++(int) {
+                    auto iter = *this;
+                    this->m_index++;
+                    return iter;
+                }
+
+                bool operator==(const const_iterator& other) const {
+                    return this->m_view == other.m_view && this->m_index == other.m_index;
+                }
+
+                bool operator!=(const const_iterator& other) const {
+                    return !(*this == other);
+                }
+
+            private:
+                const WellsView* m_view;
+                std::size_t m_index;
+            };
+
+            WellsView(const NameOrder& well_order, const map_member<std::string, Well>& wells)
+                : m_well_order(&well_order)
+                , m_wells(&wells)
+            {}
+
+            std::size_t size() const {
+                return this->m_well_order->size();
+            }
+
+            bool empty() const {
+                return this->size() == 0;
+            }
+
+            const std::string& name(std::size_t index) const {
+                return (*this->m_well_order)[index];
+            }
+
+            const Well& operator[](std::size_t index) const {
+                return this->m_wells->get(this->name(index));
+            }
+
+            const_iterator begin() const {
+                return const_iterator(this, 0);
+            }
+
+            const_iterator end() const {
+                return const_iterator(this, this->size());
+            }
+
+        private:
+            const NameOrder* m_well_order;
+            const map_member<std::string, Well>* m_wells;
+        };
+
+
 
         ScheduleState() = default;
         explicit ScheduleState(const time_point& start_time);
@@ -342,6 +440,8 @@ namespace Opm {
 
         bool has_gpmaint() const;
 
+        WellsView wells_view() const;
+
         /*********************************************************************/
 
         ptr_member<GConSale> gconsale;
@@ -21,11 +21,13 @@
 #define SUMMARY_STATE_H
 
 #include <chrono>
+#include <cstddef>
 #include <iosfwd>
 #include <optional>
 #include <string>
 #include <unordered_map>
 #include <set>
+#include <utility>
 #include <vector>
 
 #include <opm/common/utility/TimeService.hpp>
@@ -64,11 +66,40 @@ class UDQSet;
       // accessible through the specialized st.has_well_var("OPY", "WGOR").
       st.has("WGOR:OPY") => True
       st.has_well_var("OPY", "WGOR") => False
+
+  For repeated access to the same values - typically once every report step -
+  a variable can be registered once to get a Handle, and then be updated and
+  read through the handle:
+
+      auto h = st.well_var_handle("OPX", "WWCT");
+      st.update(h, 0.75);
+      st.get(h) => 0.75
+      st.get_well_var("OPX", "WWCT") => 0.75
+
+  Updating through a handle has exactly the same effect as the corresponding
+  update(), update_well_var() or update_group_var() call, but after the first
+  access the handle is resolved to the storage location of the value, so the
+  string hashing and the classification of the variable as a total are not
+  repeated. A handle is valid for the SummaryState it was registered with and
+  copies of it; the resolved locations are private to each object and are
+  discarded whenever values are erased or replaced. Access through handles
+  updates this internal cache and is not thread safe.
+
+  Registering a handle adds to the handle table of the object, and should be
+  done once and not for every access. Code which stores handles between calls
+  should also store handle_owner() of the object they were registered with;
+  the owner changes when the SummaryState is copied or assigned, and the
+  handles must then be registered again.
 */
 
 class SummaryState {
 public:
     typedef std::unordered_map<std::string, double>::const_iterator const_iterator;
+
+    struct Handle {
+        std::size_t slot;
+    };
+
     explicit SummaryState(time_point sim_start_arg);
 
     // The std::time_t constructor is only for export to Python
@@ -114,6 +145,17 @@ public:
     double get_group_var(const std::string& group, const std::string& var, double) const;
     double get_conn_var(const std::string& conn, const std::string& var, std::size_t global_index, double) const;
 
+    Handle handle(const std::string& key);
+    Handle well_var_handle(const std::string& well, const std::string& var);
+    Handle group_var_handle(const std::string& group, const std::string& var);
+    std::size_t num_handles() const;
+    std::size_t handle_owner() const;
+
+    void update(Handle handle, double value);
+    bool has(Handle handle) const;
+    double get(Handle handle) const;
+    double get(Handle handle, double default_value) const;
+
     const std::vector<std::string>& wells() const;
     std::vector<std::string> wells(const std::string& var) const;
     const std::vector<std::string>& groups() const;
@@ -138,6 +180,8 @@ public:
       serializer(m_groups);
       serializer(group_names);
       serializer(conn_values);
+      if (!serializer.isSerializing())
+          this->handle_cache.clear();
     }
 
     static SummaryState serializationTestObject()
@@ -175,6 +219,58 @@ private:
     // The first key is the variable and the second key is the well and the
     // third is the global index. NB: The global_index has offset 1!
     std::unordered_map<std::string, std::unordered_map<std::string, std::unordered_map<std::size_t, double>>> conn_values;
+
+    enum class HandleType {
+        Key,
+        Well,
+        Group
+    };
+
+    struct HandleSlot {
+        HandleType type;
+        std::string key;
+        std::string var;
+        std::string wgname;
+        bool total;
+    };
+
+    /*
+      Pointers to the value in the general values map and - for well and
+      group variables - the value in the specialized map for every handle;
+      nullptr if the handle has not been resolved. The pointers are into the
+      maps of this object, a copy therefore starts out with an empty cache.
+    */
+    struct HandleCache {
+        HandleCache() = default;
+        HandleCache(const HandleCache&) {}
+        HandleCache& operator=(const HandleCache&) { this->clear(); return *this; }
+
+        void clear() { this->pointers.clear(); }
+
+        std::vector<std::pair<double*, double*>> pointers;
+    };
+
+    /*
+      Identity of the handles registered with this object; every object -
+      including copies - gets a new value.
+    */
+    struct HandleOwner {
+        HandleOwner() : id(next()) {}
+        HandleOwner(const HandleOwner&) : id(next()) {}
+        HandleOwner& operator=(const HandleOwner&) { this->id = next(); return *this; }
+
+        static std::size_t next();
+
+        std::size_t id;
+    };
+
+    std::pair<double*, double*>& resolve(Handle handle) const;
+    Handle add_handle(HandleType type, const std::string& key, const std::string& var, const std::string& wgname);
+
+    std::vector<HandleSlot> handle_slots;
+    std::unordered_map<std::string, std::size_t> handle_index;
+    mutable HandleCache handle_cache;
+    HandleOwner owner;
 };
 
 
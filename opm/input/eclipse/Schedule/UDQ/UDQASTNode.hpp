@@ -75,6 +75,8 @@ public:
     }
 
 private:
+    friend class UDQProgram;
+
     UDQTokenType type;
     void func_tokens(std::set<UDQTokenType>& tokens) const;
 
@@ -21,17 +21,18 @@
 #ifndef UDQ_CONTEXT_HPP
 #define UDQ_CONTEXT_HPP
 
+#include <cstddef>
 #include <optional>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
 
+#include <opm/input/eclipse/Schedule/SummaryState.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQParams.hpp>
 #include <opm/input/eclipse/Schedule/Well/WellMatcher.hpp>
 
 namespace Opm {
-    class SummaryState;
     class UDQFunctionTable;
     class UDQSet;
     class UDQState;
@@ -42,6 +43,24 @@ namespace Opm {
         std::optional<double> get(const std::string& key) const;
         std::optional<double> get_well_var(const std::string& well, const std::string& var) const;
         std::optional<double> get_group_var(const std::string& group, const std::string& var) const;
+
+        /*
+          Summary values which are read in every evaluation can be read
+          through SummaryState handles. The handles are registered with the
+          SummaryState of the context, identified by handle_owner(), and the
+          value passed to the handle based get methods must be the handle of
+          the same key or variable. UDQ variables are not read through the
+          handle.
+        */
+        SummaryState::Handle handle(const std::string& key);
+        SummaryState::Handle well_var_handle(const std::string& well, const std::string& var);
+        SummaryState::Handle group_var_handle(const std::string& group, const std::string& var);
+        std::size_t handle_owner() const;
+
+        std::optional<double> get(const std::string& key, SummaryState::Handle handle) const;
+        std::optional<double> get_well_var(const std::string& well, const std::string& var, SummaryState::Handle handle) const;
+        std::optional<double> get_group_var(const std::string& group, const std::string& var, SummaryState::Handle handle) const;
+
         void add(const std::string& key, double value);
         void update_assign(std::size_t report_step, const std::string& keyword, const UDQSet& udq_result);
         void update_define(std::size_t report_step, const std::string& keyword, const UDQSet& udq_result);
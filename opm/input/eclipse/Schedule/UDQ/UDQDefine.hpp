@@ -37,6 +37,8 @@
 namespace Opm {
 
 class UDQASTNode;
+class UDQProgram;
+class UDQWorkspace;
 class ParseContext;
 class ErrorGuard;
 
@@ -69,7 +71,8 @@ public:
 
     static UDQDefine serializationTestObject();
 
-    UDQSet eval(const UDQContext& context) const;
+    UDQSet eval(UDQContext& context) const;
+    UDQSet eval(UDQWorkspace& workspace) const;
     const std::string& keyword() const;
     const std::string& input_string() const;
     const KeywordLocation& location() const;
@@ -92,12 +95,17 @@ public:
         serializer(string_data);
         serializer(m_update_status);
         serializer(m_report_step);
+        if (!serializer.isSerializing())
+            this->compile();
     }
 
 private:
+    void compile();
+
     std::string m_keyword;
     std::vector<Opm::UDQToken> m_tokens;
     std::shared_ptr<UDQASTNode> ast;
+    std::shared_ptr<const UDQProgram> program;
     UDQVarType m_var_type;
     KeywordLocation m_location;
     std::size_t m_report_step;
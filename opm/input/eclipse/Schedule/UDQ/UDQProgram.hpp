@@ -0,0 +1,150 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef UDQPROGRAM_HPP
+#define UDQPROGRAM_HPP
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <opm/input/eclipse/Schedule/SummaryState.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQEnums.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQSet.hpp>
+
+namespace Opm {
+
+class UDQASTNode;
+class UDQContext;
+
+/*
+  The UDQProgram is a flattened version of the UDQASTNode tree of one UDQ
+  DEFINE expression. The tree is compiled once to a list of instructions in
+  postfix order, with the variable type of every summary vector, the kind of
+  well/group selection and the sign factor resolved up front. Evaluation is
+  then a single loop over the instructions with a value stack of UDQSet
+  instances, instead of a recursive walk which re-classifies every node for
+  every evaluation.
+
+  The result of UDQProgram::eval() is identical to UDQASTNode::eval() for the
+  same tree; the UDQASTNode implementation is retained as the reference.
+
+  The summary values are read through SummaryState handles. The handles of
+  every instruction are cached in the program together with the well or
+  group names they were registered for, and registered again when the names
+  change or the program is evaluated with a different SummaryState. The
+  evaluation is therefore not thread safe.
+*/
+
+/*
+  Scratch space for evaluating UDQ programs. The well and group lists of the
+  context and the name indices shared by all sets created for them are
+  assembled at most once, and the value stack and the well/group sets
+  consumed by the arithmetic operators are kept and reused. One workspace is
+  created by UDQConfig for all the DEFINE statements evaluated in one pass;
+  the well and group lists of the context must not change during its
+  lifetime.
+*/
+
+class UDQWorkspace {
+public:
+    explicit UDQWorkspace(UDQContext& context);
+
+    UDQContext& context();
+    const std::vector<std::string>& wells();
+    const std::vector<std::string>& groups();
+
+    UDQSet well_set(const std::string& name);
+    UDQSet group_set(const std::string& name);
+    void recycle(UDQSet&& set);
+
+private:
+    friend class UDQProgram;
+
+    UDQContext& m_context;
+    std::vector<std::string> m_wells;
+    std::vector<std::string> m_groups;
+    std::shared_ptr<const UDQSet::NameIndex> well_index;
+    std::shared_ptr<const UDQSet::NameIndex> group_index;
+
+    std::vector<UDQSet> stack;
+    std::vector<UDQSet> spare_well_sets;
+    std::vector<UDQSet> spare_group_sets;
+};
+
+
+class UDQProgram {
+public:
+    UDQProgram() = default;
+    explicit UDQProgram(const UDQASTNode& ast);
+
+    UDQSet eval(UDQVarType target_type, UDQContext& context) const;
+    UDQSet eval(UDQVarType target_type, UDQWorkspace& workspace) const;
+
+    std::size_t size() const;
+    std::size_t stack_depth() const;
+
+private:
+    enum class OpCode {
+        WellVar,
+        WellVarNamed,
+        WellVarPattern,
+        GroupVar,
+        GroupVarNamed,
+        GroupVarPattern,
+        FieldVar,
+        ContextVar,
+        Number,
+        ScalarFunc,
+        UnaryFunc,
+        BinaryFunc,
+        Arithmetic,
+        Invalid
+    };
+
+    struct Instruction {
+        OpCode op;
+        UDQVarType data_type = UDQVarType::NONE;
+        std::string name;
+        std::string selector;
+        double value = 0;
+        double sign = 1.0;
+        int token_type = 0;
+        std::size_t cache = 0;
+    };
+
+    struct HandleCache {
+        std::size_t owner = 0;
+        std::vector<std::string> names;
+        std::vector<SummaryState::Handle> handles;
+    };
+
+    void compile(const UDQASTNode& node, std::size_t depth);
+    SummaryState::Handle handle(const Instruction& instr, UDQContext& context) const;
+    const std::vector<SummaryState::Handle>& handles(const Instruction& instr, const std::vector<std::string>& names, UDQContext& context) const;
+
+    std::vector<Instruction> program;
+    std::size_t max_depth = 0;
+    mutable std::vector<HandleCache> handle_caches;
+};
+
+}
+
+#endif
@@ -20,6 +20,8 @@
 #ifndef UDQSET_HPP
 #define UDQSET_HPP
 
+#include <cstddef>
+#include <memory>
 #include <optional>
 #include <stdexcept>
 #include <string>
@@ -62,8 +64,18 @@ public:
 
 class UDQSet {
 public:
+    /*
+      Map from well/group name to position in the set. The index is built
+      once for a list of names and is immutable; it is shared between copies
+      of a set, and can be passed to the wells() and groups() factory
+      functions to share it between all sets created for the same name list.
+    */
+    using NameIndex = std::unordered_map<std::string, std::size_t>;
+    static std::shared_ptr<const NameIndex> make_index(const std::vector<std::string>& wgnames);
+
     UDQSet(const std::string& name, UDQVarType var_type);
     UDQSet(const std::string& name, UDQVarType var_type, const std::vector<std::string>& wgnames);
+    UDQSet(const std::string& name, UDQVarType var_type, const std::vector<std::string>& wgnames, std::shared_ptr<const NameIndex> index);
     UDQSet(const std::string& name, UDQVarType var_type, std::size_t size);
     UDQSet(const std::string& name, std::size_t size);
     static UDQSet scalar(const std::string& name, const std::optional<double>& scalar_value);
@@ -71,17 +83,30 @@ public:
     static UDQSet empty(const std::string& name);
     static UDQSet wells(const std::string& name, const std::vector<std::string>& wells);
     static UDQSet wells(const std::string& name, const std::vector<std::string>& wells, double scalar_value);
+    static UDQSet wells(const std::string& name, const std::vector<std::string>& wells, std::shared_ptr<const NameIndex> index);
     static UDQSet groups(const std::string& name, const std::vector<std::string>& groups);
     static UDQSet groups(const std::string& name, const std::vector<std::string>& groups, double scalar_value);
+    static UDQSet groups(const std::string& name, const std::vector<std::string>& groups, std::shared_ptr<const NameIndex> index);
     static UDQSet field(const std::string& name, double scalar_value);
 
     void assign(const std::optional<double>& value);
+    void assign(std::size_t index, const std::optional<double>& value);
     void assign(const std::string& wgname, const std::optional<double>& value);
 
     void assign(double value);
     void assign(std::size_t index, double value);
     void assign(const std::string& wgname, double value);
 
+    /*
+      The assign() overloads taking a name look the name up in the index;
+      only if the name is not a member of the set is it treated as a pattern
+      and passed on to assign_matching(), which assigns to all members
+      matching the shell style pattern.
+    */
+    void assign_matching(const std::string& pattern, const std::optional<double>& value);
+    void assign_matching(const std::string& pattern, double value);
+
+    std::optional<std::size_t> index(const std::string& wgname) const;
     bool has(const std::string& name) const;
     std::size_t size() const;
     void operator+=(const UDQSet& rhs);
@@ -111,6 +136,7 @@ private:
     std::string m_name;
     UDQVarType m_var_type = UDQVarType::NONE;
     std::vector<UDQScalar> values;
+    std::shared_ptr<const NameIndex> m_index;
 };
 
 
@@ -44,7 +44,7 @@ public:
 
 
     VFPInjTable();
-    VFPInjTable(const DeckKeyword& table, const UnitSystem& deck_unit_system);
+    VFPInjTable(const DeckKeyword& table, const UnitSystem& deck_unit_system, std::vector<std::string>* warnings = nullptr);
 
     static VFPInjTable serializationTestObject();
 
@@ -20,6 +20,7 @@
 #define WELL_ORDER_HPP
 
 #include <initializer_list>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -27,6 +28,30 @@
 
 namespace Opm {
 
+/*
+  The NamePatternIndex resolves shell patterns like 'PROD*' against a list of
+  names. The names are indexed in sorted order, so the candidates for a
+  pattern with a literal prefix are found with a binary search, and the
+  result for every pattern is memoized. The owner must call clear() when the
+  list of names changes; a copy starts out with an empty index. The index is
+  protected by a mutex, so match() can be called from several threads.
+*/
+
+class NamePatternIndex {
+public:
+    NamePatternIndex() = default;
+    NamePatternIndex(const NamePatternIndex&);
+    NamePatternIndex& operator=(const NamePatternIndex&);
+
+    std::vector<std::string> match(const std::string& pattern, const std::vector<std::string>& names) const;
+    void clear();
+
+private:
+    mutable std::mutex m_mutex;
+    mutable std::vector<std::size_t> m_sorted;
+    mutable std::unordered_map<std::string, std::vector<std::string>> m_results;
+};
+
 /*
   The purpose of this small class is to ensure that well and group name always
   come in the order they are defined in the deck.
@@ -46,10 +71,15 @@ public:
     bool has(const std::string& wname) const;
     std::size_t size() const;
 
+    // The names matching the shell pattern, in the order of definition.
+    std::vector<std::string> match(const std::string& pattern) const;
+
     template<class Serializer>
     void serializeOp(Serializer& serializer) {
         serializer(m_index_map);
         serializer(m_name_list);
+        if (!serializer.isSerializing())
+            m_pattern_index.clear();
     }
 
     static NameOrder serializationTestObject();
@@ -62,6 +92,7 @@ public:
 private:
     Map m_index_map;
     std::vector<std::string> m_name_list;
+    NamePatternIndex m_pattern_index;
 };
 
 
@@ -74,10 +105,15 @@ public:
     bool has(const std::string& wname) const;
     std::vector<std::optional<std::string>> restart_groups() const;
 
+    // The names matching the shell pattern, in the order of definition.
+    std::vector<std::string> match(const std::string& pattern) const;
+
     template<class Serializer>
     void serializeOp(Serializer& serializer) {
         serializer(m_name_list);
         serializer(m_max_groups);
+        if (!serializer.isSerializing())
+            m_pattern_index.clear();
     }
     static GroupOrder serializationTestObject();
 
@@ -88,6 +124,7 @@ public:
 private:
     std::vector<std::string> m_name_list;
     std::size_t m_max_groups;
+    NamePatternIndex m_pattern_index;
 
 };
 
@@ -21,6 +21,8 @@
 
 #include <cstddef>
 #include <map>
+#include <mutex>
+#include <unordered_map>
 #include <vector>
 #include <string>
 #include <opm/input/eclipse/Schedule/Well/WList.hpp>
@@ -58,12 +60,35 @@ public:
         serializer(wlists);
         serializer(well_wlist_names);
         serializer(no_wlists_well);
+        if (!serializer.isSerializing())
+            wells_cache.clear();
     }
 
 private:
     std::map<std::string, WList> wlists;
     std::map<std::string, std::vector<std::string>> well_wlist_names;
     std::map<std::string, std::size_t> no_wlists_well;
+
+    /*
+      The results of wells() for the patterns queried so far. The cache is
+      cleared by all the member functions which can modify a well list, and a
+      copy starts out with an empty cache.
+    */
+    struct WellsCache {
+        WellsCache() = default;
+        WellsCache(const WellsCache&) {}
+        WellsCache& operator=(const WellsCache&) { this->clear(); return *this; }
+
+        void clear() {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            this->wells.clear();
+        }
+
+        std::mutex mutex;
+        std::unordered_map<std::string, std::vector<std::string>> wells;
+    };
+
+    mutable WellsCache wells_cache;
 };
 
 }
@@ -20,6 +20,7 @@
 #define WELL_MATCHER_HPP
 
 #include <initializer_list>
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -29,6 +30,13 @@
 
 namespace Opm {
 
+/*
+  The WellMatcher resolves well names, well name patterns and WLIST names to
+  the matching wells in the order of definition. The NameOrder and
+  WListManager instances can be shared with a ScheduleState, in which case
+  the pattern results memoized in those objects are reused.
+*/
+
 class WellMatcher {
 public:
     WellMatcher() = default;
@@ -36,13 +44,14 @@ public:
     explicit WellMatcher(std::initializer_list<std::string> wells);
     explicit WellMatcher(const std::vector<std::string>& wells);
     WellMatcher(const NameOrder& well_order, const WListManager& wlm);
+    WellMatcher(std::shared_ptr<const NameOrder> well_order, std::shared_ptr<const WListManager> wlm);
     std::vector<std::string> sort(std::vector<std::string> wells) const;
     std::vector<std::string> wells(const std::string& pattern) const;
     const std::vector<std::string>& wells() const;
 
 private:
-    NameOrder m_well_order;
-    WListManager m_wlm;
+    std::shared_ptr<const NameOrder> m_well_order = std::make_shared<const NameOrder>();
+    std::shared_ptr<const WListManager> m_wlm = std::make_shared<const WListManager>();
 };
 
 }
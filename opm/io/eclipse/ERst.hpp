@@ -64,6 +64,24 @@ public:
     template <typename T>
     const std::vector<T>& getRestartData(const std::string& name, int reportStepNumber, const std::string& lgr_name);
 
+    // Elements 'indices' - e.g., a sorted list of active cells - of a
+    // restart array, read without loading the complete array.
+    template <typename T>
+    std::vector<T> getRestartDataSubset(const std::string& name, int reportStepNumber,
+                                        const std::vector<std::size_t>& indices, int occurrence = 0)
+    {
+        return this->getSubset<T>(this->getArrayIndex(name, reportStepNumber, occurrence), indices);
+    }
+
+    // Elements [first, first + count) of a restart array, read without
+    // loading the complete array.
+    template <typename T>
+    std::vector<T> getRestartDataRange(const std::string& name, int reportStepNumber,
+                                       std::size_t first, std::size_t count, int occurrence = 0)
+    {
+        return this->getRange<T>(this->getArrayIndex(name, reportStepNumber, occurrence), first, count);
+    }
+
     template <typename T>
     const std::vector<T>& getRestartData(int index, int reportStepNumber, const std::string& lgr_name);
 
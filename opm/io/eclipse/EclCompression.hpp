@@ -0,0 +1,104 @@
+/*
+   Copyright 2026 Equinor ASA.
+
+   This file is part of the Open Porous Media project (OPM).
+
+   OPM is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   OPM is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+   */
+
+#ifndef OPM_IO_ECLCOMPRESSION_HPP
+#define OPM_IO_ECLCOMPRESSION_HPP
+
+#include <opm/io/eclipse/EclIOdata.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+namespace Opm { namespace EclIO { namespace Compression {
+
+/*
+  OPM extension of the binary ECLIPSE file format.  A compressed file starts
+  with 'magic'.  Each array is written with the usual header, followed - for
+  arrays with at least one element - by its usual Fortran record stream split
+  into chunks of 'chunkSize' bytes.  The chunks are byte-shuffled and LZ
+  compressed independently and each is stored as:
+
+    uint32   stored size of the chunk (big-endian), high bit set if stored
+             uncompressed
+    ...      chunk data
+
+  The number of chunks follows from the size of the record stream, which is
+  known from the array header.  A chunk is written as soon as it is complete,
+  so the writer holds at most one chunk and needs neither a seekable nor a
+  non-appending output stream.
+*/
+
+constexpr std::array<char, 8> magic = {'O', 'P', 'M', 'L', 'Z', 'C', '0', '1'};
+constexpr std::size_t chunkSize = 1 << 20;
+
+// Byte-shuffle stride for arrays of type 'type', 1 if not shuffled.
+int shuffleStride(eclArrType type);
+
+// Byte-shuffle followed by LZ compression of 'size' bytes.  The result may be
+// larger than the input.
+std::vector<char> compress(const char* data, std::size_t size, int stride);
+
+// Inverse of compress(), 'rawSize' being the size of the original data.
+// Throws std::runtime_error if 'data' is not valid compressed data.
+void decompress(const char* data, std::size_t size, char* raw, std::size_t rawSize, int stride);
+
+// Check for, and skip, 'magic' at the current position of 'is'.  Leaves the
+// position unchanged if not found.
+bool readMagic(std::istream& is);
+
+// Skip payload, of an array whose record stream is 'rawSize' bytes, at the
+// current position of 'is'.
+void skipPayload(std::istream& is, std::size_t rawSize);
+
+// Read payload at the current position of 'is', returning the original
+// record stream of 'rawSize' bytes.
+std::vector<char> readPayload(std::istream& is, std::size_t rawSize, int stride);
+
+// Stream buffer collecting the record stream of one array, compressing and
+// writing each chunk as soon as it is complete.  Holds one uncompressed chunk.
+class ChunkWriter : public std::streambuf
+{
+public:
+    ChunkWriter();
+
+    // Start payload of array of type 'type', written to 'os'.
+    void begin(eclArrType type, std::ostream& os);
+
+    // Write the last, possibly partial, chunk of the current array.
+    void finish();
+
+protected:
+    int_type overflow(int_type ch) override;
+
+private:
+    std::vector<char> raw_;
+    std::ostream* os_ = nullptr;
+    int stride_ = 1;
+
+    void compressChunk();
+};
+
+}}} // namespace Opm::EclIO::Compression
+
+#endif // OPM_IO_ECLCOMPRESSION_HPP
@@ -19,8 +19,10 @@
 #ifndef OPM_IO_ECLFILE_HPP
 #define OPM_IO_ECLFILE_HPP
 
+#include <opm/io/eclipse/EclFileIndex.hpp>
 #include <opm/io/eclipse/EclIOdata.hpp>
 
+#include <cstddef>
 #include <ios>
 #include <map>
 #include <string>
@@ -42,6 +44,9 @@ public:
     EclFile(const std::string& filename, Formatted fmt, bool preload = false);
     bool formattedInput() const { return formatted; }
 
+    // Whether the binary file uses the compressed format of EclCompression.hpp.
+    bool compressedInput() const { return compressed; }
+
     void loadData();                            // load all data
     void loadData(const std::string& arrName);         // load all arrays with array name equal to arrName
     void loadData(int arrIndex);                // load data based on array indices in vector arrIndex
@@ -67,15 +72,39 @@ public:
     template <typename T>
     const std::vector<T>& get(const std::string& name);
 
+    // Elements 'indices' - sorted in increasing order - of array arrIndex.
+    // For uncompressed binary files the elements are read directly from
+    // their position in the file, without loading or caching the complete
+    // array.  Supports INTE, REAL and DOUB arrays, i.e., T = int, float or
+    // double.
+    template <typename T>
+    std::vector<T> getSubset(int arrIndex, const std::vector<std::size_t>& indices);
+
+    // Elements [first, first + count) of array arrIndex or of the array
+    // 'name'.  For uncompressed binary files the range is read with a
+    // single positional read, without loading or caching the complete
+    // array, so large arrays can be processed block by block.  Supports
+    // INTE, REAL and DOUB arrays.
+    template <typename T>
+    std::vector<T> getRange(int arrIndex, std::size_t first, std::size_t count);
+
+    template <typename T>
+    std::vector<T> getRange(const std::string& name, std::size_t first, std::size_t count);
+
     bool hasKey(const std::string &name) const;
     std::size_t count(const std::string& name) const;
 
     const std::vector<std::string>& arrayNames() const { return array_name; }
+
+    // Directory of all arrays in binary file, e.g., for creating the sidecar
+    // index of an existing file.  Includes values of all SEQNUM arrays.
+    EclFileIndex directory();
     std::size_t size() const;
     bool is_ix() const;
 
 protected:
     bool formatted;
+    bool compressed = false;
     std::string inputFilename;
 
     std::unordered_map<int, std::vector<int>> inte_array;
@@ -91,6 +120,10 @@ protected:
 
     std::vector<uint64_t> ifStreamPos;
 
+    // Array directory read from sidecar index rather than from scanning the
+    // file.  SEQNUM arrays are then already loaded.
+    bool fromIndex = false;
+
     std::map<std::string, int> array_index;
 
     template<class T>
@@ -105,8 +138,17 @@ private:
     std::vector<bool> arrayLoaded;
 
     void loadBinaryArray(std::fstream& fileH, std::size_t arrIndex);
+    void readBinaryArrayData(std::istream& fileH, std::size_t arrIndex);
+    std::vector<char> readCompressedArray(std::istream& fileH, std::size_t arrIndex) const;
+
+    template <typename T>
+    std::vector<T> readBinarySubset(std::size_t arrIndex, const std::vector<std::size_t>& indices) const;
+
+    template <typename T>
+    std::vector<T> readBinaryRange(std::size_t arrIndex, std::size_t first, std::size_t count) const;
     void loadFormattedArray(const std::string& fileStr, std::size_t arrIndex, int64_t fromPos);
     void load(bool preload);
+    bool loadIndex();
 
     std::vector<unsigned int> get_bin_logi_raw_values(int arrIndex) const;
     std::vector<std::string> get_fmt_real_raw_str_values(int arrIndex) const;
@@ -0,0 +1,78 @@
+/*
+   Copyright 2026 Equinor ASA.
+
+   This file is part of the Open Porous Media project (OPM).
+
+   OPM is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   OPM is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+   */
+
+#ifndef OPM_IO_ECLFILEINDEX_HPP
+#define OPM_IO_ECLFILEINDEX_HPP
+
+#include <opm/io/eclipse/EclIOdata.hpp>
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace Opm { namespace EclIO {
+
+// Directory of the arrays in a binary ECLIPSE-style result file, stored in
+// a sidecar file next to it ("CASE.UNRST" -> "CASE.UNRST.IDX").  Written by
+// OutputStream::Restart for unified restart files and used by EclFile (and
+// hence ERst and RestartFileView) to open the file without reading every
+// array header.  An index which does not match the current size of its
+// result file, or which is older than the file, is ignored.
+
+class EclFileIndex
+{
+public:
+    struct Entry {
+        std::string name;
+        eclArrType type;
+        int64_t size;
+        int element_size;
+        uint64_t header;     // file position of array header
+        uint64_t data;       // file position of array data, i.e., after header
+        int seqnum = 0;      // value of SEQNUM arrays, zero otherwise
+    };
+
+    static std::string fileName(const std::string& filename);
+
+    // Index of 'filename', if a valid one exists.
+    static std::optional<EclFileIndex> load(const std::string& filename);
+
+    // Write index for 'filename'. The result file must be complete and
+    // flushed, since its current size is recorded in the index.
+    void save(const std::string& filename);
+
+    // Remove index of 'filename', if any.
+    static void remove(const std::string& filename);
+
+    const std::vector<Entry>& entries() const { return entries_; }
+    uint64_t fileSize() const { return file_size_; }
+
+    void append(const Entry& entry) { entries_.push_back(entry); }
+
+    // Drop all entries whose header starts at or after 'position'.
+    void truncate(uint64_t position);
+
+private:
+    std::vector<Entry> entries_;
+    uint64_t file_size_ = 0;
+};
+
+}} // namespace Opm::EclIO
+
+#endif // OPM_IO_ECLFILEINDEX_HPP
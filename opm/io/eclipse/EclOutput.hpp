@@ -18,12 +18,19 @@
 #ifndef OPM_IO_ECLOUTPUT_HPP
 #define OPM_IO_ECLOUTPUT_HPP
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <fstream>
 #include <ios>
+#include <memory>
+#include <optional>
+#include <ostream>
 #include <string>
 #include <typeinfo>
 #include <vector>
 
+#include <opm/io/eclipse/EclFileIndex.hpp>
 #include <opm/io/eclipse/EclIOdata.hpp>
 #include <opm/io/eclipse/PaddedOutputString.hpp>
 
@@ -32,6 +39,10 @@ namespace Opm { namespace EclIO { namespace OutputStream {
     class SummarySpecification;
 }}}
 
+namespace Opm { namespace EclIO { namespace Compression {
+    class ChunkWriter;
+}}}
+
 namespace Opm { namespace EclIO {
 
 class EclOutput
@@ -39,7 +50,10 @@ class EclOutput
 public:
     EclOutput(const std::string&            filename,
               const bool                    formatted,
-              const std::ios_base::openmode mode = std::ios::out);
+              const std::ios_base::openmode mode = std::ios::out,
+              const bool                    compressed = false);
+
+    ~EclOutput();
 
     template<typename T>
     void write(const std::string& name,
@@ -79,6 +93,51 @@ public:
 
     void write(const std::string& name, const std::vector<std::string>& data, int element_size);
 
+    // Chunked output of a single INTE, REAL or DOUB array whose total size
+    // is known up front. beginArray() writes the array header, appendChunk()
+    // is then called with consecutive parts of the array, and endArray()
+    // checks that exactly 'size' elements were written.  Record blocks are
+    // split internally, so the output is identical to write() of the full
+    // array, but the caller never needs to hold more than one chunk.
+
+    template <typename T>
+    void beginArray(const std::string& name, int64_t size);
+
+    template <typename T>
+    void appendChunk(const T* data, std::size_t count);
+
+    template <typename T>
+    void appendChunk(const std::vector<T>& data)
+    {
+        this->appendChunk(data.data(), data.size());
+    }
+
+    void endArray();
+
+    // Write array of 'size' elements where element i is generator(i),
+    // converting and writing 'chunk_size' elements at a time.
+    template <typename T, typename Generator>
+    void writeGenerated(const std::string& name, int64_t size, Generator&& generator,
+                        std::size_t chunk_size = 65536)
+    {
+        std::vector<T> chunk;
+        chunk.reserve(std::min(static_cast<std::size_t>(size), chunk_size));
+
+        this->beginArray<T>(name, size);
+        for (int64_t i = 0; i < size; i++) {
+            chunk.push_back(generator(i));
+            if (chunk.size() == chunk_size) {
+                this->appendChunk(chunk);
+                chunk.clear();
+            }
+        }
+
+        if (!chunk.empty())
+            this->appendChunk(chunk);
+
+        this->endArray();
+    }
+
     void message(const std::string& msg);
     void flushStream();
 
@@ -110,8 +169,39 @@ private:
     std::string make_doub_string_ecl(double value) const;
     std::string make_doub_string_ix(double value) const;
 
+    template <typename T>
+    void writeFormattedValue(const T& value, int columnWidth);
+
+    template <typename T>
+    void appendBinaryChunk(const T* data, std::size_t count);
+
+    template <typename T>
+    void appendFormattedChunk(const T* data, std::size_t count);
+
+    // Stream receiving the record blocks of binary arrays.  In compressed
+    // mode each chunk is written to ofileH as soon as it is complete, and
+    // the last chunk of the current array in finishArray().
+    std::ostream& dataStream() { return compressor ? compressed_data : ofileH; }
+    void finishArray();
+
+    struct ChunkedArray {
+        eclArrType arrType;
+        int64_t size;
+        int64_t written;
+        int64_t record_size;
+    };
+
     bool isFormatted, ix_standard;
     std::ofstream ofileH;
+    std::optional<ChunkedArray> chunked_array;
+
+    // Set for binary output in the compressed format of EclCompression.hpp.
+    std::unique_ptr<Compression::ChunkWriter> compressor;
+    std::ostream compressed_data{nullptr};
+
+    // Directory of binary arrays written so far, when requested by the
+    // owner (OutputStream::Restart) for maintaining an EclFileIndex.
+    std::optional<std::vector<EclFileIndex::Entry>> written_arrays;
 };
 
 
@@ -66,16 +66,16 @@ namespace Opm { namespace EclIO {
                       int64_t &num, Opm::EclIO::eclArrType &arrType, int& elementSize);
 
     template<typename T, typename T2>
-    std::vector<T> readBinaryArray(std::fstream& fileH, const int64_t size, Opm::EclIO::eclArrType type,
+    std::vector<T> readBinaryArray(std::istream& fileH, const int64_t size, Opm::EclIO::eclArrType type,
                                std::function<T(T2)>& flip, int elementSize);
 
-    std::vector<int> readBinaryInteArray(std::fstream &fileH, const int64_t size);
-    std::vector<float> readBinaryRealArray(std::fstream& fileH, const int64_t size);
-    std::vector<double> readBinaryDoubArray(std::fstream& fileH, const int64_t size);
-    std::vector<bool> readBinaryLogiArray(std::fstream &fileH, const int64_t size);
-    std::vector<unsigned int> readBinaryRawLogiArray(std::fstream &fileH, const int64_t size);
-    std::vector<std::string> readBinaryCharArray(std::fstream& fileH, const int64_t size);
-    std::vector<std::string> readBinaryC0nnArray(std::fstream& fileH, const int64_t size, int elementSize);
+    std::vector<int> readBinaryInteArray(std::istream& fileH, const int64_t size);
+    std::vector<float> readBinaryRealArray(std::istream& fileH, const int64_t size);
+    std::vector<double> readBinaryDoubArray(std::istream& fileH, const int64_t size);
+    std::vector<bool> readBinaryLogiArray(std::istream& fileH, const int64_t size);
+    std::vector<unsigned int> readBinaryRawLogiArray(std::istream& fileH, const int64_t size);
+    std::vector<std::string> readBinaryCharArray(std::istream& fileH, const int64_t size);
+    std::vector<std::string> readBinaryC0nnArray(std::istream& fileH, const int64_t size, int elementSize);
 
     template<typename T>
     std::vector<T> readFormattedArray(const std::string& file_str, const int size, int64_t fromPos,
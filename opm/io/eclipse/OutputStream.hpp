@@ -20,14 +20,20 @@
 #ifndef OPM_IO_OUTPUTSTREAM_HPP_INCLUDED
 #define OPM_IO_OUTPUTSTREAM_HPP_INCLUDED
 
+#include <opm/io/eclipse/EclFileIndex.hpp>
+#include <opm/io/eclipse/EclOutput.hpp>
 #include <opm/io/eclipse/PaddedOutputString.hpp>
 #include <opm/common/utility/TimeService.hpp>
 
 #include <array>
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <ios>
 #include <memory>
+#include <optional>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace Opm { namespace EclIO {
@@ -40,6 +46,7 @@ namespace Opm { namespace EclIO { namespace OutputStream {
 
     struct Formatted { bool set; };
     struct Unified   { bool set; };
+    struct Compressed { bool set; };
 
     /// Abstract representation of an ECLIPSE-style result set.
     struct ResultSet
@@ -62,8 +69,12 @@ namespace Opm { namespace EclIO { namespace OutputStream {
         /// \param[in] rset Output directory and base name of output stream.
         ///
         /// \param[in] fmt Whether or not to create formatted output files.
-        explicit Init(const ResultSet& rset,
-                      const Formatted& fmt);
+        ///
+        /// \param[in] comp Whether or not to create compressed binary
+        ///    output files.  See EclCompression.hpp.
+        explicit Init(const ResultSet&  rset,
+                      const Formatted&  fmt,
+                      const Compressed& comp = Compressed{false});
 
         ~Init();
 
@@ -107,6 +118,28 @@ namespace Opm { namespace EclIO { namespace OutputStream {
         void write(const std::string&         kw,
                    const std::vector<double>& data);
 
+        /// Write vector of \p size elements, element \c i being \code
+        /// generator(i) \endcode, to underlying output stream.
+        ///
+        /// Use in place of \c write() to avoid materialising large
+        /// vectors in full.  Forwards to \c EclOutput::writeGenerated().
+        ///
+        /// \param[in] kw Name of output vector (keyword).
+        ///
+        /// \param[in] size Total number of elements in output vector.
+        ///
+        /// \param[in] generator Element values.  Called once for each
+        ///    index, in increasing order.
+        template <typename T, typename Generator>
+        void writeGenerated(const std::string& kw,
+                            const std::size_t  size,
+                            Generator&&        generator)
+        {
+            this->stream().template writeGenerated<T>
+                (kw, static_cast<std::int64_t>(size),
+                 std::forward<Generator>(generator));
+        }
+
     private:
         /// Init file output stream.
         std::unique_ptr<EclOutput> stream_;
@@ -119,8 +152,12 @@ namespace Opm { namespace EclIO { namespace OutputStream {
         ///
         /// \param[in] formatted Whether or not to create a
         ///    formatted output file.
+        ///
+        /// \param[in] compressed Whether or not to create a
+        ///    compressed binary output file.
         void open(const std::string& fname,
-                  const bool         formatted);
+                  const bool         formatted,
+                  const bool         compressed);
 
         /// Access writable output stream.
         EclOutput& stream();
@@ -152,10 +189,15 @@ namespace Opm { namespace EclIO { namespace OutputStream {
         /// \param[in] fmt Whether or not to create formatted output files.
         ///
         /// \param[in] unif Whether or not to create unified output files.
-        explicit Restart(const ResultSet& rset,
-                         const int        seqnum,
-                         const Formatted& fmt,
-                         const Unified&   unif);
+        ///
+        /// \param[in] comp Whether or not to create compressed binary
+        ///    output files.  An existing unified restart file must use
+        ///    the same format.
+        explicit Restart(const ResultSet&  rset,
+                         const int         seqnum,
+                         const Formatted&  fmt,
+                         const Unified&    unif,
+                         const Compressed& comp = Compressed{false});
 
         ~Restart();
 
@@ -222,10 +264,54 @@ namespace Opm { namespace EclIO { namespace OutputStream {
         void write(const std::string&                        kw,
                    const std::vector<PaddedOutputString<8>>& data);
 
+        /// Write vector of \p size elements, element \c i being \code
+        /// generator(i) \endcode, to underlying output stream.
+        ///
+        /// Converts and narrows on the fly, e.g., from SI to output units
+        /// and from double to single precision, without a full copy of
+        /// the source array.  Forwards to \c EclOutput::writeGenerated().
+        ///
+        /// \param[in] kw Name of output vector (keyword).
+        ///
+        /// \param[in] size Total number of elements in output vector.
+        ///
+        /// \param[in] generator Element values.  Called once for each
+        ///    index, in increasing order.
+        template <typename T, typename Generator>
+        void writeGenerated(const std::string& kw,
+                            const std::size_t  size,
+                            Generator&&        generator)
+        {
+            this->stream().template writeGenerated<T>
+                (kw, static_cast<std::int64_t>(size),
+                 std::forward<Generator>(generator));
+        }
+
     private:
         /// Restart output stream.
         std::unique_ptr<EclOutput> stream_;
 
+        /// Name of unified restart file.
+        std::string fname_{};
+
+        /// Array directory of binary unified restart file preceding this
+        /// report step.  Completed with the arrays written through \c
+        /// stream_ and saved as sidecar index when the stream is closed.
+        std::optional<EclFileIndex> index_{};
+
+        /// Begin maintaining sidecar index of binary unified restart file.
+        ///
+        /// \param[in] fname Filename of output stream.
+        ///
+        /// \param[in] index Array directory of existing file contents
+        ///    before current write position.
+        void startIndex(const std::string& fname, EclFileIndex&& index);
+
+        /// Save sidecar index of binary unified restart file, including
+        /// all arrays written through \c stream_.  Removes any existing
+        /// index if it cannot be written.
+        void saveIndex();
+
         /// Open unified output file and place stream's output indicator
         /// in appropriate location.
         ///
@@ -236,10 +322,14 @@ namespace Opm { namespace EclIO { namespace OutputStream {
         /// \param[in] formatted Whether or not to create a
         ///    formatted output file.
         ///
+        /// \param[in] compressed Whether or not to create a
+        ///    compressed binary output file.
+        ///
         /// \param[in] seqnum Sequence number of new report.  One-based
         ///    report step ID.
         void openUnified(const std::string& fname,
                          const bool         formatted,
+                         const bool         compressed,
                          const int          seqnum);
 
         /// Open new output stream.
@@ -251,8 +341,12 @@ namespace Opm { namespace EclIO { namespace OutputStream {
         ///
         /// \param[in] formatted Whether or not to create a
         ///    formatted output file.
+        ///
+        /// \param[in] compressed Whether or not to create a
+        ///    compressed binary output file.
         void openNew(const std::string& fname,
-                     const bool         formatted);
+                     const bool         formatted,
+                     const bool         compressed);
 
         /// Open existing output file and place stream's output indicator
         /// in appropriate location.
@@ -266,6 +360,7 @@ namespace Opm { namespace EclIO { namespace OutputStream {
         ///    place output indicator at end of file (i.e, simple append).
         void openExisting(const std::string&   fname,
                           const bool           formatted,
+                          const bool           compressed,
                           const std::streampos writePos);
 
         /// Access writable output stream.
@@ -56,6 +56,12 @@ public:
     const std::vector<ElmType>&
     getKeyword(const std::string& vector, const int occurrence = 0) const;
 
+    template <typename ElmType>
+    std::vector<ElmType>
+    getKeywordSubset(const std::string&              vector,
+                     const std::vector<std::size_t>& indices,
+                     const int                       occurrence = 0) const;
+
     const std::vector<int>& intehead() const;
     const std::vector<bool>& logihead() const;
     const std::vector<double>& doubhead() const;
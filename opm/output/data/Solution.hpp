@@ -40,6 +40,12 @@ class Solution : public std::map< std::string, data::CellData > {
 
         bool has( const std::string& ) const;
 
+        /*
+         * Whether the data fields are in SI units, i.e., whether
+         * convertFromSI() would convert them.
+         */
+        bool isSI() const;
+
         /*
          * Get the data field of the struct matching the requested key. Will
          * throw std::out_of_range if they key does not exist.
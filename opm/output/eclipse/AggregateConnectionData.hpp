@@ -44,6 +44,10 @@ namespace Opm { namespace RestartIO { namespace Helpers {
     public:
         explicit AggregateConnectionData(const std::vector<int>& inteHead);
 
+        /// Reinitialise all arrays for the dimensions of 'inteHead', as
+        /// if newly constructed, reusing the existing storage.
+        void reset(const std::vector<int>& inteHead);
+
         void captureDeclaredConnData(const Opm::Schedule&        sched,
                                      const Opm::EclipseGrid&     grid,
                                      const Opm::UnitSystem&      units,
@@ -43,6 +43,10 @@ class AggregateGroupData
 public:
     explicit AggregateGroupData(const std::vector<int>& inteHead);
 
+    /// Reinitialise all arrays for the dimensions of 'inteHead', as
+    /// if newly constructed, reusing the existing storage.
+    void reset(const std::vector<int>& inteHead);
+
     void captureDeclaredGroupData(const Opm::Schedule&        sched,
                          const Opm::UnitSystem&               units,
                          const std::size_t                    simStep,
@@ -61,6 +61,10 @@ namespace Opm { namespace RestartIO { namespace Helpers {
     public:
         explicit AggregateMSWData(const std::vector<int>& inteHead);
 
+        /// Reinitialise all arrays for the dimensions of 'inteHead', as
+        /// if newly constructed, reusing the existing storage.
+        void reset(const std::vector<int>& inteHead);
+
         void captureDeclaredMSWData(const Opm::Schedule& sched,
                                      const std::size_t    rptStep,
 				     const Opm::UnitSystem& units,
@@ -47,6 +47,10 @@ class AggregateUDQData
 public:
     explicit AggregateUDQData(const std::vector<int>& udqDims);
 
+    /// Reinitialise all arrays for the dimensions of 'udqDims', as
+    /// if newly constructed, reusing the existing storage.
+    void reset(const std::vector<int>& udqDims);
+
 void captureDeclaredUDQData(const Opm::Schedule&                 sched,
                        const std::size_t                    simStep,
                        const Opm::UDQState&                 udqState,
@@ -51,6 +51,10 @@ namespace Opm { namespace RestartIO { namespace Helpers {
     public:
         explicit AggregateWellData(const std::vector<int>& inteHead);
 
+        /// Reinitialise all arrays for the dimensions of 'inteHead', as
+        /// if newly constructed, reusing the existing storage.
+        void reset(const std::vector<int>& inteHead);
+
         void captureDeclaredWellData(const Schedule&   	       sched,
                                      const TracerConfig&       tracer,
                                      const std::size_t 		     sim_step,
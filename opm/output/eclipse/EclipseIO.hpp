@@ -34,6 +34,7 @@
 #include <opm/output/data/Solution.hpp>
 #include <opm/output/data/Wells.hpp>
 #include <opm/output/eclipse/RestartValue.hpp>
+#include <opm/output/eclipse/ResultsBus.hpp>
 
 namespace Opm { namespace out {
     class Summary;
@@ -231,6 +232,17 @@ public:
     RestartValue loadRestart(Action::State& action_state, SummaryState& summary_state, const std::vector<RestartKey>& solution_keys, const std::vector<RestartKey>& extra_keys = {}) const;
     const out::Summary& summary();
 
+    /*
+      In-process channel for the results of each report step. At the
+      end of every call to writeTimeStep() which is not a substep, and
+      only if the bus has subscribers, a snapshot is published. It
+      contains the summary state, the well, group and network results
+      and the solution arrays requested by the subscribers. This also
+      happens at steps with no file output, but not if output is
+      disabled altogether.
+    */
+    ResultsBus& resultsBus();
+
     EclipseIO( const EclipseIO& ) = delete;
     ~EclipseIO();
 
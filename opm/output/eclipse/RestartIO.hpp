@@ -27,7 +27,9 @@
 #include <opm/output/eclipse/RestartValue.hpp>
 
 #include <opm/output/eclipse/AggregateAquiferData.hpp>
+#include <opm/output/eclipse/RestartOutputContext.hpp>
 
+#include <cstddef>
 #include <optional>
 #include <string>
 #include <utility>
@@ -82,7 +84,7 @@ namespace Opm { namespace RestartIO {
     void save(EclIO::OutputStream::Restart&                 rstFile,
               int                                           report_step,
               double                                        seconds_elapsed,
-              RestartValue                                  value,
+              const RestartValue&                           value,
               const EclipseState&                           es,
               const EclipseGrid&                            grid,
               const Schedule&                               schedule,
@@ -93,6 +95,26 @@ namespace Opm { namespace RestartIO {
               std::optional<Helpers::AggregateAquiferData>& aquiferData,
               bool                                          write_double = false);
 
+    /*
+      As above, but aggregating the well, connection, group, segment and
+      UDQ arrays into the buffers of 'context', which the caller keeps
+      from one report step to the next.
+    */
+    void save(EclIO::OutputStream::Restart&                 rstFile,
+              int                                           report_step,
+              double                                        seconds_elapsed,
+              const RestartValue&                           value,
+              const EclipseState&                           es,
+              const EclipseGrid&                            grid,
+              const Schedule&                               schedule,
+              const Action::State&                          action_state,
+              const WellTestState&                          wtest_state,
+              const SummaryState&                           sumState,
+              const UDQState&                               udqState,
+              std::optional<Helpers::AggregateAquiferData>& aquiferData,
+              OutputContext&                                context,
+              bool                                          write_double = false);
+
 
     RestartValue load(const std::string&             filename,
                       int                            report_step,
@@ -104,6 +126,30 @@ namespace Opm { namespace RestartIO {
                       const Schedule&                schedule,
                       const std::vector<RestartKey>& extra_keys = {});
 
+    /*
+      Partial restart: The solution vectors are only loaded for the cells in
+      'cells', which must be sorted in increasing order. The cells are given
+      either as active indices, or as global (Cartesian) indices of active
+      cells. The solution vectors in the returned RestartValue have one
+      element per entry in 'cells', in the same order; the well, group,
+      network and aquifer data are loaded in full. For binary restart files
+      only the parts of the solution arrays holding the requested cells are
+      read from the file.
+    */
+    enum class CellIndex { Active, Global };
+
+    RestartValue load(const std::string&              filename,
+                      int                             report_step,
+                      Action::State&                  action_state,
+                      SummaryState&                   summary_state,
+                      const std::vector<RestartKey>&  solution_keys,
+                      const EclipseState&             es,
+                      const EclipseGrid&              grid,
+                      const Schedule&                 schedule,
+                      const std::vector<std::size_t>& cells,
+                      CellIndex                       index_type,
+                      const std::vector<RestartKey>&  extra_keys = {});
+
 }} // namespace Opm::RestartIO
 
 #endif  // RESTART_IO_HPP
@@ -0,0 +1,50 @@
+/*
+  Copyright (c) 2026 Equinor ASA
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef RESTART_OUTPUT_CONTEXT_HPP
+#define RESTART_OUTPUT_CONTEXT_HPP
+
+#include <opm/output/eclipse/AggregateConnectionData.hpp>
+#include <opm/output/eclipse/AggregateGroupData.hpp>
+#include <opm/output/eclipse/AggregateMSWData.hpp>
+#include <opm/output/eclipse/AggregateUDQData.hpp>
+#include <opm/output/eclipse/AggregateWellData.hpp>
+
+#include <optional>
+
+namespace Opm { namespace RestartIO {
+
+    /// Restart array aggregators kept across report steps.
+    ///
+    /// Owned by the caller of save() for as long as restart files are
+    /// written.  The well, connection, group, segment and UDQ arrays are
+    /// created at the first report step which needs them and are reset in
+    /// place at later steps, so their storage is only reallocated when the
+    /// model dimensions grow.
+    struct OutputContext
+    {
+        std::optional<Helpers::AggregateWellData>       wellData{};
+        std::optional<Helpers::AggregateConnectionData> connectionData{};
+        std::optional<Helpers::AggregateGroupData>      groupData{};
+        std::optional<Helpers::AggregateMSWData>        mswData{};
+        std::optional<Helpers::AggregateUDQData>        udqData{};
+    };
+
+}} // Opm::RestartIO
+
+#endif // RESTART_OUTPUT_CONTEXT_HPP
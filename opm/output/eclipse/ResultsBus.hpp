@@ -0,0 +1,115 @@
+/*
+  Copyright (c) 2026 Equinor ASA
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef OPM_RESULTS_BUS_HPP
+#define OPM_RESULTS_BUS_HPP
+
+#include <opm/input/eclipse/Schedule/SummaryState.hpp>
+
+#include <opm/output/data/Groups.hpp>
+#include <opm/output/data/Solution.hpp>
+#include <opm/output/data/Wells.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+
+namespace Opm {
+
+    /// Results of a single report step as published on a ResultsBus.
+    ///
+    /// Solution arrays are in the units passed by the publisher, normally
+    /// SI, and include only those arrays requested by any subscriber.
+    struct ResultSnapshot
+    {
+        int reportStep{};
+        double secondsElapsed{};
+
+        SummaryState summaryState{};
+        data::Wells wells{};
+        data::GroupAndNetworkValues groupAndNetwork{};
+        data::Solution solution{};
+    };
+
+    /// In-process publish/subscribe channel for report step results.
+    ///
+    /// Each published snapshot is shared, read-only, between all
+    /// subscribers.  A subscriber which needs the results beyond the
+    /// duration of its callback keeps a copy of the shared pointer, e.g.,
+    /// in a queue or ring buffer serviced by another thread.
+    ///
+    /// Subscription management and publication may happen on different
+    /// threads.  Callbacks are invoked on the publishing thread, in
+    /// subscription order, and should return quickly.
+    class ResultsBus
+    {
+    public:
+        using Snapshot = std::shared_ptr<const ResultSnapshot>;
+        using Callback = std::function<void(const Snapshot&)>;
+        using SubscriptionId = std::size_t;
+
+        /// Register callback for future snapshots.
+        ///
+        /// \param[in] callback Function receiving each snapshot.
+        ///
+        /// \param[in] solutionKeys Names of solution arrays, e.g.,
+        ///    "PRESSURE" or "SWAT", to include in the snapshots.  Arrays
+        ///    which are not available at a report step are omitted.
+        ///
+        /// \return Identifier of new subscription.  Pass to
+        ///    unsubscribe() to stop receiving snapshots.
+        SubscriptionId subscribe(Callback callback,
+                                 std::set<std::string> solutionKeys = {});
+
+        /// Remove subscription.  No effect if \p id is not a current
+        /// subscription.
+        void unsubscribe(const SubscriptionId id);
+
+        /// Whether or not there are any subscribers.  Publishers use this
+        /// to avoid creating snapshots which nobody receives.
+        bool hasSubscribers() const;
+
+        /// Union of solution array names requested by all subscribers.
+        std::set<std::string> solutionKeys() const;
+
+        /// Deliver snapshot to all subscribers.
+        void publish(Snapshot snapshot);
+
+        /// Most recently published snapshot, or null if none.
+        Snapshot latest() const;
+
+    private:
+        struct Subscription
+        {
+            std::shared_ptr<const Callback> callback{};
+            std::set<std::string> solutionKeys{};
+        };
+
+        mutable std::mutex mutex_{};
+        SubscriptionId nextId_{0};
+        std::map<SubscriptionId, Subscription> subscriptions_{};
+        Snapshot latest_{};
+    };
+
+} // namespace Opm
+
+#endif // OPM_RESULTS_BUS_HPP
@@ -79,11 +79,32 @@ namespace Opm { namespace RestartIO { namespace Helpers {
                 throw std::invalid_argument("Window array with windowsize==0 is not permitted");
         }
 
+        /// Default constructor.  Empty array with window size one,
+        /// pending reset().
+        WindowedArray() = default;
+
         WindowedArray(const WindowedArray& rhs) = default;
         WindowedArray(WindowedArray&& rhs) = default;
         WindowedArray& operator=(const WindowedArray& rhs) = delete;
         WindowedArray& operator=(WindowedArray&& rhs) = default;
 
+        /// Reinitialise array as if newly constructed.
+        ///
+        /// All data items are value initialised.  Reuses the existing
+        /// storage, which is only reallocated if the new array is larger
+        /// than any previous one.
+        ///
+        /// \param[in] n Number of windows.
+        /// \param[in] sz Number of data items per window.
+        void reset(const NumWindows n, const WindowSize sz)
+        {
+            if (sz.value == 0)
+                throw std::invalid_argument("Window array with windowsize==0 is not permitted");
+
+            this->x_.assign(n.value * sz.value, T{});
+            this->windowSize_ = sz.value;
+        }
+
         /// Retrieve number of windows allocated for this array.
         Idx numWindows() const
         {
@@ -142,9 +163,9 @@ namespace Opm { namespace RestartIO { namespace Helpers {
         }
 
     private:
-        std::vector<T> x_;
+        std::vector<T> x_{};
 
-        Idx windowSize_;
+        Idx windowSize_{1};
     };
 
 
@@ -194,6 +215,30 @@ namespace Opm { namespace RestartIO { namespace Helpers {
                 throw std::invalid_argument("Window matrix with columns==0 is not permitted");
         }
 
+        /// Default constructor.  Empty matrix with one column, pending
+        /// reset().
+        WindowedMatrix() = default;
+
+        /// Reinitialise matrix as if newly constructed.
+        ///
+        /// All data items are value initialised.  Reuses the existing
+        /// storage, which is only reallocated if the new matrix is larger
+        /// than any previous one.
+        ///
+        /// \param[in] nRows Number of rows.
+        /// \param[in] nCols Number of columns.
+        /// \param[in] sz Number of data items per (row,column) window.
+        void reset(const NumRows& nRows,
+                   const NumCols& nCols,
+                   const WindowSize& sz)
+        {
+            if (nCols.value == 0)
+                throw std::invalid_argument("Window matrix with columns==0 is not permitted");
+
+            this->data_.reset(NumWindows{ nRows.value * nCols.value }, sz);
+            this->numCols_ = nCols.value;
+        }
+
         /// Retrieve number of columns allocated for this matrix.
         Idx numCols() const
         {
@@ -259,9 +304,9 @@ namespace Opm { namespace RestartIO { namespace Helpers {
         }
 
     private:
-        WindowedArray<T> data_;
+        WindowedArray<T> data_{};
 
-        Idx numCols_;
+        Idx numCols_{1};
 
         /// Row major (C) order.
         Idx i(const Idx row, const Idx col) const
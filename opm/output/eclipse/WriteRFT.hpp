@@ -20,6 +20,9 @@
 #ifndef OPM_WRITE_RFT_HPP
 #define OPM_WRITE_RFT_HPP
 
+#include <cstddef>
+#include <memory>
+
 namespace Opm {
 
     class EclipseGrid;
@@ -42,6 +45,45 @@ namespace Opm { namespace EclIO { namespace OutputStream {
 
 namespace Opm { namespace RftIO {
 
+    /// Per-well connection gather plans for RFT output.
+    ///
+    /// A well's plan holds the (I,J,K) triples, cell depths, and the
+    /// positions in the well's dynamic results, of those of its reservoir
+    /// connections which are in active cells.  The plan is created when
+    /// the well is first output and recreated only when the well's
+    /// connections change.  Plans are specific to a single grid, so an
+    /// object of this type should not be shared between runs.
+    class GatherPlans
+    {
+    public:
+        GatherPlans();
+        ~GatherPlans();
+
+        GatherPlans(const GatherPlans& rhs) = delete;
+        GatherPlans(GatherPlans&& rhs);
+
+        GatherPlans& operator=(const GatherPlans& rhs) = delete;
+        GatherPlans& operator=(GatherPlans&& rhs);
+
+        /// Number of wells for which a plan exists.
+        std::size_t numWells() const;
+
+        /// Implementation details, defined in WriteRFT.cpp.
+        struct Impl;
+
+    private:
+        std::unique_ptr<Impl> pImpl_;
+
+        friend void write(const int                        reportStep,
+                          const double                     elapsed,
+                          const ::Opm::UnitSystem&         usys,
+                          const ::Opm::EclipseGrid&        grid,
+                          const ::Opm::Schedule&           schedule,
+                          const ::Opm::data::Wells&        wellSol,
+                          GatherPlans&                     plans,
+                          ::Opm::EclIO::OutputStream::RFT& rftFile);
+    };
+
     /// Collect RFT data and output to pre-opened output stream.
     ///
     /// RFT data is output for all affected wells at a given timestep,
@@ -84,6 +126,26 @@ namespace Opm { namespace RftIO {
                const ::Opm::data::Wells&        wellSol,
                ::Opm::EclIO::OutputStream::RFT& rftFile);
 
+    /// Collect RFT data and output to pre-opened output stream, reusing
+    /// connection gather plans from previous report steps.
+    ///
+    /// Same output as the overload without a \c GatherPlans argument.
+    /// The data of all affected wells are collected in a single pass,
+    /// concurrently if there are many such wells, before any of it is
+    /// written to \p rftFile.
+    ///
+    /// \param[in,out] plans Connection gather plans.  Plans of wells
+    ///    output at this report step are created or updated as needed.
+    ///    Should be the same object at each report step of a run.
+    void write(const int                        reportStep,
+               const double                     elapsed,
+               const ::Opm::UnitSystem&         usys,
+               const ::Opm::EclipseGrid&        grid,
+               const ::Opm::Schedule&           schedule,
+               const ::Opm::data::Wells&        wellSol,
+               GatherPlans&                     plans,
+               ::Opm::EclIO::OutputStream::RFT& rftFile);
+
 }} // namespace Opm::RftIO
 
 #endif // OPM_WRITE_RFT_HPP
@@ -20,6 +20,8 @@
 #ifndef OPM_WRITE_RESTART_HELPERS_HPP
 #define OPM_WRITE_RESTART_HELPERS_HPP
 
+#include <cstddef>
+#include <functional>
 #include <vector>
 
 // Forward declarations
@@ -30,6 +32,7 @@ namespace Opm {
     class EclipseGrid;
     class EclipseState;
     class Schedule;
+    class SummaryState;
     class Well;
     class UnitSystem;
     class UDQActive;
@@ -86,6 +89,29 @@ namespace Opm { namespace RestartIO { namespace Helpers {
     createActionRSTDims(const Schedule&     sched,
                         const std::size_t   simStep);
 
+    /// Whether or not the restart arrays of a model with 'num_wells'
+    /// wells at report step 'sim_step' are assembled concurrently.  True
+    /// if more than one thread is available and there are enough wells to
+    /// amortize the overhead.  In that case the data which the Schedule
+    /// and the SummaryState build on first access is built before this
+    /// function returns, so the concurrent aggregators only read.
+    bool
+    useConcurrentAggregation(const Schedule&     sched,
+                             const std::size_t   sim_step,
+                             const SummaryState& smry,
+                             const std::size_t   num_wells);
+
+    /// Call task(i) for all i in [0, num_tasks).  If 'concurrent', the
+    /// calls are distributed over the available threads as OpenMP tasks
+    /// in chunks of 'grain_size' calls; a concurrent loop started from
+    /// within a task shares the threads of the enclosing loop.  The first
+    /// exception thrown by a task is rethrown once all calls are done.
+    void
+    runConcurrently(const std::size_t                       num_tasks,
+                    const std::size_t                       grain_size,
+                    const bool                              concurrent,
+                    const std::function<void(std::size_t)>& task);
+
 }}} // Opm::RestartIO::Helpers
 
 #endif  // OPM_WRITE_RESTART_HELPERS_HPP
@@ -17,12 +17,32 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <cstddef>
+#include <memory>
 #include <regex>
 
 #include <opm/common/utility/shmatch.hpp>
 
+namespace {
 
-bool Opm::shmatch(const std::string& pattern, const std::string& symbol) {
+// The characters which make the pattern a regular expression, in addition to
+// the shell wildcards '*' and '?'.
+bool is_regex_special(char c) {
+    switch (c) {
+    case '.': case '+': case '(': case ')': case '[': case ']':
+    case '{': case '}': case '|': case '\\': case '^': case '$':
+        return true;
+    default:
+        return false;
+    }
+}
+
+// The regular expression '.' does not match line terminators.
+bool is_line_terminator(char c) {
+    return c == '\n' || c == '\r';
+}
+
+std::regex make_regex(const std::string& pattern) {
     // Shell patterns should implicitly be interpreted as anchored at beginning
     // and end.
     std::string re_pattern = "^" + pattern + "$";
@@ -41,7 +61,84 @@ bool Opm::shmatch(const std::string& pattern, const std::string& symbol) {
         re_pattern = std::regex_replace(re_pattern, re, ".");
     }
 
-    std::regex regexp(re_pattern);
-    return std::regex_search(symbol, regexp);
+    return std::regex(re_pattern);
+}
+
+/*
+  Iterative wildcard matching; when a mismatch occurs after a '*' the '*' is
+  extended by one character and the matching restarts from there.
+*/
+bool glob_match(const std::string& pattern, const std::string& symbol) {
+    const auto npos = std::string::npos;
+    std::size_t pi = 0;
+    std::size_t si = 0;
+    std::size_t star = npos;
+    std::size_t mark = 0;
+
+    while (si < symbol.size()) {
+        if (pi < pattern.size() && pattern[pi] == '*') {
+            star = pi++;
+            mark = si;
+            continue;
+        }
+
+        if (pi < pattern.size() &&
+            (pattern[pi] == symbol[si] || (pattern[pi] == '?' && !is_line_terminator(symbol[si])))) {
+            pi++;
+            si++;
+            continue;
+        }
+
+        if (star != npos && !is_line_terminator(symbol[mark])) {
+            pi = star + 1;
+            si = ++mark;
+            continue;
+        }
+
+        return false;
+    }
+
+    while (pi < pattern.size() && pattern[pi] == '*')
+        pi++;
+
+    return pi == pattern.size();
 }
 
+}
+
+
+struct Opm::ShellPattern::Regex {
+    std::regex regex;
+};
+
+
+Opm::ShellPattern::ShellPattern(const std::string& pattern) :
+    m_pattern(pattern)
+{
+    bool is_regex = false;
+    for (const auto c : pattern)
+        is_regex = is_regex || is_regex_special(c);
+
+    if (is_regex)
+        this->m_regex = std::make_shared<const Regex>(Regex{ make_regex(pattern) });
+    else
+        this->m_prefix = pattern.substr(0, pattern.find_first_of("*?"));
+}
+
+
+bool Opm::ShellPattern::match(const std::string& symbol) const {
+    if (this->m_regex)
+        return std::regex_search(symbol, this->m_regex->regex);
+
+    return glob_match(this->m_pattern, symbol);
+}
+
+
+const std::string& Opm::ShellPattern::prefix() const {
+    return this->m_prefix;
+}
+
+
+bool Opm::shmatch(const std::string& pattern, const std::string& symbol) {
+    return ShellPattern(pattern).match(symbol);
+}
@@ -0,0 +1,157 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/input/eclipse/EclipseState/Grid/ActiveIndexMap.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace Opm {
+
+namespace {
+
+constexpr std::size_t word_bits = 64;
+constexpr std::size_t block_words = 8;
+
+inline std::size_t popcount(std::uint64_t word) {
+    return static_cast<std::size_t>(__builtin_popcountll(word));
+}
+
+// Position of the n'th (zero based) set bit in word.
+inline std::size_t select_in_word(std::uint64_t word, std::size_t n) {
+    for (std::size_t i = 0; i < n; i++)
+        word &= word - 1;
+
+    return static_cast<std::size_t>(__builtin_ctzll(word));
+}
+
+}
+
+ActiveIndexMap::ActiveIndexMap(const std::vector<int>& actnum)
+    : m_size(actnum.size())
+    , m_bits((actnum.size() + word_bits - 1) / word_bits, 0)
+{
+    #pragma omp parallel for schedule(static)
+    for (std::size_t word = 0; word < this->m_bits.size(); word++) {
+        const std::size_t begin = word * word_bits;
+        const std::size_t end = std::min(begin + word_bits, this->m_size);
+        std::uint64_t bits = 0;
+        for (std::size_t g = begin; g < end; g++) {
+            if (actnum[g] > 0)
+                bits |= std::uint64_t{1} << (g - begin);
+        }
+        this->m_bits[word] = bits;
+    }
+
+    const std::size_t num_blocks = (this->m_bits.size() + block_words - 1) / block_words;
+    this->m_block_rank.assign(num_blocks + 1, 0);
+    for (std::size_t word = 0; word < this->m_bits.size(); word++)
+        this->m_block_rank[word / block_words + 1] += popcount(this->m_bits[word]);
+
+    for (std::size_t block = 0; block < num_blocks; block++)
+        this->m_block_rank[block + 1] += this->m_block_rank[block];
+}
+
+std::size_t ActiveIndexMap::size() const {
+    return this->m_size;
+}
+
+std::size_t ActiveIndexMap::numActive() const {
+    return this->m_block_rank.empty() ? 0 : this->m_block_rank.back();
+}
+
+bool ActiveIndexMap::cellActive(std::size_t global_index) const {
+    return (this->m_bits[global_index / word_bits] >> (global_index % word_bits)) & 1;
+}
+
+int ActiveIndexMap::activeIndex(std::size_t global_index) const {
+    if (!this->cellActive(global_index))
+        return -1;
+
+    const std::size_t word = global_index / word_bits;
+    const std::size_t block = word / block_words;
+    std::size_t rank = this->m_block_rank[block];
+    for (std::size_t w = block * block_words; w < word; w++)
+        rank += popcount(this->m_bits[w]);
+
+    const auto mask = (std::uint64_t{1} << (global_index % word_bits)) - 1;
+    rank += popcount(this->m_bits[word] & mask);
+    return static_cast<int>(rank);
+}
+
+std::size_t ActiveIndexMap::globalIndex(std::size_t active_index) const {
+    if (active_index >= this->numActive())
+        throw std::out_of_range("Active index out of range");
+
+    const auto block_iter = std::upper_bound(this->m_block_rank.begin(), this->m_block_rank.end(), active_index) - 1;
+    const std::size_t block = std::distance(this->m_block_rank.begin(), block_iter);
+    std::size_t remaining = active_index - *block_iter;
+
+    std::size_t word = block * block_words;
+    while (true) {
+        const auto count = popcount(this->m_bits[word]);
+        if (remaining < count)
+            break;
+
+        remaining -= count;
+        word++;
+    }
+
+    return word * word_bits + select_in_word(this->m_bits[word], remaining);
+}
+
+std::vector<int> ActiveIndexMap::actnum() const {
+    std::vector<int> actnum(this->m_size);
+    for (std::size_t g = 0; g < this->m_size; g++)
+        actnum[g] = this->cellActive(g) ? 1 : 0;
+
+    return actnum;
+}
+
+std::vector<int> ActiveIndexMap::activeToGlobal() const {
+    std::vector<int> active_to_global;
+    active_to_global.reserve(this->numActive());
+    for (std::size_t word = 0; word < this->m_bits.size(); word++) {
+        auto bits = this->m_bits[word];
+        while (bits != 0) {
+            active_to_global.push_back(word * word_bits + __builtin_ctzll(bits));
+            bits &= bits - 1;
+        }
+    }
+
+    return active_to_global;
+}
+
+std::vector<int> ActiveIndexMap::globalToActive() const {
+    std::vector<int> global_to_active(this->m_size, -1);
+    int active_index = 0;
+    for (std::size_t g = 0; g < this->m_size; g++) {
+        if (this->cellActive(g))
+            global_to_active[g] = active_index++;
+    }
+
+    return global_to_active;
+}
+
+bool ActiveIndexMap::operator==(const ActiveIndexMap& other) const {
+    return this->m_size == other.m_size &&
+           this->m_bits == other.m_bits;
+}
+
+}
@@ -56,6 +56,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstddef>
 #include <cstring>
 #include <functional>
 #include <initializer_list>
@@ -210,6 +211,9 @@ EclipseGrid::EclipseGrid(const EclipseGrid& src, const double* zcorn, const std:
     if (zcorn != nullptr) {
         size_t sizeZcorn = this->getCartesianSize()*8;
 
+        m_zcorn.resize(sizeZcorn);
+        m_zcorn_compact.clear();
+        expanded_zcorn.reset();
         for (size_t n=0; n < sizeZcorn; n++) {
             m_zcorn[n] = zcorn[n];
         }
@@ -487,6 +491,15 @@ EclipseGrid::EclipseGrid(const Deck& deck, const int * actnum)
     }
 
     size_t EclipseGrid::activeIndex(size_t globalIndex) const {
+        if (m_active_map.has_value()) {
+            const auto active_index = m_active_map->activeIndex(globalIndex);
+            if (active_index == -1) {
+                throw std::invalid_argument("Input argument does not correspond to an active cell");
+            }
+
+            return active_index;
+        }
+
         if (m_global_to_active.empty()) {
             return globalIndex;
         }
@@ -504,6 +517,9 @@ EclipseGrid::EclipseGrid(const Deck& deck, const int * actnum)
     */
 
     size_t EclipseGrid::getGlobalIndex(size_t active_index) const {
+        if (m_active_map.has_value())
+            return m_active_map->globalIndex(active_index);
+
         return m_active_to_global.at(active_index);
     }
 
@@ -639,8 +655,13 @@ EclipseGrid::EclipseGrid(const Deck& deck, const int * actnum)
             zind[n+4] = zind[n] + dims[0]*dims[1]*4;
 
 
-        for (int n = 0; n< 8; n++)
-           Z[n] = m_zcorn[zind[n]];
+        if (m_zcorn_compact.empty()) {
+            for (int n = 0; n< 8; n++)
+               Z[n] = m_zcorn[zind[n]];
+        } else {
+            for (int n = 0; n< 8; n++)
+               Z[n] = m_zcorn_compact[zind[n]];
+        }
 
 
         for (int  n=0; n<4; n++) {
@@ -1393,19 +1414,19 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
         if (m_coord.size() != other.m_coord.size())
             return false;
 
-        if (m_zcorn.size() != other.m_zcorn.size())
+        if (getZCORN().size() != other.getZCORN().size())
             return false;
 
         if (!(m_mapaxes == other.m_mapaxes))
             return false;
 
-        if (m_actnum != other.m_actnum)
+        if (getACTNUM() != other.getACTNUM())
             return false;
 
         if (m_coord != other.m_coord)
             return false;
 
-        if (m_zcorn != other.m_zcorn)
+        if (getZCORN() != other.getZCORN())
             return false;
 
         bool status = ((m_pinch == other.m_pinch)  && (m_minpvMode == other.getMinpvMode()));
@@ -1427,7 +1448,9 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
 
     bool EclipseGrid::cellActive( size_t globalIndex ) const {
         assertGlobalIndex( globalIndex );
-        if (m_actnum.empty()) {
+        if (m_active_map.has_value()) {
+            return m_active_map->cellActive(globalIndex);
+        } else if (m_actnum.empty()) {
             return true;
         } else {
             return m_actnum[globalIndex]>0;
@@ -1444,13 +1467,18 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
     const std::vector<double>& EclipseGrid::activeVolume() const {
         if (!this->active_volume.has_value()) {
             std::vector<double> volume(this->m_nactive);
+            const std::size_t num_mapped = this->m_active_map.has_value()
+                ? this->m_active_map->numActive()
+                : this->m_active_to_global.size();
 
             #pragma omp parallel for schedule(static)
-            for (std::size_t active_index = 0; active_index < this->m_active_to_global.size(); active_index++) {
+            for (std::size_t active_index = 0; active_index < num_mapped; active_index++) {
                 std::array<double,8> X;
                 std::array<double,8> Y;
                 std::array<double,8> Z;
-                auto global_index = this->m_active_to_global[active_index];
+                auto global_index = this->m_active_map.has_value()
+                    ? this->m_active_map->globalIndex(active_index)
+                    : this->m_active_to_global[active_index];
                 this->getCellCorners(global_index, X, Y, Z );
                 if (m_rv && m_thetav) {
                     const auto[i,j,k] = this->getIJK(global_index);
@@ -1672,6 +1700,13 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
     }
 
     const std::vector<int>& EclipseGrid::getACTNUM( ) const {
+        if (m_active_map.has_value()) {
+            std::lock_guard<std::mutex> lock(this->expansion_lock.mutex);
+            if (!this->expanded_actnum.has_value())
+                this->expanded_actnum = m_active_map->actnum();
+
+            return this->expanded_actnum.value();
+        }
 
         return m_actnum;
     }
@@ -1683,12 +1718,25 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
 
     size_t EclipseGrid::fixupZCORN() {
 
+        if (!m_zcorn_compact.empty()) {
+            m_zcorn.assign(m_zcorn_compact.begin(), m_zcorn_compact.end());
+            m_zcorn_compact.clear();
+            expanded_zcorn.reset();
+        }
+
         ZcornMapper mapper( getNX(), getNY(), getNZ());
 
         return mapper.fixupZCORN( m_zcorn );
     }
 
     const std::vector<double>& EclipseGrid::getZCORN( ) const {
+        if (!m_zcorn_compact.empty()) {
+            std::lock_guard<std::mutex> lock(this->expansion_lock.mutex);
+            if (!this->expanded_zcorn.has_value())
+                this->expanded_zcorn = std::vector<double>(m_zcorn_compact.begin(), m_zcorn_compact.end());
+
+            return this->expanded_zcorn.value();
+        }
 
         return m_zcorn;
     }
@@ -1700,23 +1748,8 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
 
         const std::array<int, 3> dims = getNXYZ();
 
-        // Preparing vectors to be saved
-
-        // create coord vector of floats with input units, converted from SI
-        std::vector<float> coord_f;
-        coord_f.resize(m_coord.size());
-
-        for (size_t n=0; n< m_coord.size(); n++){
-            coord_f[n] = static_cast<double>(units.from_si(length, m_coord[n]));
-        }
-
-        // create zcorn vector of floats with input units, converted from SI
-        std::vector<float> zcorn_f;
-        zcorn_f.resize(m_zcorn.size());
-
-        for (size_t n=0; n< m_zcorn.size(); n++){
-            zcorn_f[n] = static_cast<double>(units.from_si(length, m_zcorn[n]));
-        }
+        // COORD, ZCORN and ACTNUM are converted and streamed to the file in
+        // chunks below, i.e. no full size float copies are created.
 
         std::vector<int> filehead(100,0);
         filehead[0] = 3;                     // version number
@@ -1777,10 +1810,21 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
         egridfile.write("GRIDUNIT", gridunits);
         egridfile.write("GRIDHEAD", gridhead);
 
-        egridfile.write("COORD", coord_f);
-        egridfile.write("ZCORN", zcorn_f);
+        egridfile.writeGenerated<float>("COORD", m_coord.size(), [&units, length, this](std::size_t n)
+        { return static_cast<float>(units.from_si(length, m_coord[n])); });
+
+        if (m_zcorn_compact.empty())
+            egridfile.writeGenerated<float>("ZCORN", m_zcorn.size(), [&units, length, this](std::size_t n)
+            { return static_cast<float>(units.from_si(length, m_zcorn[n])); });
+        else
+            egridfile.writeGenerated<float>("ZCORN", m_zcorn_compact.size(), [&units, length, this](std::size_t n)
+            { return static_cast<float>(units.from_si(length, m_zcorn_compact[n])); });
 
-        egridfile.write("ACTNUM", m_actnum);
+        if (m_active_map.has_value())
+            egridfile.writeGenerated<int>("ACTNUM", m_active_map->size(), [this](std::size_t g)
+            { return m_active_map->cellActive(g) ? 1 : 0; });
+        else
+            egridfile.write("ACTNUM", m_actnum);
         egridfile.write("ENDGRID", endgrid);
 
         if (nnc1.size() > 0){
@@ -1791,6 +1835,13 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
     }
 
     const std::vector<int>& EclipseGrid::getActiveMap() const {
+        if (m_active_map.has_value()) {
+            std::lock_guard<std::mutex> lock(this->expansion_lock.mutex);
+            if (!this->expanded_active_map.has_value())
+                this->expanded_active_map = m_active_map->activeToGlobal();
+
+            return this->expanded_active_map.value();
+        }
 
         return m_active_to_global;
     }
@@ -1804,34 +1855,65 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
         std::iota(this->m_global_to_active.begin(), this->m_global_to_active.end(), 0);
         this->m_active_to_global = this->m_global_to_active;
         this->active_volume = std::nullopt;
+
+        if (this->m_active_map.has_value()) {
+            this->m_active_map.reset();
+            this->compressACTNUM();
+        }
     }
 
     void EclipseGrid::resetACTNUM(const int* actnum) {
         if (actnum == nullptr)
             this->resetACTNUM();
         else {
-            auto global_size = this->getCartesianSize();
-            this->m_global_to_active.clear();
-            this->m_active_to_global.clear();
-            this->m_actnum.resize(global_size);
-            this->m_nactive = 0;
-
-            for (size_t n = 0; n < global_size; n++) {
-                this->m_actnum[n] = actnum[n];
-                // numerical aquifer cells need to be active
-                if (this->m_aquifer_cells.count(n) > 0) {
-                    this->m_actnum[n] = 1;
-                }
-                if (this->m_actnum[n] > 0) {
-                    this->m_global_to_active.push_back(this->m_nactive);
-                    this->m_active_to_global.push_back(n);
-                    this->m_nactive++;
-                } else {
-                    this->m_global_to_active.push_back(-1);
+            const std::size_t global_size = this->getCartesianSize();
+            this->m_actnum.assign(actnum, actnum + global_size);
+
+            // numerical aquifer cells need to be active
+            for (const auto& aquifer_cell : this->m_aquifer_cells)
+                this->m_actnum[aquifer_cell] = 1;
+
+            // The active <-> global maps are built with a blocked, two-pass
+            // prefix sum: first count the active cells in each block, then
+            // scan the block counts and fill in the maps block by block.
+            const std::size_t block_size = 1 << 16;
+            const std::size_t num_blocks = (global_size + block_size - 1) / block_size;
+            std::vector<std::size_t> block_offset(num_blocks + 1, 0);
+
+            #pragma omp parallel for schedule(static)
+            for (std::size_t block = 0; block < num_blocks; block++) {
+                const std::size_t begin = block * block_size;
+                const std::size_t end = std::min(begin + block_size, global_size);
+                block_offset[block + 1] = std::count_if(this->m_actnum.begin() + begin,
+                                                        this->m_actnum.begin() + end,
+                                                        [](const int a) { return a > 0; });
+            }
+            std::partial_sum(block_offset.begin(), block_offset.end(), block_offset.begin());
 
+            this->m_nactive = block_offset.back();
+            this->m_global_to_active.resize(global_size);
+            this->m_active_to_global.resize(this->m_nactive);
+
+            #pragma omp parallel for schedule(static)
+            for (std::size_t block = 0; block < num_blocks; block++) {
+                const std::size_t begin = block * block_size;
+                const std::size_t end = std::min(begin + block_size, global_size);
+                std::size_t active_index = block_offset[block];
+                for (std::size_t n = begin; n < end; n++) {
+                    if (this->m_actnum[n] > 0) {
+                        this->m_global_to_active[n] = active_index;
+                        this->m_active_to_global[active_index] = n;
+                        active_index++;
+                    } else
+                        this->m_global_to_active[n] = -1;
                 }
             }
             this->active_volume = std::nullopt;
+
+            if (this->m_active_map.has_value()) {
+                this->m_active_map.reset();
+                this->compressACTNUM();
+            }
         }
     }
 
@@ -1842,6 +1924,40 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
         this->resetACTNUM(actnum.data());
     }
 
+    void EclipseGrid::compressACTNUM() {
+        if (this->m_active_map.has_value() || this->m_actnum.empty())
+            return;
+
+        this->m_active_map = ActiveIndexMap(this->m_actnum);
+        std::vector<int>().swap(this->m_actnum);
+        std::vector<int>().swap(this->m_active_to_global);
+        std::vector<int>().swap(this->m_global_to_active);
+        this->expanded_actnum.reset();
+        this->expanded_active_map.reset();
+    }
+
+    bool EclipseGrid::compressZCORN(double max_error) {
+        if (!this->m_zcorn_compact.empty())
+            return true;
+
+        std::vector<float> zcorn_f(this->m_zcorn.size());
+        double error = 0;
+
+        #pragma omp parallel for schedule(static) reduction(max:error)
+        for (std::size_t n = 0; n < this->m_zcorn.size(); n++) {
+            zcorn_f[n] = static_cast<float>(this->m_zcorn[n]);
+            error = std::max(error, std::fabs(zcorn_f[n] - this->m_zcorn[n]));
+        }
+
+        if (error > max_error)
+            return false;
+
+        this->m_zcorn_compact = std::move(zcorn_f);
+        std::vector<double>().swap(this->m_zcorn);
+        this->expanded_zcorn.reset();
+        return true;
+    }
+
     ZcornMapper EclipseGrid::zcornMapper() const {
         return ZcornMapper( getNX() , getNY(), getNZ() );
     }
@@ -1932,32 +2048,48 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
         int sign = zcorn[ this->index(0,0,0,0) ] <= zcorn[this->index(0,0, this->dims[2] - 1,4)] ? 1 : -1;
         size_t cells_adjusted = 0;
 
-        for (size_t k=0; k < this->dims[2]; k++)
-            for (size_t j=0; j < this->dims[1]; j++)
-                for (size_t i=0; i < this->dims[0]; i++)
-                    for (size_t c=0; c < 4; c++) {
-                        /* Cell to cell */
-                        if (k > 0) {
-                            size_t index1 = this->index(i,j,k-1,c+4);
-                            size_t index2 = this->index(i,j,k,c);
-
-                            if ((zcorn[index2] - zcorn[index1]) * sign < 0 ) {
-                                zcorn[index2] = zcorn[index1];
-                                cells_adjusted++;
-                            }
+        /*
+          Every pillar corner (i,j,c) is fixed up independently of all the
+          others, going downwards through the layers, so the work is
+          distributed over the columns of the grid.
+        */
+        const auto num_columns = static_cast<std::ptrdiff_t>(this->dims[0] * this->dims[1]);
+
+        #pragma omp parallel for schedule(static) reduction(+:cells_adjusted)
+        for (std::ptrdiff_t column = 0; column < num_columns; column++) {
+            const size_t i = column % this->dims[0];
+            const size_t j = column / this->dims[0];
+            const size_t column_offset = i*stride[0] + j*stride[1];
+
+            for (size_t c=0; c < 4; c++) {
+                const size_t bottom = column_offset + cell_shift[c];
+                const size_t top = column_offset + cell_shift[c + 4];
+
+                for (size_t k=0; k < this->dims[2]; k++) {
+                    /* Cell to cell */
+                    if (k > 0) {
+                        size_t index1 = top + (k - 1)*stride[2];
+                        size_t index2 = bottom + k*stride[2];
+
+                        if ((zcorn[index2] - zcorn[index1]) * sign < 0 ) {
+                            zcorn[index2] = zcorn[index1];
+                            cells_adjusted++;
                         }
+                    }
 
-                        /* Cell internal */
-                        {
-                            size_t index1 = this->index(i,j,k,c);
-                            size_t index2 = this->index(i,j,k,c+4);
+                    /* Cell internal */
+                    {
+                        size_t index1 = bottom + k*stride[2];
+                        size_t index2 = top + k*stride[2];
 
-                            if ((zcorn[index2] - zcorn[index1]) * sign < 0 ) {
-                                zcorn[index2] = zcorn[index1];
-                                cells_adjusted++;
-                            }
+                        if ((zcorn[index2] - zcorn[index1]) * sign < 0 ) {
+                            zcorn[index2] = zcorn[index1];
+                            cells_adjusted++;
                         }
                     }
+                }
+            }
+        }
         return cells_adjusted;
     }
 
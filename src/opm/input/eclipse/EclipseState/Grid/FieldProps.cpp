@@ -360,8 +360,40 @@ std::vector<double> extract_cell_depth(const EclipseGrid& grid) {
   keyword - the containers are considered to be equal.
 */
 template <typename T>
-bool rst_compare_data(const std::unordered_map<std::string, Fieldprops::FieldData<T>>& data1,
-                  const std::unordered_map<std::string, Fieldprops::FieldData<T>>& data2) {
+using FieldDataMap = std::unordered_map<std::string, std::shared_ptr<Fieldprops::FieldData<T>>>;
+
+/*
+  Make sure the field is not shared with any other FieldProps instance before
+  it is modified.
+*/
+template <typename T>
+Fieldprops::FieldData<T>& unique_field(std::shared_ptr<Fieldprops::FieldData<T>>& field) {
+    if (field.use_count() > 1)
+        field = std::make_shared<Fieldprops::FieldData<T>>(*field);
+
+    return *field;
+}
+
+template <typename T>
+bool compare_data(const FieldDataMap<T>& data1, const FieldDataMap<T>& data2) {
+    if (data1.size() != data2.size())
+        return false;
+
+    for (const auto& [key, field1] : data1) {
+        const auto iter = data2.find(key);
+        if (iter == data2.end())
+            return false;
+
+        if ((field1 != iter->second) && !(*field1 == *iter->second))
+            return false;
+    }
+
+    return true;
+}
+
+template <typename T>
+bool rst_compare_data(const FieldDataMap<T>& data1,
+                      const FieldDataMap<T>& data2) {
     std::unordered_set<std::string> keys;
     for (const auto& [key, _] : data1) {
         (void)_;
@@ -378,18 +410,18 @@ bool rst_compare_data(const std::unordered_map<std::string, Fieldprops::FieldDat
         const auto& d2 = data2.find(key);
 
         if (d1 == data1.end()) {
-            if (!d2->second.valid_default())
+            if (!d2->second->valid_default())
                 return false;
             continue;
         }
 
         if (d2 == data2.end()) {
-            if (!d1->second.valid_default())
+            if (!d1->second->valid_default())
                 return false;
             continue;
         }
 
-        if (!(d1->second == d2->second))
+        if (!(*d1->second == *d2->second))
             return false;
     }
 
@@ -416,8 +448,8 @@ bool FieldProps::operator==(const FieldProps& other) const {
            this->m_default_region == other.m_default_region &&
            this->m_rtep == other.m_rtep &&
            this->tables == other.tables &&
-           this->int_data == other.int_data &&
-           this->double_data == other.double_data &&
+           compare_data(this->int_data, other.int_data) &&
+           compare_data(this->double_data, other.double_data) &&
            this->multregp == other.multregp &&
            this->tran == other.tran;
 }
@@ -506,6 +538,8 @@ FieldProps::FieldProps(const Deck& deck, const Phases& phases, const EclipseGrid
 
     if (DeckSection::hasSOLUTION(deck))
         this->scanSOLUTIONSection(SOLUTIONSection(deck));
+
+    this->finalize_keywords();
 }
 
 
@@ -561,10 +595,10 @@ void FieldProps::reset_actnum(const std::vector<int>& new_actnum) {
     }
 
     for (auto& data : this->double_data)
-        data.second.compress(active_map);
+        unique_field(data.second).compress(active_map);
 
     for (auto& data : this->int_data)
-        data.second.compress(active_map);
+        unique_field(data.second).compress(active_map);
 
     Fieldprops::compress(this->cell_volume, active_map);
     Fieldprops::compress(this->cell_depth, active_map);
@@ -645,21 +679,26 @@ Fieldprops::FieldData<double>& FieldProps::init_get(const std::string& keyword_n
     const std::string& keyword = Fieldprops::keywords::get_keyword_from_alias(keyword_name);
 
     auto iter = this->double_data.find(keyword);
-    if (iter != this->double_data.end())
-        return iter->second;
+    if (iter != this->double_data.end()) {
+        auto& field = unique_field(iter->second);
+        field.thaw();
+        return field;
+    }
 
-    this->double_data[keyword] = Fieldprops::FieldData<double>(kw_info, this->active_size, kw_info.global ? this->global_size : 0);
+    auto& field_ptr = this->double_data[keyword];
+    field_ptr = std::make_shared<Fieldprops::FieldData<double>>(kw_info, this->active_size, kw_info.global ? this->global_size : 0);
+    auto& field = *field_ptr;
 
     if (keyword == ParserKeywords::PORV::keywordName)
-        this->init_porv(this->double_data[keyword]);
+        this->init_porv(field);
 
     if (keyword == ParserKeywords::TEMPI::keywordName)
-        this->init_tempi(this->double_data[keyword]);
+        this->init_tempi(field);
 
     if (Fieldprops::keywords::PROPS::satfunc.count(keyword) == 1)
-        this->init_satfunc(keyword, this->double_data[keyword]);
+        this->init_satfunc(keyword, field);
 
-    return this->double_data[keyword];
+    return field;
 }
 
 template <>
@@ -673,11 +712,15 @@ Fieldprops::FieldData<double>& FieldProps::init_get(const std::string& keyword,
 template <>
 Fieldprops::FieldData<int>& FieldProps::init_get(const std::string& keyword, const Fieldprops::keywords::keyword_info<int>& kw_info) {
     auto iter = this->int_data.find(keyword);
-    if (iter != this->int_data.end())
-        return iter->second;
+    if (iter != this->int_data.end()) {
+        auto& field = unique_field(iter->second);
+        field.thaw();
+        return field;
+    }
 
-    this->int_data[keyword] = Fieldprops::FieldData<int>(kw_info, this->active_size, kw_info.global ? this->global_size : 0);
-    return this->int_data[keyword];
+    auto& field_ptr = this->int_data[keyword];
+    field_ptr = std::make_shared<Fieldprops::FieldData<int>>(kw_info, this->active_size, kw_info.global ? this->global_size : 0);
+    return *field_ptr;
 }
 
 template <>
@@ -728,6 +771,33 @@ bool FieldProps::has<int>(const std::string& keyword) const {
     return (this->int_data.count(keyword) != 0);
 }
 
+template <>
+const Fieldprops::FieldData<double>* FieldProps::find(const std::string& keyword_name) const {
+    const std::string& keyword = Fieldprops::keywords::get_keyword_from_alias(keyword_name);
+    const auto iter = this->double_data.find(keyword);
+    return (iter == this->double_data.end()) ? nullptr : iter->second.get();
+}
+
+template <>
+const Fieldprops::FieldData<int>* FieldProps::find(const std::string& keyword) const {
+    const auto iter = this->int_data.find(keyword);
+    return (iter == this->int_data.end()) ? nullptr : iter->second.get();
+}
+
+void FieldProps::finalize_keywords() {
+    for (auto& [_, field] : this->double_data) {
+        (void)_;
+        if ((field.use_count() == 1) && field->valid())
+            field->finalize();
+    }
+
+    for (auto& [_, field] : this->int_data) {
+        (void)_;
+        if ((field.use_count() == 1) && field->valid())
+            field->finalize();
+    }
+}
+
 
 /*
   The ACTNUM and PORV keywords are special cased with quite extensive
@@ -750,7 +820,7 @@ std::vector<std::string> FieldProps::keys<double>() const {
             continue;
         }
 
-        if (field.valid() && key != "PORV")
+        if (field->valid() && key != "PORV")
             klist.push_back(key);
     }
     return klist;
@@ -761,7 +831,7 @@ template <>
 std::vector<std::string> FieldProps::keys<int>() const {
     std::vector<std::string> klist;
     for (const auto& data_pair : this->int_data) {
-        if (data_pair.second.valid() && data_pair.first != "ACTNUM")
+        if (data_pair.second->valid() && data_pair.first != "ACTNUM")
             klist.push_back(data_pair.first);
     }
     return klist;
@@ -782,18 +852,22 @@ template <>
 std::vector<int> FieldProps::extract<int>(const std::string& keyword) {
     auto field_iter = this->int_data.find(keyword);
     auto field = std::move(field_iter->second);
-    std::vector<int> data = std::move( field.data );
     this->int_data.erase( field_iter );
-    return data;
+    if (field.use_count() > 1)
+        return field->data;
+
+    return std::move( field->data );
 }
 
 template <>
 std::vector<double> FieldProps::extract<double>(const std::string& keyword) {
     auto field_iter = this->double_data.find(keyword);
     auto field = std::move(field_iter->second);
-    std::vector<double> data = std::move( field.data );
     this->double_data.erase( field_iter );
-    return data;
+    if (field.use_count() > 1)
+        return field->data;
+
+    return std::move( field->data );
 }
 
 
@@ -905,10 +979,10 @@ void FieldProps::operate(const DeckRecord& record, Fieldprops::FieldData<T>& tar
         throw std::logic_error("The OPERATE keyword can not be used for manipulations of TRANX, TRANY or TRANZ");
 
     for (const auto& cell_index : index_list) {
-        if (value::has_value(src_data.value_status[cell_index.active_index])) {
+        if (value::has_value(src_data.status(cell_index.active_index))) {
             if ((check_target == false) || (value::has_value(target_data.value_status[cell_index.active_index]))) {
                 target_data.data[cell_index.active_index]         = func(target_data.data[cell_index.active_index], src_data.data[cell_index.active_index]);
-                target_data.value_status[cell_index.active_index] = src_data.value_status[cell_index.active_index];
+                target_data.value_status[cell_index.active_index] = src_data.status(cell_index.active_index);
             } else
                 throw std::invalid_argument("Tried to use unset property value in OPERATE/OPERATER keyword");
         } else
@@ -1240,7 +1314,7 @@ void FieldProps::scanGRIDSectionOnlyACTNUM(const GRIDSection& grid_section) {
     if (iter == this->int_data.end()) {
         m_actnum.assign(this->grid_ptr->getCartesianSize(), 1);
     } else {
-        m_actnum = iter->second.data;
+        m_actnum = iter->second->data;
     }
 }
 
@@ -40,15 +40,26 @@ FieldPropsManager::FieldPropsManager(const Deck& deck, const Phases& phases, con
 {}
 
 void FieldPropsManager::reset_actnum(const std::vector<int>& actnum) {
+    this->detach();
     this->fp->reset_actnum(actnum);
 }
 
+void FieldPropsManager::detach() {
+    // Copies of a FieldPropsManager share the FieldProps instance, and the
+    // FieldProps copy constructor only copies the shared keyword handles;
+    // hence this is cheap and only the keywords which are actually modified
+    // afterwards will be duplicated.
+    if (this->fp.use_count() > 1)
+        this->fp = std::make_shared<FieldProps>(*this->fp);
+}
+
 bool FieldPropsManager::is_usable() const
 {
     return static_cast<bool>(this->fp);
 }
 
 void FieldPropsManager::apply_schedule_keywords(const std::vector<DeckKeyword>& keywords) {
+    this->detach();
     this->fp->handle_schedule_keywords(keywords);
 }
 
@@ -130,6 +141,10 @@ std::vector<int> FieldPropsManager::actnum() const {
     return this->fp->actnum();
 }
 
+const std::vector<int>& FieldPropsManager::actnumRaw() const {
+    return this->fp->actnumRaw();
+}
+
 std::vector<double> FieldPropsManager::porv(bool global) const {
     const auto& field_data = this->fp->try_get<double>("PORV").field_data();
     if (global)
@@ -151,6 +166,7 @@ bool FieldPropsManager::tran_active(const std::string& keyword) const {
 }
 
 void FieldPropsManager::apply_numerical_aquifers(const NumericalAquifers& aquifers) {
+    this->detach();
     return this->fp->apply_numerical_aquifers(aquifers);
 }
 
@@ -160,6 +176,20 @@ const Fieldprops::TranMap& FieldPropsManager::getTran() const
     return this->fp->getTran();
 }
 
+namespace {
+
+template <typename T>
+const Fieldprops::FieldData<T>& field_data(const Fieldprops::FieldData<T>& data) {
+    return data;
+}
+
+template <typename T>
+const Fieldprops::FieldData<T>& field_data(const std::shared_ptr<Fieldprops::FieldData<T>>& data) {
+    return *data;
+}
+
+}
+
 template<class MapType>
 void apply_tran(const std::unordered_map<std::string, Fieldprops::TranCalculator>& tran,
                 const MapType& double_data,
@@ -168,11 +198,11 @@ void apply_tran(const std::unordered_map<std::string, Fieldprops::TranCalculator
 {
     const auto& calculator = tran.at(keyword);
     for (const auto& action : calculator) {
-        const auto& action_data = double_data.at(action.field);
+        const auto& action_data = field_data(double_data.at(action.field));
 
         for (std::size_t index = 0; index < active_size; index++) {
 
-            if (!value::has_value(action_data.value_status[index]))
+            if (!value::has_value(action_data.status(index)))
                 continue;
 
             switch (action.op) {
@@ -213,6 +243,11 @@ void apply_tran(const std::unordered_map<std::string, Fieldprops::TranCalculator
                 const std::map<std::string, Fieldprops::FieldData<double>>&,
                 std::size_t, const std::string&, std::vector<double>&);
 
+template
+void apply_tran(const std::unordered_map<std::string, Fieldprops::TranCalculator>&,
+                const std::unordered_map<std::string, std::shared_ptr<Fieldprops::FieldData<double>>>&,
+                std::size_t, const std::string&, std::vector<double>&);
+
 template bool FieldPropsManager::supported<int>(const std::string&);
 template bool FieldPropsManager::supported<double>(const std::string&);
 
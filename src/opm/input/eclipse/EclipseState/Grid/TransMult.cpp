@@ -68,7 +68,7 @@ namespace Opm {
         result.m_nx = 1;
         result.m_ny = 2;
         result.m_nz = 3;
-        result.m_trans = {{FaceDir::YPlus, {4.0, 5.0}}};
+        result.m_trans[directionSlot(FaceDir::YPlus)] = {4.0, 5.0};
         result.m_names = {{FaceDir::ZPlus, "test1"}};
         result.m_multregtScanner = MULTREGTScanner::serializationTestObject();
 
@@ -95,10 +95,10 @@ namespace Opm {
     }
 
     double TransMult::getMultiplier__(size_t globalIndex,  FaceDir::DirEnum faceDir) const {
-        if (hasDirectionProperty( faceDir )) {
-            const auto& data = m_trans.at(faceDir);
-            return data[globalIndex];
-        } else
+        const auto* data = this->getDirectionData(faceDir);
+        if (data != nullptr)
+            return (*data)[globalIndex];
+        else
             return 1.0;
     }
 
@@ -114,18 +114,40 @@ namespace Opm {
         return m_multregtScanner.getRegionMultiplier(globalCellIndex1, globalCellIndex2, faceDir);
     }
 
+    std::size_t TransMult::directionSlot(FaceDir::DirEnum faceDir) {
+        switch (faceDir) {
+        case FaceDir::XPlus:  return 0;
+        case FaceDir::XMinus: return 1;
+        case FaceDir::YPlus:  return 2;
+        case FaceDir::YMinus: return 3;
+        case FaceDir::ZPlus:  return 4;
+        case FaceDir::ZMinus: return 5;
+        default:
+            throw std::invalid_argument("Invalid face direction");
+        }
+    }
+
     bool TransMult::hasDirectionProperty(FaceDir::DirEnum faceDir) const {
-        return m_trans.count(faceDir) == 1;
+        return this->getDirectionData(faceDir) != nullptr;
+    }
+
+    const std::vector<double>* TransMult::getDirectionData(FaceDir::DirEnum faceDir) const {
+        if (faceDir == FaceDir::Unknown)
+            return nullptr;
+
+        const auto& data = m_trans[directionSlot(faceDir)];
+        return data.empty() ? nullptr : &data;
     }
 
 
     std::vector<double>& TransMult::getDirectionProperty(FaceDir::DirEnum faceDir) {
-        if (m_trans.count(faceDir) == 0) {
+        auto& data = m_trans[directionSlot(faceDir)];
+        if (data.empty()) {
             std::size_t global_size = this->m_nx * this->m_ny * this->m_nz;
-            m_trans[faceDir] = std::vector<double>(global_size, 1);
+            data.assign(global_size, 1);
         }
 
-        return m_trans.at( faceDir );
+        return data;
     }
 
     void TransMult::applyMULT(const std::vector<double>& srcData, FaceDir::DirEnum faceDir)
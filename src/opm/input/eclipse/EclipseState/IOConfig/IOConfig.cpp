@@ -101,6 +101,7 @@ namespace Opm {
         result.m_nosim = true;
         result.m_base_name = "test3";
         result.ecl_compatible_rst = false;
+        result.compressed_output = true;
 
         return result;
     }
@@ -179,6 +180,16 @@ namespace Opm {
     }
 
 
+    bool IOConfig::getCompressedOutput() const {
+        return this->compressed_output;
+    }
+
+
+    void IOConfig::setCompressedOutput(bool compressed) {
+        this->compressed_output = compressed;
+    }
+
+
     void IOConfig::overrideNOSIM(bool nosim) {
         m_nosim = nosim;
     }
@@ -289,7 +300,8 @@ namespace Opm {
                this->getOutputDir() == data.getOutputDir() &&
                this->initOnly() == data.initOnly() &&
                this->getBaseName() == data.getBaseName() &&
-               this->getEclCompatibleRST() == data.getEclCompatibleRST();
+               this->getEclCompatibleRST() == data.getEclCompatibleRST() &&
+               this->getCompressedOutput() == data.getCompressedOutput();
     }
 
 
@@ -25,6 +25,7 @@
 
 #include <opm/input/eclipse/Schedule/Action/ActionAST.hpp>
 #include <opm/input/eclipse/Schedule/Action/ActionContext.hpp>
+#include <opm/input/eclipse/Schedule/Action/ActionProgram.hpp>
 #include <opm/input/eclipse/Schedule/Action/ActionValue.hpp>
 #include <opm/input/eclipse/Schedule/Action/ASTNode.hpp>
 
@@ -36,12 +37,38 @@ namespace Action {
 AST::AST(const std::vector<std::string>& tokens) {
     auto condition_node = Action::Parser::parse(tokens);
     this->condition.reset( new Action::ASTNode(condition_node) );
+    this->compile();
+}
+
+AST::AST(const AST& other)
+    : condition(other.condition)
+{
+    if (other.program)
+        this->program = std::make_shared<const Program>(*other.program);
+}
+
+AST& AST::operator=(const AST& other) {
+    if (this != &other) {
+        this->condition = other.condition;
+        this->program.reset();
+        if (other.program)
+            this->program = std::make_shared<const Program>(*other.program);
+    }
+    return *this;
+}
+
+void AST::compile() {
+    if (this->condition)
+        this->program = Program::compile(*this->condition);
+    else
+        this->program.reset();
 }
 
 AST AST::serializationTestObject()
 {
     AST result;
     result.condition = std::make_shared<ASTNode>(ASTNode::serializationTestObject());
+    result.compile();
 
     return result;
 }
@@ -49,6 +76,8 @@ AST AST::serializationTestObject()
 Action::Result AST::eval(const Action::Context& context) const {
     if (!this->condition || this->condition->empty())
         return Action::Result(false);
+    else if (this->program)
+        return this->program->eval(context);
     else
         return this->condition->eval(context);
 }
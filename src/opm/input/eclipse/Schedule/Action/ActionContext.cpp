@@ -20,6 +20,9 @@
 #include <opm/input/eclipse/Schedule/Action/ActionContext.hpp>
 #include <opm/common/utility/TimeService.hpp>
 
+#include <stdexcept>
+#include <utility>
+
 namespace Opm {
 namespace Action {
 
@@ -35,6 +38,12 @@ namespace Action {
             this->add(pair.first, pair.second);
     }
 
+    Context::Context(SummaryState& summary_state_arg, const WListManager& wlm_) :
+        Context(std::as_const(summary_state_arg), wlm_)
+    {
+        this->handle_registry = &summary_state_arg;
+    }
+
     void Context::add(const std::string& func, double value) {
         this->values[func] = value;
     }
@@ -53,6 +62,26 @@ namespace Action {
     }
 
 
+    SummaryState::Handle Context::handle(const std::string& key) const {
+        if (this->handle_registry == nullptr)
+            throw std::logic_error("Can not register SummaryState handles in a context with a const SummaryState");
+
+        return this->handle_registry->handle(key);
+    }
+
+    std::size_t Context::handle_owner() const {
+        return (this->handle_registry == nullptr) ? 0 : this->summary_state.handle_owner();
+    }
+
+    double Context::get(SummaryState::Handle handle, const std::string& key) const {
+        const auto& iter = this->values.find(key);
+        if (iter != this->values.end())
+            return iter->second;
+
+        return this->summary_state.get(handle);
+    }
+
+
     std::vector<std::string> Context::wells(const std::string& key) const {
         return this->summary_state.wells(key);
     }
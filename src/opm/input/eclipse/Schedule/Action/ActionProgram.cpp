@@ -0,0 +1,357 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/input/eclipse/Schedule/Action/ActionProgram.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include <opm/input/eclipse/Schedule/Action/ActionContext.hpp>
+#include <opm/input/eclipse/Schedule/Action/ASTNode.hpp>
+#include <opm/input/eclipse/Schedule/Well/WListManager.hpp>
+#include <opm/common/utility/shmatch.hpp>
+
+namespace Opm {
+namespace Action {
+
+namespace {
+
+constexpr std::size_t word_bits = 64;
+
+bool is_comparison(TokenType type) {
+    return type == TokenType::op_gt ||
+           type == TokenType::op_ge ||
+           type == TokenType::op_lt ||
+           type == TokenType::op_le ||
+           type == TokenType::op_eq ||
+           type == TokenType::op_ne;
+}
+
+bool eval_cmp_scalar(double lhs, TokenType op, double rhs) {
+    switch (op) {
+    case TokenType::op_eq:
+        return lhs == rhs;
+    case TokenType::op_ge:
+        return lhs >= rhs;
+    case TokenType::op_le:
+        return lhs <= rhs;
+    case TokenType::op_ne:
+        return lhs != rhs;
+    case TokenType::op_gt:
+        return lhs > rhs;
+    case TokenType::op_lt:
+        return lhs < rhs;
+    default:
+        throw std::invalid_argument("Incorrect operator type - expected comparison");
+    }
+}
+
+void set_bit(std::vector<std::uint64_t>& bits, std::size_t index) {
+    if (bits.size() <= index / word_bits)
+        bits.resize(index / word_bits + 1, 0);
+
+    bits[index / word_bits] |= std::uint64_t{1} << (index % word_bits);
+}
+
+}
+
+
+std::shared_ptr<const Program> Program::compile(const ASTNode& condition) {
+    if (condition.empty())
+        return {};
+
+    std::shared_ptr<Program> program(new Program());
+    if (!program->compile_node(condition, program->root))
+        return {};
+
+    program->caches.resize(program->num_caches);
+    return program;
+}
+
+
+bool Program::compile_node(const ASTNode& ast_node, Node& node) {
+    node.type = ast_node.type;
+
+    if (ast_node.type == TokenType::op_and || ast_node.type == TokenType::op_or) {
+        for (const auto& ast_child : ast_node.children) {
+            if (ast_child.empty())
+                return false;
+
+            node.children.emplace_back();
+            if (!this->compile_node(ast_child, node.children.back()))
+                return false;
+        }
+        return true;
+    }
+
+    if (!is_comparison(ast_node.type) || ast_node.children.size() < 2)
+        return false;
+
+    const auto& lhs = ast_node.children[0];
+    const auto& rhs = ast_node.children[1];
+    if (!this->compile_operand(lhs, node.lhs) || !this->compile_operand(rhs, node.rhs))
+        return false;
+
+    // The right hand side must be a scalar.
+    if (node.rhs.kind != Kind::Number && node.rhs.kind != Kind::Scalar)
+        return false;
+
+    // Numeric months are rounded before comparison, i.e. MNTH = 4.3 is true in April.
+    if (lhs.func_type == FuncType::time_month && rhs.type == TokenType::number)
+        node.rhs.number = std::round(node.rhs.number);
+
+    return true;
+}
+
+
+bool Program::compile_operand(const ASTNode& ast_node, Operand& operand) {
+    if (!ast_node.empty())
+        return false;
+
+    if (ast_node.type == TokenType::number) {
+        operand.kind = Kind::Number;
+        operand.number = ast_node.number;
+        return true;
+    }
+
+    const auto& arg_list = ast_node.arg_list;
+    if (arg_list.empty()) {
+        operand.kind = Kind::Scalar;
+        operand.key = ast_node.func;
+        operand.handle = this->keys.size();
+        this->keys.push_back(operand.key);
+        return true;
+    }
+
+    if ((arg_list.size() == 1) && (arg_list[0].find('*') != std::string::npos)) {
+        if (ast_node.func_type != FuncType::well)
+            return false;
+
+        const auto& well_arg = arg_list[0];
+        operand.kind = (well_arg[0] == '*' && well_arg.size() > 1) ? Kind::WList : Kind::WellPattern;
+        operand.func = ast_node.func;
+        operand.pattern = well_arg;
+        operand.cache = this->num_caches++;
+        return true;
+    }
+
+    operand.key = ast_node.func;
+    for (const auto& arg : arg_list)
+        operand.key += ":" + arg;
+
+    if (ast_node.func_type == FuncType::well) {
+        operand.kind = Kind::Well;
+        operand.well = this->well_index(arg_list[0]);
+    } else
+        operand.kind = Kind::Scalar;
+
+    operand.handle = this->keys.size();
+    this->keys.push_back(operand.key);
+    return true;
+}
+
+
+std::size_t Program::well_index(const std::string& well) const {
+    const auto [iter, inserted] = this->well_lookup.emplace(well, this->well_names.size());
+    if (inserted)
+        this->well_names.push_back(well);
+
+    return iter->second;
+}
+
+
+/*
+  The wells matching a pattern are resolved against the wells which have the
+  summary variable, and the wells of a WLIST against the current content of
+  the list. As long as that input is unchanged the matching wells, their
+  summary keys and their bit index are reused.
+*/
+const Program::WellCache& Program::resolve(const Operand& operand, const Context& context) const {
+    auto& cache = this->caches[operand.cache];
+    auto source = (operand.kind == Kind::WList)
+        ? context.wlist_manager().wells(operand.pattern)
+        : context.wells(operand.func);
+
+    if (cache.valid && (source == cache.source))
+        return cache;
+
+    cache.keys.clear();
+    cache.handles.clear();
+    cache.wells.clear();
+    const ShellPattern pattern(operand.pattern);
+    for (const auto& well : source) {
+        if (operand.kind == Kind::WellPattern && !pattern.match(well))
+            continue;
+
+        cache.keys.push_back(operand.func + ":" + well);
+        if (this->handle_owner != 0)
+            cache.handles.push_back(context.handle(cache.keys.back()));
+        cache.wells.push_back(this->well_index(well));
+    }
+    cache.source = std::move(source);
+    cache.valid = true;
+    return cache;
+}
+
+
+/*
+  The handles are registered with the SummaryState of the first context, and
+  registered again - together with the handles of the resolved well sets -
+  whenever the program is evaluated with a different SummaryState. With a
+  context which can not register handles the handle owner is zero, and the
+  values are read by key.
+*/
+void Program::bind(const Context& context) const {
+    if (this->handle_owner == context.handle_owner())
+        return;
+
+    this->handle_owner = context.handle_owner();
+    this->handles.clear();
+    if (this->handle_owner != 0) {
+        for (const auto& key : this->keys)
+            this->handles.push_back(context.handle(key));
+    }
+
+    for (auto& cache : this->caches)
+        cache.valid = false;
+}
+
+
+double Program::value(const Operand& operand, const Context& context) const {
+    if (operand.kind == Kind::Number)
+        return operand.number;
+
+    if (this->handle_owner == 0)
+        return context.get(operand.key);
+
+    return context.get(this->handles[operand.handle], operand.key);
+}
+
+
+Program::Truth Program::eval_cmp(const Node& node, const Context& context) const {
+    const auto& lhs = node.lhs;
+    const auto& rhs = node.rhs;
+
+    Truth truth;
+    switch (lhs.kind) {
+    case Kind::Number:
+    case Kind::Scalar: {
+        const double lhs_value = this->value(lhs, context);
+        const double rhs_value = this->value(rhs, context);
+        truth.value = eval_cmp_scalar(lhs_value, node.type, rhs_value);
+        return truth;
+    }
+
+    case Kind::Well: {
+        const double lhs_value = this->value(lhs, context);
+        const double rhs_value = this->value(rhs, context);
+        truth.has_wells = true;
+        if (eval_cmp_scalar(lhs_value, node.type, rhs_value)) {
+            truth.value = true;
+            set_bit(truth.wells, lhs.well);
+        }
+        return truth;
+    }
+
+    case Kind::WellPattern:
+    case Kind::WList: {
+        const auto& cache = this->resolve(lhs, context);
+        std::vector<double> values;
+        values.reserve(cache.keys.size());
+        for (std::size_t index = 0; index < cache.keys.size(); index++)
+            values.push_back((this->handle_owner == 0)
+                             ? context.get(cache.keys[index])
+                             : context.get(cache.handles[index], cache.keys[index]));
+
+        const double rhs_value = this->value(rhs, context);
+        truth.has_wells = true;
+        for (std::size_t index = 0; index < values.size(); index++) {
+            if (eval_cmp_scalar(values[index], node.type, rhs_value)) {
+                truth.value = true;
+                set_bit(truth.wells, cache.wells[index]);
+            }
+        }
+        return truth;
+    }
+    }
+
+    throw std::logic_error("Unhandled operand in ACTIONX condition");
+}
+
+
+/*
+  The combination of the matching wells follows Result::operator|=() and
+  Result::operator&=(); a result without any well information does not
+  change the well set of the other operand.
+*/
+Program::Truth Program::eval_node(const Node& node, const Context& context) const {
+    if (node.type != TokenType::op_and && node.type != TokenType::op_or)
+        return this->eval_cmp(node, context);
+
+    const bool is_and = (node.type == TokenType::op_and);
+    Truth result;
+    result.value = is_and;
+    for (const auto& child : node.children) {
+        auto other = this->eval_node(child, context);
+        result.value = is_and ? (result.value && other.value) : (result.value || other.value);
+        if (!other.has_wells)
+            continue;
+
+        if (!result.has_wells) {
+            result.has_wells = true;
+            result.wells = std::move(other.wells);
+            continue;
+        }
+
+        if (is_and) {
+            result.wells.resize(std::min(result.wells.size(), other.wells.size()));
+            for (std::size_t word = 0; word < result.wells.size(); word++)
+                result.wells[word] &= other.wells[word];
+        } else {
+            result.wells.resize(std::max(result.wells.size(), other.wells.size()), 0);
+            for (std::size_t word = 0; word < other.wells.size(); word++)
+                result.wells[word] |= other.wells[word];
+        }
+    }
+
+    return result;
+}
+
+
+Result Program::eval(const Context& context) const {
+    this->bind(context);
+    const auto truth = this->eval_node(this->root, context);
+    if (!truth.has_wells)
+        return Result(truth.value);
+
+    WellSet wells;
+    for (std::size_t word = 0; word < truth.wells.size(); word++) {
+        auto bits = truth.wells[word];
+        for (std::size_t bit = 0; bits != 0; bit++, bits >>= 1) {
+            if (bits & 1)
+                wells.add(this->well_names[word * word_bits + bit]);
+        }
+    }
+
+    return Result(truth.value, wells);
+}
+
+}
+}
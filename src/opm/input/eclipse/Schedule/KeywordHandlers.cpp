@@ -928,15 +928,21 @@ File {} line {}.)", wname, location.keyword, location.filename, location.lineno)
     }
 
     void Schedule::handleVFPINJ(HandlerContext& handlerContext) {
-        auto table = VFPInjTable(handlerContext.keyword, this->m_static.m_unit_system);
+        auto table = this->prepared_keywords.take<VFPInjTable>(handlerContext.keyword);
+        if (!table.has_value())
+            table = VFPInjTable(handlerContext.keyword, this->m_static.m_unit_system);
+
         this->snapshots.back().events().addEvent( ScheduleEvents::VFPINJ_UPDATE );
-        this->snapshots.back().vfpinj.update( std::move(table) );
+        this->snapshots.back().vfpinj.update( std::move(*table) );
     }
 
     void Schedule::handleVFPPROD(HandlerContext& handlerContext) {
-        auto table = VFPProdTable(handlerContext.keyword, this->m_static.gaslift_opt_active, this->m_static.m_unit_system);
+        auto table = this->prepared_keywords.take<VFPProdTable>(handlerContext.keyword);
+        if (!table.has_value())
+            table = VFPProdTable(handlerContext.keyword, this->m_static.gaslift_opt_active, this->m_static.m_unit_system);
+
         this->snapshots.back().events().addEvent( ScheduleEvents::VFPPROD_UPDATE );
-        this->snapshots.back().vfpprod.update( std::move(table) );
+        this->snapshots.back().vfpprod.update( std::move(*table) );
     }
 
     void Schedule::handleWCONHIST(HandlerContext& handlerContext) {
@@ -1388,7 +1394,11 @@ File {} line {}.)", wname, location.keyword, location.filename, location.lineno)
         const auto& wname = record1.getItem("WELL").getTrimmedString(0);
         if (this->hasWell(wname, handlerContext.currentStep)) {
             auto well = this->snapshots.back().wells.get(wname);
-            if (well.handleWELSEGS(handlerContext.keyword))
+            auto segments = this->prepared_keywords.take<WellSegments>(handlerContext.keyword);
+            if (segments.has_value() && !well.isMultiSegment()) {
+                well.updateSegments( std::make_shared<WellSegments>(std::move(*segments)) );
+                this->snapshots.back().wells.update( std::move(well) );
+            } else if (well.handleWELSEGS(handlerContext.keyword))
                 this->snapshots.back().wells.update( std::move(well) );
         } else {
             const auto& location = handlerContext.keyword.location();
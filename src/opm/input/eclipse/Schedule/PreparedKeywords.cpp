@@ -0,0 +1,144 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/input/eclipse/Schedule/PreparedKeywords.hpp>
+
+#include <utility>
+
+#include <opm/common/OpmLog/OpmLog.hpp>
+#include <opm/input/eclipse/Deck/DeckKeyword.hpp>
+#include <opm/input/eclipse/Parser/ParserKeywords/A.hpp>
+#include <opm/input/eclipse/Parser/ParserKeywords/E.hpp>
+#include <opm/input/eclipse/Parser/ParserKeywords/V.hpp>
+#include <opm/input/eclipse/Parser/ParserKeywords/W.hpp>
+#include <opm/input/eclipse/Schedule/ScheduleDeck.hpp>
+#include <opm/input/eclipse/Units/UnitSystem.hpp>
+
+namespace Opm {
+
+namespace {
+
+bool is_prepared(const DeckKeyword& keyword) {
+    return keyword.is<ParserKeywords::VFPPROD>() ||
+           keyword.is<ParserKeywords::VFPINJ>() ||
+           keyword.is<ParserKeywords::WELSEGS>();
+}
+
+std::variant<VFPProdTable, VFPInjTable, WellSegments>
+prepare(const DeckKeyword& keyword,
+        bool gaslift_opt_active,
+        const UnitSystem& unit_system,
+        std::vector<std::string>& warnings)
+{
+    if (keyword.is<ParserKeywords::VFPPROD>())
+        return VFPProdTable(keyword, gaslift_opt_active, unit_system, &warnings);
+
+    if (keyword.is<ParserKeywords::VFPINJ>())
+        return VFPInjTable(keyword, unit_system, &warnings);
+
+    return WellSegments(keyword);
+}
+
+}
+
+
+PreparedKeywords::PreparedKeywords(const ScheduleDeck& sched_deck,
+                                   std::size_t load_start,
+                                   std::size_t load_end,
+                                   bool gaslift_opt_active,
+                                   const UnitSystem& unit_system)
+{
+    /*
+      The keywords inside an ACTIONX block are not processed when the
+      schedule is loaded, only later when the action runs.
+    */
+    std::vector<const DeckKeyword*> keywords;
+    for (auto report_step = load_start; report_step < load_end; report_step++) {
+        bool in_action = false;
+        for (const auto& keyword : sched_deck[report_step]) {
+            if (keyword.is<ParserKeywords::ACTIONX>())
+                in_action = true;
+            else if (keyword.is<ParserKeywords::ENDACTIO>())
+                in_action = false;
+            else if (!in_action && is_prepared(keyword))
+                keywords.push_back(&keyword);
+        }
+    }
+
+    /*
+      Every keyword is only accessed by one thread; the DeckItem conversion
+      between raw and SI values is therefore safe.
+    */
+    std::vector<std::optional<Entry>> results(keywords.size());
+    #pragma omp parallel for schedule(dynamic)
+    for (std::size_t index = 0; index < keywords.size(); index++) {
+        const auto& keyword = *keywords[index];
+        std::vector<std::string> warnings;
+        try {
+            auto value = prepare(keyword, gaslift_opt_active, unit_system, warnings);
+            results[index].emplace(Entry{ std::move(value), std::move(warnings) });
+        } catch (...) {
+            results[index].reset();
+        }
+    }
+
+    for (std::size_t index = 0; index < keywords.size(); index++) {
+        if (results[index].has_value())
+            this->entries.emplace(keywords[index], std::move(*results[index]));
+    }
+}
+
+
+PreparedKeywords::PreparedKeywords(const PreparedKeywords&)
+{}
+
+
+PreparedKeywords& PreparedKeywords::operator=(const PreparedKeywords&) {
+    this->entries.clear();
+    return *this;
+}
+
+
+template <typename T>
+std::optional<T> PreparedKeywords::take(const DeckKeyword& keyword) {
+    auto iter = this->entries.find(&keyword);
+    if (iter == this->entries.end())
+        return std::nullopt;
+
+    auto entry = std::move(iter->second);
+    this->entries.erase(iter);
+    if (!std::holds_alternative<T>(entry.value))
+        return std::nullopt;
+
+    for (const auto& msg : entry.warnings)
+        OpmLog::warning(msg);
+
+    return std::get<T>(std::move(entry.value));
+}
+
+
+std::size_t PreparedKeywords::size() const {
+    return this->entries.size();
+}
+
+template std::optional<VFPProdTable> PreparedKeywords::take(const DeckKeyword& keyword);
+template std::optional<VFPInjTable> PreparedKeywords::take(const DeckKeyword& keyword);
+template std::optional<WellSegments> PreparedKeywords::take(const DeckKeyword& keyword);
+
+}
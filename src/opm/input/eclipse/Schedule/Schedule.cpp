@@ -26,7 +26,6 @@
 #include <opm/common/utility/OpmInputError.hpp>
 #include <opm/common/utility/String.hpp>
 #include <opm/common/utility/numeric/cmp.hpp>
-#include <opm/common/utility/shmatch.hpp>
 
 #include <opm/input/eclipse/EclipseState/EclipseState.hpp>
 #include <opm/input/eclipse/EclipseState/TracerConfig.hpp>
@@ -102,10 +101,6 @@
 
 namespace {
 
-    bool name_match(const std::string& pattern, const std::string& name) {
-        return Opm::shmatch(pattern, name);
-    }
-
     double sumthin_summary_section(const Opm::SUMMARYSection& section) {
         const auto entries = section.getKeywordList<Opm::ParserKeywords::SUMTHIN>();
 
@@ -310,6 +305,7 @@ Schedule::Schedule(const Deck& deck, const EclipseState& es, const std::optional
     std::time_t Schedule::posixEndTime() const {
         // This should indeed access the start_time() property of the last
         // snapshot.
+        this->materialize();
         return std::chrono::system_clock::to_time_t(this->snapshots.back().start_time());
     }
 
@@ -479,7 +475,8 @@ void Schedule::iterateScheduleSection(std::size_t load_start, std::size_t load_e
                                       const ScheduleGrid& grid,
                                       const std::unordered_map<std::string, double> * target_wellpi,
                                       const std::string& prefix,
-                                      const bool log_to_debug) {
+                                      const bool log_to_debug,
+                                      const bool log_header) {
 
         std::vector<std::pair< const DeckKeyword* , std::size_t> > rftProperties;
         std::string time_unit = this->m_static.m_unit_system.name(UnitSystem::measure::time);
@@ -512,8 +509,9 @@ void Schedule::iterateScheduleSection(std::size_t load_start, std::size_t load_e
                               prefix, this->m_sched_deck.location());
         {
             const auto& location = this->m_sched_deck.location();
-            logger({"", "Processing dynamic information from", fmt::format("{} line {}", location.filename, location.lineno)});
-            if (restart_skip && !log_to_debug) {
+            if (log_header)
+                logger({"", "Processing dynamic information from", fmt::format("{} line {}", location.filename, location.lineno)});
+            if (log_header && restart_skip && !log_to_debug) {
                 logger.info(fmt::format("This is a restarted run - skipping "
                                         "until report step {} at {}",
                                         this->m_static.rst_info.report_step,
@@ -529,6 +527,12 @@ void Schedule::iterateScheduleSection(std::size_t load_start, std::size_t load_e
                                location.lineno));
         }
 
+        this->prepared_keywords = PreparedKeywords(this->m_sched_deck,
+                                                   load_start,
+                                                   load_end,
+                                                   this->m_static.gaslift_opt_active,
+                                                   this->m_static.m_unit_system);
+
         for (auto report_step = load_start; report_step < load_end; report_step++) {
             std::size_t keyword_index = 0;
             auto& block = this->m_sched_deck[report_step];
@@ -616,6 +620,8 @@ void Schedule::iterateScheduleSection(std::size_t load_start, std::size_t load_e
                 this->restart_output.addRestartOutput(report_step);
             }
         } // for (auto report_step = load_start
+
+        this->prepared_keywords = PreparedKeywords{};
     }
 
     void Schedule::applyGlobalWPIMULT( const std::unordered_map<std::string, double>& wpimult_global_factor) {
@@ -722,14 +728,17 @@ void Schedule::iterateScheduleSection(std::size_t load_start, std::size_t load_e
     }
 
     void Schedule::shut_well(const std::string& well_name, std::size_t report_step) {
+        this->materialize();
         this->updateWellStatus(well_name, report_step, Well::Status::SHUT);
     }
 
     void Schedule::open_well(const std::string& well_name, std::size_t report_step) {
+        this->materialize();
         this->updateWellStatus(well_name, report_step, Well::Status::OPEN);
     }
 
     void Schedule::stop_well(const std::string& well_name, std::size_t report_step) {
+        this->materialize();
         this->updateWellStatus(well_name, report_step, Well::Status::STOP);
     }
 
@@ -792,6 +801,7 @@ void Schedule::iterateScheduleSection(std::size_t load_start, std::size_t load_e
 
 
     std::optional<std::size_t> Schedule::first_RFT() const {
+        this->materialize();
         for (std::size_t report_step = 0; report_step < this->snapshots.size(); report_step++) {
             if (this->snapshots[report_step].rft_config().active())
                 return report_step;
@@ -953,6 +963,7 @@ void Schedule::iterateScheduleSection(std::size_t load_start, std::size_t load_e
 
 
     std::size_t Schedule::numWells() const {
+        this->materialize();
         return this->snapshots.back().wells.size();
     }
 
@@ -962,18 +973,22 @@ void Schedule::iterateScheduleSection(std::size_t load_start, std::size_t load_e
     }
 
     bool Schedule::hasWell(const std::string& wellName) const {
+        this->materialize();
         return this->snapshots.back().wells.has(wellName);
     }
 
     bool Schedule::hasWell(const std::string& wellName, std::size_t timeStep) const {
+        this->materialize(timeStep);
         return this->snapshots[timeStep].wells.has(wellName);
     }
 
     bool Schedule::hasGroup(const std::string& groupName, std::size_t timeStep) const {
+        this->materialize(timeStep);
         return this->snapshots[timeStep].groups.has(groupName);
     }
 
     std::vector< const Group* > Schedule::getChildGroups2(const std::string& group_name, std::size_t timeStep) const {
+        this->materialize(timeStep);
         const auto& sched_state = this->snapshots[timeStep];
         const auto& group = sched_state.groups.get(group_name);
 
@@ -985,6 +1000,7 @@ void Schedule::iterateScheduleSection(std::size_t load_start, std::size_t load_e
     }
 
     std::vector< Well > Schedule::getChildWells2(const std::string& group_name, std::size_t timeStep) const {
+        this->materialize(timeStep);
         const auto& sched_state = this->snapshots[timeStep];
         const auto& group = sched_state.groups.get(group_name);
 
@@ -1009,6 +1025,7 @@ void Schedule::iterateScheduleSection(std::size_t load_start, std::size_t load_e
       settings have changed will not be included.
     */
     std::vector<std::string> Schedule::changed_wells(std::size_t report_step) const {
+        this->materialize(report_step);
         std::vector<std::string> wells;
         const auto& state = this->snapshots[report_step];
         const auto& all_wells = state.wells();
@@ -1033,30 +1050,37 @@ void Schedule::iterateScheduleSection(std::size_t load_start, std::size_t load_e
 
 
     std::vector<Well> Schedule::getWells(std::size_t timeStep) const {
-        std::vector<Well> wells;
-        if (timeStep >= this->snapshots.size())
-            throw std::invalid_argument("timeStep argument beyond the length of the simulation");
+        const auto wells = this->getWellsView(timeStep);
+        return { wells.begin(), wells.end() };
+    }
 
-        const auto& well_order = this->snapshots[timeStep].well_order();
-        for (const auto& wname : well_order)
-            wells.push_back( this->snapshots[timeStep].wells.get(wname) );
+    std::vector<Well> Schedule::getWellsatEnd() const {
+        return this->getWells(this->last_step());
+    }
 
-        return wells;
+    ScheduleState::WellsView Schedule::getWellsView(std::size_t timeStep) const {
+        if (timeStep >= this->size())
+            throw std::invalid_argument("timeStep argument beyond the length of the simulation");
+
+        this->materialize(timeStep);
+        return this->snapshots[timeStep].wells_view();
     }
 
-    std::vector<Well> Schedule::getWellsatEnd() const {
-        return this->getWells(this->snapshots.size() - 1);
+    ScheduleState::WellsView Schedule::getWellsViewatEnd() const {
+        return this->getWellsView(this->last_step());
     }
 
     const Well& Schedule::getWellatEnd(const std::string& well_name) const {
-        return this->getWell(well_name, this->snapshots.size() - 1);
+        return this->getWell(well_name, this->last_step());
     }
 
     const Well& Schedule::getWell(const std::string& wellName, std::size_t timeStep) const {
+        this->materialize(timeStep);
         return this->snapshots[timeStep].wells.get(wellName);
     }
 
     const Well& Schedule::getWell(std::size_t well_index, std::size_t timeStep) const {
+        this->materialize(timeStep);
         const auto find_pred = [well_index] (const auto& well_pair) -> bool
         {
             return well_pair.second->seqIndex() == well_index;
@@ -1070,6 +1094,7 @@ void Schedule::iterateScheduleSection(std::size_t load_start, std::size_t load_e
     }
 
     const Group& Schedule::getGroup(const std::string& groupName, std::size_t timeStep) const {
+        this->materialize(timeStep);
         return this->snapshots[timeStep].groups.get(groupName);
     }
 
@@ -1124,25 +1149,28 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
     WellMatcher Schedule::wellMatcher(std::size_t report_step) const {
         const ScheduleState * sched_state;
 
+        this->materialize(report_step);
         if (report_step < this->snapshots.size())
             sched_state = &this->snapshots[report_step];
         else
             sched_state = &this->snapshots.back();
 
-        return WellMatcher(sched_state->well_order.get(), sched_state->wlist_manager.get());
+        return WellMatcher(sched_state->well_order.shared(), sched_state->wlist_manager.shared());
     }
 
 
     std::vector<std::string> Schedule::wellNames(const std::string& pattern) const {
-        return this->wellNames(pattern, this->size() - 1);
+        return this->wellNames(pattern, this->last_step());
     }
 
     std::vector<std::string> Schedule::wellNames(std::size_t timeStep) const {
+        this->materialize(timeStep);
         const auto& well_order = this->snapshots[timeStep].well_order();
         return well_order.names();
     }
 
     std::vector<std::string> Schedule::wellNames() const {
+        this->materialize();
         const auto& well_order = this->snapshots.back().well_order();
         return well_order.names();
     }
@@ -1151,18 +1179,13 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
         if (pattern.size() == 0)
             return {};
 
+        this->materialize(timeStep);
         const auto& group_order = this->snapshots[timeStep].group_order();
 
         // Normal pattern matching
         auto star_pos = pattern.find('*');
-        if (star_pos != std::string::npos) {
-            std::vector<std::string> names;
-            for (const auto& gname : group_order) {
-                if (name_match(pattern, gname))
-                    names.push_back(gname);
-            }
-            return names;
-        }
+        if (star_pos != std::string::npos)
+            return group_order.match(pattern);
 
         // Normal group name without any special characters
         if (group_order.has(pattern))
@@ -1172,20 +1195,23 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
     }
 
     std::vector<std::string> Schedule::groupNames(std::size_t timeStep) const {
+        this->materialize(timeStep);
         const auto& group_order = this->snapshots[timeStep].group_order();
         return group_order.names();
     }
 
     std::vector<std::string> Schedule::groupNames(const std::string& pattern) const {
-        return this->groupNames(pattern, this->snapshots.size() - 1);
+        return this->groupNames(pattern, this->last_step());
     }
 
     std::vector<std::string> Schedule::groupNames() const {
+        this->materialize();
         const auto& group_order = this->snapshots.back().group_order();
         return group_order.names();
     }
 
     std::vector<const Group*> Schedule::restart_groups(std::size_t timeStep) const {
+        this->materialize(timeStep);
         const auto& restart_groups = this->snapshots[timeStep].group_order().restart_groups();
         std::vector<const Group*> rst_groups(restart_groups.size() , nullptr );
         for (std::size_t restart_index = 0; restart_index < restart_groups.size(); restart_index++) {
@@ -1319,6 +1345,7 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
 
 
     void Schedule::filterConnections(const ActiveGridCells& grid) {
+        this->materialize();
         for (auto& sched_state : this->snapshots) {
             for (auto& well : sched_state.wells()) {
                 well.get().filterConnections(grid);
@@ -1328,6 +1355,7 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
 
 
     const UDQConfig& Schedule::getUDQConfig(std::size_t timeStep) const {
+        this->materialize(timeStep);
         return this->snapshots[timeStep].udq.get();
     }
 
@@ -1336,6 +1364,10 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
     }
 
     std::size_t Schedule::size() const {
+        const auto replay_end = this->replay_cache.end.load(std::memory_order_acquire);
+        if (replay_end > 0)
+            return replay_end;
+
         return this->snapshots.size();
     }
 
@@ -1344,18 +1376,22 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
         if (this->snapshots.empty())
             return 0;
 
-        if (timeStep >= this->snapshots.size())
-            throw std::logic_error(fmt::format("seconds({}) - invalid timeStep. Valid range [0,{}>", timeStep, this->snapshots.size()));
+        if (timeStep >= this->size())
+            throw std::logic_error(fmt::format("seconds({}) - invalid timeStep. Valid range [0,{}>", timeStep, this->size()));
+
+        this->materialize(timeStep);
 
         auto elapsed = this->snapshots[timeStep].start_time() - this->snapshots[0].start_time();
         return std::chrono::duration_cast<std::chrono::seconds>(elapsed).count();
     }
 
     std::time_t Schedule::simTime(std::size_t timeStep) const {
+        this->materialize(timeStep);
         return std::chrono::system_clock::to_time_t( this->snapshots[timeStep].start_time() );
     }
 
     double Schedule::stepLength(std::size_t timeStep) const {
+        this->materialize(timeStep);
         const auto start = this->snapshots[timeStep].start_time();
         const auto end = this->snapshots[timeStep].end_time();
         if (start > end) {
@@ -1380,6 +1416,7 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
         std::unordered_map<std::string, double> target_wellpi;
         std::vector<std::string> matching_wells;
         const std::string prefix = "| "; /* logger prefix string */
+        this->materialize(reportStep);
         this->snapshots.resize(reportStep + 1);
         auto& input_block = this->m_sched_deck[reportStep];
         std::unordered_map<std::string, double> wpimult_global_factor;
@@ -1399,16 +1436,8 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
         }
         this->applyGlobalWPIMULT(wpimult_global_factor);
         this->end_report(reportStep);
-        if (reportStep < this->m_sched_deck.size() - 1) {
-            iterateScheduleSection(
-                reportStep + 1,
-                this->m_sched_deck.size(),
-                parseContext,
-                errors,
-                grid,
-                &target_wellpi,
-                prefix);
-        }
+        if (reportStep < this->m_sched_deck.size() - 1)
+            this->defer_replay(reportStep, target_wellpi, prefix, false);
     }
 
 
@@ -1421,6 +1450,7 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
 
         OpmLog::debug("/----------------------------------------------------------------------");
         OpmLog::debug(fmt::format("{0}Action {1} triggered. Will add action keywords and\n{0}rerun Schedule section.\n{0}", prefix, action.name()));
+        this->materialize(reportStep);
         this->snapshots.resize(reportStep + 1);
         auto& input_block = this->m_sched_deck[reportStep];
         std::unordered_map<std::string, double> wpimult_global_factor;
@@ -1450,9 +1480,7 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
 
         if (reportStep < this->m_sched_deck.size() - 1) {
             const auto log_to_debug = true;
-            this->iterateScheduleSection(reportStep + 1, this->m_sched_deck.size(),
-                                         parseContext, errors, grid, &target_wellpi,
-                                         prefix, log_to_debug);
+            this->defer_replay(reportStep, target_wellpi, prefix, log_to_debug);
         }
         OpmLog::debug("\\----------------------------------------------------------------------");
 
@@ -1460,12 +1488,87 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
     }
 
 
+    void Schedule::defer_replay(std::size_t report_step,
+                                const std::unordered_map<std::string, double>& target_wellpi,
+                                const std::string& prefix,
+                                bool log_to_debug) {
+        this->snapshots.reserve(this->m_sched_deck.size());
+        this->replay_cache.pending = PendingReplay{ this->m_sched_deck.size(), target_wellpi, prefix, log_to_debug };
+        this->replay_cache.end.store(this->m_sched_deck.size(), std::memory_order_release);
+        OpmLog::debug(fmt::format("{}Report steps {}-{} will be reprocessed when requested", prefix, report_step + 1, this->m_sched_deck.size() - 1));
+    }
+
+
+    /*
+      Reprocess the deferred report steps up to and including report_step,
+      see defer_replay(). This is called from const accessors, i.e. the
+      snapshots vector is a cache of the processed Schedule section in the
+      same way as DeckItem caches SI converted values. Errors in the
+      replayed keywords are therefore raised from the accessor which
+      requested the report step.
+    */
+    void Schedule::materialize(std::size_t report_step) const {
+        auto& cache = this->replay_cache;
+        if (cache.end.load(std::memory_order_acquire) == 0)
+            return;
+
+        std::lock_guard<std::recursive_mutex> lock(cache.mutex);
+        if (!cache.pending.has_value() || report_step < this->snapshots.size())
+            return;
+
+        // Taken out of the cache for the duration of the replay, so that
+        // the accessors used by the keyword handlers do not start another
+        // replay.
+        auto replay = std::move(cache.pending.value());
+        cache.pending.reset();
+
+        // The replay runs the same keyword handlers as the constructor,
+        // which append the new snapshots; this is the only place the
+        // Schedule is modified on behalf of a const accessor.
+        auto& self = *const_cast<Schedule*>(this);
+
+        ParseContext parseContext;
+        ErrorGuard errors;
+        ScheduleGrid grid(self.completed_cells);
+        const auto load_end = std::min(report_step + 1, replay.end);
+        try {
+            self.iterateScheduleSection(this->snapshots.size(), load_end,
+                                        parseContext, errors, grid, &replay.target_wellpi,
+                                        replay.prefix, replay.log_to_debug, !replay.started);
+        } catch (...) {
+            cache.end.store(0, std::memory_order_release);
+            throw;
+        }
+
+        if (load_end < replay.end) {
+            replay.started = true;
+            cache.pending = std::move(replay);
+        }
+        else
+            cache.end.store(0, std::memory_order_release);
+    }
+
+    void Schedule::materialize() const {
+        const auto replay_end = this->replay_cache.end.load(std::memory_order_acquire);
+        if (replay_end > 0)
+            this->materialize(replay_end - 1);
+    }
+
+    std::size_t Schedule::last_step() const {
+        this->materialize();
+
+        std::lock_guard<std::recursive_mutex> lock(this->replay_cache.mutex);
+        return this->snapshots.size() - 1;
+    }
+
+
     /*
       This function will typically be called from the apply_action_callback()
       which is invoked in a PYACTION plugin, i.e. the arguments here are
       supplied by the user in a script - can very well be wrong.
     */
     SimulatorUpdate Schedule::applyAction(std::size_t reportStep, const std::string& action_name, const std::vector<std::string>& matching_wells) {
+        this->materialize(reportStep);
         const auto& actions = this->snapshots[reportStep].actions();
         if (actions.has(action_name)) {
             const auto& action = this->snapshots[reportStep].actions()[action_name];
@@ -1560,6 +1663,7 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
     }
 
     void Schedule::applyWellProdIndexScaling(const std::string& well_name, const std::size_t reportStep, const double newWellPI) {
+        this->materialize();
         if (reportStep >= this->snapshots.size())
             return;
 
@@ -1590,11 +1694,13 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
 
     bool Schedule::write_rst_file(const std::size_t report_step) const
     {
+        this->materialize(report_step);
         return this->restart_output.writeRestartFile(report_step) || this->operator[](report_step).save();
     }
 
     bool Schedule::must_write_rst_file(const std::size_t report_step) const
     {
+        this->materialize(report_step);
         if (this->m_static.output_interval.has_value())
             return this->m_static.output_interval.value() % report_step;
 
@@ -1619,11 +1725,14 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
         if (report_step == 0)
             return this->m_static.rst_config.keywords;
 
+        this->materialize(report_step);
         const auto& keywords = this->snapshots[report_step - 1].rst_config().keywords;
         return keywords;
     }
 
     bool Schedule::operator==(const Schedule& data) const {
+        this->materialize();
+        data.materialize();
         return this->m_static == data.m_static &&
                this->m_sched_deck == data.m_sched_deck &&
                this->action_wgnames == data.action_wgnames &&
@@ -1883,6 +1992,7 @@ namespace {
 
 
     const GasLiftOpt& Schedule::glo(std::size_t report_step) const {
+        this->materialize(report_step);
         return this->snapshots[report_step].glo();
     }
 
@@ -2128,18 +2238,22 @@ bool Schedule::cmp(const Schedule& sched1, const Schedule& sched2, std::size_t r
 }
 
 const ScheduleState& Schedule::back() const {
+    this->materialize();
     return this->snapshots.back();
 }
 
 const ScheduleState& Schedule::operator[](std::size_t index) const {
+    this->materialize(index);
     return this->snapshots.at(index);
 }
 
 std::vector<ScheduleState>::const_iterator Schedule::begin() const {
+    this->materialize();
     return this->snapshots.begin();
 }
 
 std::vector<ScheduleState>::const_iterator Schedule::end() const {
+    this->materialize();
     return this->snapshots.end();
 }
 
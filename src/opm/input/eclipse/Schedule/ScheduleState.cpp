@@ -419,5 +419,10 @@ bool ScheduleState::has_gpmaint() const
     });
 }
 
+ScheduleState::WellsView ScheduleState::wells_view() const
+{
+    return WellsView(this->well_order(), this->wells);
+}
+
 
 } // namespace Opm
@@ -17,11 +17,13 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <atomic>
 #include <unordered_map>
 #include <cstring>
 #include <ctime>
 #include <iostream>
 #include <iomanip>
+#include <stdexcept>
 
 #include <opm/input/eclipse/Schedule/UDQ/UDQSet.hpp>
 #include <opm/input/eclipse/Schedule/SummaryState.hpp>
@@ -219,6 +221,7 @@ namespace {
     }
 
     bool SummaryState::erase(const std::string& key) {
+        this->handle_cache.clear();
         return (this->values.erase(key) > 0);
     }
 
@@ -347,6 +350,7 @@ namespace {
         this->sim_start = buffer.sim_start;
         this->elapsed = buffer.elapsed;
         this->values = buffer.values;
+        this->handle_cache.clear();
         this->well_names.reset();
         this->group_names.reset();
 
@@ -366,6 +370,127 @@ namespace {
     }
 
 
+    SummaryState::Handle SummaryState::add_handle(HandleType type, const std::string& key, const std::string& var, const std::string& wgname) {
+        const auto index_key = std::to_string(static_cast<int>(type)) + key;
+        const auto [iter, inserted] = this->handle_index.emplace(index_key, this->handle_slots.size());
+        if (inserted) {
+            const bool total = (type == HandleType::Key) ? is_total(key) : is_total(var);
+            this->handle_slots.push_back( HandleSlot{type, key, var, wgname, total} );
+        }
+
+        return Handle{iter->second};
+    }
+
+    SummaryState::Handle SummaryState::handle(const std::string& key) {
+        return this->add_handle(HandleType::Key, key, "", "");
+    }
+
+    SummaryState::Handle SummaryState::well_var_handle(const std::string& well, const std::string& var) {
+        return this->add_handle(HandleType::Well, var + ":" + well, var, well);
+    }
+
+    SummaryState::Handle SummaryState::group_var_handle(const std::string& group, const std::string& var) {
+        return this->add_handle(HandleType::Group, var + ":" + group, var, group);
+    }
+
+    std::size_t SummaryState::num_handles() const {
+        return this->handle_slots.size();
+    }
+
+    std::size_t SummaryState::handle_owner() const {
+        return this->owner.id;
+    }
+
+    std::size_t SummaryState::HandleOwner::next() {
+        static std::atomic<std::size_t> counter{0};
+        return ++counter;
+    }
+
+    std::pair<double*, double*>& SummaryState::resolve(Handle handle) const {
+        const auto& slot = this->handle_slots.at(handle.slot);
+        auto& pointers = this->handle_cache.pointers;
+        if (pointers.size() < this->handle_slots.size())
+            pointers.resize(this->handle_slots.size(), {nullptr, nullptr});
+
+        auto& cached = pointers[handle.slot];
+        if ((cached.first != nullptr) &&
+            ((slot.type == HandleType::Key) || (cached.second != nullptr)))
+            return cached;
+
+        const auto general_iter = this->values.find(slot.key);
+        if (general_iter == this->values.end())
+            return cached;
+
+        // A well or group variable which has only been added with the
+        // general set()/update() is resolved to the general value alone, in
+        // the same way as has(key) and get(key) only consult that map.
+        cached = { const_cast<double*>(&general_iter->second), nullptr };
+        if (slot.type != HandleType::Key) {
+            const auto& var_values = (slot.type == HandleType::Well) ? this->well_values : this->group_values;
+            const auto var_iter = var_values.find(slot.var);
+            if (var_iter == var_values.end())
+                return cached;
+
+            const auto wg_iter = var_iter->second.find(slot.wgname);
+            if (wg_iter != var_iter->second.end())
+                cached.second = const_cast<double*>(&wg_iter->second);
+        }
+
+        return cached;
+    }
+
+    void SummaryState::update(Handle handle, double value) {
+        const auto& slot = this->handle_slots.at(handle.slot);
+        auto& [general, specific] = this->resolve(handle);
+        if ((general == nullptr) || ((slot.type != HandleType::Key) && (specific == nullptr))) {
+            // First update of this value; create it with the string api.
+            switch (slot.type) {
+            case HandleType::Key:
+                this->update(slot.key, value);
+                break;
+            case HandleType::Well:
+                this->update_well_var(slot.wgname, slot.var, value);
+                break;
+            case HandleType::Group:
+                this->update_group_var(slot.wgname, slot.var, value);
+                break;
+            }
+            this->resolve(handle);
+            return;
+        }
+
+        if (slot.total) {
+            *general += value;
+            if (specific != nullptr)
+                *specific += value;
+        } else {
+            *general = value;
+            if (specific != nullptr)
+                *specific = value;
+        }
+    }
+
+    bool SummaryState::has(Handle handle) const {
+        return this->resolve(handle).first != nullptr;
+    }
+
+    double SummaryState::get(Handle handle) const {
+        const double* general = this->resolve(handle).first;
+        if (general == nullptr)
+            throw std::out_of_range("No such key: " + this->handle_slots[handle.slot].key);
+
+        return *general;
+    }
+
+    double SummaryState::get(Handle handle, double default_value) const {
+        const double* general = this->resolve(handle).first;
+        if (general == nullptr)
+            return default_value;
+
+        return *general;
+    }
+
+
     std::ostream& operator<<(std::ostream& stream, const SummaryState& st) {
         stream << "Simulated seconds: " << st.get_elapsed() << std::endl;
         for (const auto& value_pair : st)
@@ -27,6 +27,7 @@
 #include <opm/input/eclipse/Schedule/UDQ/UDQConfig.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQEnums.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQInput.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQProgram.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQState.hpp>
 
 namespace Opm {
@@ -375,23 +376,32 @@ namespace Opm {
 
 
     void UDQConfig::eval_define(std::size_t report_step, UDQState& udq_state, UDQContext& context) const {
+        /*
+          The well and group lists, their name indices and the scratch sets
+          used while evaluating the compiled programs are shared by all the
+          DEFINE statements evaluated here.
+        */
+        UDQWorkspace workspace(context);
+
         for (const auto& def : this->definitions(UDQVarType::WELL_VAR)) {
             if (udq_state.define(def.keyword(), def.status())) {
-                auto ws = def.eval(context);
+                auto ws = def.eval(workspace);
                 context.update_define(report_step, def.keyword(), ws);
+                workspace.recycle(std::move(ws));
             }
         }
 
         for (const auto& def : this->definitions(UDQVarType::GROUP_VAR)) {
             if (udq_state.define(def.keyword(), def.status())) {
-                auto ws = def.eval(context);
+                auto ws = def.eval(workspace);
                 context.update_define(report_step, def.keyword(), ws);
+                workspace.recycle(std::move(ws));
             }
         }
 
         for (const auto& def : this->definitions(UDQVarType::FIELD_VAR)) {
             if (udq_state.define(def.keyword(), def.status())) {
-                auto field_udq = def.eval(context);
+                auto field_udq = def.eval(workspace);
                 context.update_define(report_step, def.keyword(), field_udq);
             }
         }
@@ -115,6 +115,59 @@ bool is_udq(const std::string& key) {
         throw std::logic_error(fmt::format("Summary group variable: {} not registered", var));
     }
 
+    SummaryState::Handle UDQContext::handle(const std::string& key) {
+        return this->summary_state.handle(key);
+    }
+
+    SummaryState::Handle UDQContext::well_var_handle(const std::string& well, const std::string& var) {
+        return this->summary_state.well_var_handle(well, var);
+    }
+
+    SummaryState::Handle UDQContext::group_var_handle(const std::string& group, const std::string& var) {
+        return this->summary_state.group_var_handle(group, var);
+    }
+
+    std::size_t UDQContext::handle_owner() const {
+        return this->summary_state.handle_owner();
+    }
+
+    std::optional<double> UDQContext::get(const std::string& key, SummaryState::Handle handle) const {
+        if (is_udq(key))
+            return this->get(key);
+
+        const auto& pair_ptr = this->values.find(key);
+        if (pair_ptr != this->values.end())
+            return pair_ptr->second;
+
+        return this->summary_state.get(handle);
+    }
+
+    std::optional<double> UDQContext::get_well_var(const std::string& well, const std::string& var, SummaryState::Handle handle) const {
+        if (is_udq(var))
+            return this->get_well_var(well, var);
+
+        if (this->summary_state.has(handle))
+            return this->summary_state.get(handle);
+
+        if (this->summary_state.has_well_var(var))
+            return std::nullopt;
+
+        throw std::logic_error(fmt::format("Summary well variable: {} not registered", var));
+    }
+
+    std::optional<double> UDQContext::get_group_var(const std::string& group, const std::string& var, SummaryState::Handle handle) const {
+        if (is_udq(var))
+            return this->get_group_var(group, var);
+
+        if (this->summary_state.has(handle))
+            return this->summary_state.get(handle);
+
+        if (this->summary_state.has_group_var(var))
+            return std::nullopt;
+
+        throw std::logic_error(fmt::format("Summary group variable: {} not registered", var));
+    }
+
     std::vector<std::string> UDQContext::wells() const {
         return this->well_matcher.wells();
     }
@@ -28,6 +28,7 @@
 #include <opm/input/eclipse/Schedule/UDQ/UDQASTNode.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQDefine.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQEnums.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQProgram.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQToken.hpp>
 #include <opm/common/OpmLog/OpmLog.hpp>
 
@@ -197,6 +198,19 @@ UDQDefine::UDQDefine(const UDQParams& udq_params,
     }
     this->m_tokens = make_tokens(string_tokens);
     this->ast = std::make_shared<UDQASTNode>( UDQParser::parse(udq_params, this->m_var_type, this->m_keyword, this->m_location, this->m_tokens, parseContext, errors) );
+    this->compile();
+}
+
+/*
+  The program is a function of the ast alone; it is therefore not part of the
+  serialized state or the equality comparison, but rebuilt whenever the ast is
+  assigned.
+*/
+void UDQDefine::compile() {
+    if (this->ast)
+        this->program = std::make_shared<const UDQProgram>(*this->ast);
+    else
+        this->program.reset();
 }
 
 void UDQDefine::update_status(UDQUpdate update, std::size_t report_step) {
@@ -211,6 +225,7 @@ UDQDefine UDQDefine::serializationTestObject()
     UDQDefine result;
     result.m_keyword = "test1";
     result.ast = std::make_shared<UDQASTNode>(UDQASTNode::serializationTestObject());
+    result.compile();
     result.m_var_type = UDQVarType::SEGMENT_VAR;
     result.string_data = "test2";
     result.m_location = KeywordLocation{"KEYWOR", "file", 100};
@@ -245,10 +260,15 @@ void UDQDefine::required_summary(std::unordered_set<std::string>& summary_keys)
     this->ast->required_summary(summary_keys);
 }
 
-UDQSet UDQDefine::eval(const UDQContext& context) const {
+UDQSet UDQDefine::eval(UDQContext& context) const {
+    UDQWorkspace workspace(context);
+    return this->eval(workspace);
+}
+
+UDQSet UDQDefine::eval(UDQWorkspace& workspace) const {
     std::optional<UDQSet> res;
     try {
-        res = this->ast->eval(this->m_var_type, context);
+        res = this->program->eval(this->m_var_type, workspace);
         res->name( this->m_keyword );
         if (!dynamic_type_check(this->var_type(), res->var_type())) {
             std::string msg = "Invalid runtime type conversion detected when evaluating UDQ";
@@ -284,22 +304,14 @@ UDQSet UDQDefine::eval(const UDQContext& context) const {
 
         const auto& scalar_value = res->operator[](0).value();
         if (this->var_type() == UDQVarType::WELL_VAR) {
-            const std::vector<std::string> wells = context.wells();
-            UDQSet well_res = UDQSet::wells(this->m_keyword, wells);
-
-            for (const auto& well : wells)
-                well_res.assign(well, scalar_value);
-
+            UDQSet well_res = workspace.well_set(this->m_keyword);
+            well_res.assign(scalar_value);
             return well_res;
         }
 
         if (this->var_type() == UDQVarType::GROUP_VAR) {
-            const std::vector<std::string> groups = context.groups();
-            UDQSet group_res = UDQSet::groups(this->m_keyword, groups);
-
-            for (const auto& group : groups)
-                group_res.assign(group, scalar_value);
-
+            UDQSet group_res = workspace.group_set(this->m_keyword);
+            group_res.assign(scalar_value);
             return group_res;
         }
     }
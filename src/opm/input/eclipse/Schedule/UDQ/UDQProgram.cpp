@@ -0,0 +1,463 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/input/eclipse/Schedule/UDQ/UDQProgram.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+#include <opm/input/eclipse/Schedule/UDQ/UDQASTNode.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQContext.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQFunction.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQFunctionTable.hpp>
+
+namespace Opm {
+
+namespace {
+
+bool arithmetic(UDQTokenType token_type) {
+    return token_type == UDQTokenType::binary_op_add ||
+           token_type == UDQTokenType::binary_op_sub ||
+           token_type == UDQTokenType::binary_op_mul ||
+           token_type == UDQTokenType::binary_op_div;
+}
+
+double apply(UDQTokenType token_type, double lhs, double rhs) {
+    switch (token_type) {
+    case UDQTokenType::binary_op_add:
+        return lhs + rhs;
+    case UDQTokenType::binary_op_sub:
+        return lhs - rhs;
+    case UDQTokenType::binary_op_mul:
+        return lhs * rhs;
+    case UDQTokenType::binary_op_div:
+        return lhs / rhs;
+    default:
+        throw std::logic_error("Not an arithmetic UDQ operator");
+    }
+}
+
+/*
+  Evaluates 'lhs op rhs' in place in lhs, element by element, with the same
+  semantics as the UDQSet operators: an element is undefined if either
+  operand is undefined or the result is not finite. The in place evaluation
+  is only used when no broadcasting is required, i.e. when the operands are
+  of the same type and size, or when rhs is a defined scalar; returns false
+  otherwise.
+*/
+bool apply_inplace(UDQTokenType token_type, UDQSet& lhs, const UDQSet& rhs) {
+    if (lhs.var_type() == rhs.var_type() && lhs.size() == rhs.size()) {
+        for (std::size_t index = 0; index < lhs.size(); index++) {
+            const auto& left = lhs[index].value();
+            const auto& right = rhs[index].value();
+            if (left.has_value() && right.has_value())
+                lhs.assign(index, apply(token_type, *left, *right));
+            else
+                lhs.assign(index, std::nullopt);
+        }
+        return true;
+    }
+
+    const bool rhs_scalar = (rhs.var_type() == UDQVarType::SCALAR || rhs.var_type() == UDQVarType::FIELD_VAR) && rhs.size() == 1;
+    const bool lhs_set = lhs.var_type() == UDQVarType::WELL_VAR || lhs.var_type() == UDQVarType::GROUP_VAR;
+    if (lhs_set && rhs_scalar && rhs[0].defined()) {
+        const double right = rhs[0].get();
+        for (std::size_t index = 0; index < lhs.size(); index++) {
+            const auto& left = lhs[index].value();
+            if (left.has_value())
+                lhs.assign(index, apply(token_type, *left, right));
+        }
+        return true;
+    }
+
+    return false;
+}
+
+}
+
+
+UDQWorkspace::UDQWorkspace(UDQContext& context) :
+    m_context(context)
+{}
+
+UDQContext& UDQWorkspace::context() {
+    return this->m_context;
+}
+
+const std::vector<std::string>& UDQWorkspace::wells() {
+    if (!this->well_index) {
+        this->m_wells = this->m_context.wells();
+        this->well_index = UDQSet::make_index(this->m_wells);
+    }
+    return this->m_wells;
+}
+
+const std::vector<std::string>& UDQWorkspace::groups() {
+    if (!this->group_index) {
+        this->m_groups = this->m_context.groups();
+        this->group_index = UDQSet::make_index(this->m_groups);
+    }
+    return this->m_groups;
+}
+
+/*
+  Returns a well set of the given name. The values of a set taken from the
+  spare list are left over from an earlier evaluation and must be assigned
+  by the caller.
+*/
+UDQSet UDQWorkspace::well_set(const std::string& name) {
+    const auto& wells = this->wells();
+    if (this->spare_well_sets.empty())
+        return UDQSet::wells(name, wells, this->well_index);
+
+    auto res = std::move(this->spare_well_sets.back());
+    this->spare_well_sets.pop_back();
+    res.name(name);
+    return res;
+}
+
+UDQSet UDQWorkspace::group_set(const std::string& name) {
+    const auto& groups = this->groups();
+    if (this->spare_group_sets.empty())
+        return UDQSet::groups(name, groups, this->group_index);
+
+    auto res = std::move(this->spare_group_sets.back());
+    this->spare_group_sets.pop_back();
+    res.name(name);
+    return res;
+}
+
+/*
+  Well and group sets created during the evaluation all hold the complete
+  well or group list in the same order, so any set of the right type and
+  size can be reused for a later well_set() or group_set() call.
+*/
+void UDQWorkspace::recycle(UDQSet&& set) {
+    if (set.var_type() == UDQVarType::WELL_VAR && this->well_index && set.size() == this->m_wells.size())
+        this->spare_well_sets.push_back(std::move(set));
+    else if (set.var_type() == UDQVarType::GROUP_VAR && this->group_index && set.size() == this->m_groups.size())
+        this->spare_group_sets.push_back(std::move(set));
+}
+
+
+UDQProgram::UDQProgram(const UDQASTNode& ast) {
+    this->compile(ast, 0);
+}
+
+
+void UDQProgram::compile(const UDQASTNode& node, std::size_t depth) {
+    Instruction instr;
+    instr.sign = node.sign;
+    instr.token_type = static_cast<int>(node.type);
+    this->max_depth = std::max(this->max_depth, depth + 1);
+
+    if (std::holds_alternative<std::string>(node.value))
+        instr.name = std::get<std::string>(node.value);
+    else
+        instr.value = std::get<double>(node.value);
+
+    if (node.type == UDQTokenType::ecl_expr && std::holds_alternative<std::string>(node.value)) {
+        instr.data_type = UDQ::targetType(instr.name);
+        if (!node.selector.empty())
+            instr.selector = node.selector[0];
+
+        const bool wildcard = instr.selector.find('*') != std::string::npos;
+        if (instr.data_type == UDQVarType::WELL_VAR) {
+            if (node.selector.empty())
+                instr.op = OpCode::WellVar;
+            else
+                instr.op = wildcard ? OpCode::WellVarPattern : OpCode::WellVarNamed;
+        } else if (instr.data_type == UDQVarType::GROUP_VAR) {
+            if (node.selector.empty())
+                instr.op = OpCode::GroupVar;
+            else
+                instr.op = wildcard ? OpCode::GroupVarPattern : OpCode::GroupVarNamed;
+        } else if (instr.data_type == UDQVarType::FIELD_VAR)
+            instr.op = OpCode::FieldVar;
+        else
+            instr.op = OpCode::ContextVar;
+
+        if (instr.op != OpCode::ContextVar) {
+            instr.cache = this->handle_caches.size();
+            this->handle_caches.emplace_back();
+        }
+
+        this->program.push_back(std::move(instr));
+        return;
+    }
+
+    if (UDQ::scalarFunc(node.type) || UDQ::elementalUnaryFunc(node.type)) {
+        if (node.left) {
+            this->compile(*node.left, depth);
+            instr.op = UDQ::scalarFunc(node.type) ? OpCode::ScalarFunc : OpCode::UnaryFunc;
+        } else
+            instr.op = OpCode::Invalid;
+
+        this->program.push_back(std::move(instr));
+        return;
+    }
+
+    if (UDQ::binaryFunc(node.type)) {
+        if (node.left && node.right) {
+            this->compile(*node.left, depth);
+            this->compile(*node.right, depth + 1);
+            instr.op = arithmetic(node.type) ? OpCode::Arithmetic : OpCode::BinaryFunc;
+        } else
+            instr.op = OpCode::Invalid;
+
+        this->program.push_back(std::move(instr));
+        return;
+    }
+
+    if (node.type == UDQTokenType::number && std::holds_alternative<double>(node.value)) {
+        instr.op = OpCode::Number;
+        this->program.push_back(std::move(instr));
+        return;
+    }
+
+    instr.op = OpCode::Invalid;
+    this->program.push_back(std::move(instr));
+}
+
+
+std::size_t UDQProgram::size() const {
+    return this->program.size();
+}
+
+std::size_t UDQProgram::stack_depth() const {
+    return this->max_depth;
+}
+
+
+/*
+  Handle of the summary vector of a well or group variable with a fully
+  qualified name, or of a field variable.
+*/
+SummaryState::Handle UDQProgram::handle(const Instruction& instr, UDQContext& context) const {
+    auto& cache = this->handle_caches[instr.cache];
+    if (cache.owner == context.handle_owner())
+        return cache.handles.front();
+
+    cache.handles.clear();
+    switch (instr.op) {
+    case OpCode::WellVarNamed:
+        cache.handles.push_back(context.well_var_handle(instr.selector, instr.name));
+        break;
+    case OpCode::GroupVarNamed:
+        cache.handles.push_back(context.group_var_handle(instr.selector, instr.name));
+        break;
+    default:
+        cache.handles.push_back(context.handle(instr.name));
+    }
+    cache.owner = context.handle_owner();
+    return cache.handles.front();
+}
+
+/*
+  Handles of the summary vectors of a well or group variable for the wells
+  or groups in 'names'. The handles are reused as long as the names are the
+  same as in the previous evaluation.
+*/
+const std::vector<SummaryState::Handle>&
+UDQProgram::handles(const Instruction& instr, const std::vector<std::string>& names, UDQContext& context) const {
+    auto& cache = this->handle_caches[instr.cache];
+    if ((cache.owner == context.handle_owner()) && (cache.names == names))
+        return cache.handles;
+
+    const bool group = (instr.op == OpCode::GroupVar);
+    cache.handles.clear();
+    cache.handles.reserve(names.size());
+    for (const auto& name : names)
+        cache.handles.push_back(group ? context.group_var_handle(name, instr.name)
+                                      : context.well_var_handle(name, instr.name));
+
+    cache.names = names;
+    cache.owner = context.handle_owner();
+    return cache.handles;
+}
+
+
+UDQSet UDQProgram::eval(UDQVarType target_type, UDQContext& context) const {
+    UDQWorkspace workspace(context);
+    return this->eval(target_type, workspace);
+}
+
+
+UDQSet UDQProgram::eval(UDQVarType target_type, UDQWorkspace& workspace) const {
+    if (this->program.empty())
+        throw std::logic_error("Can not evaluate empty UDQ program");
+
+    auto& context = workspace.context();
+    auto& stack = workspace.stack;
+    stack.clear();
+    stack.reserve(this->max_depth);
+
+    const auto push = [&stack](UDQSet&& value, double sign) {
+        if (sign != 1.0)
+            value *= sign;
+        stack.push_back(std::move(value));
+    };
+
+    const auto pop = [&stack]() {
+        auto value = std::move(stack.back());
+        stack.pop_back();
+        return value;
+    };
+
+    for (const auto& instr : this->program) {
+        switch (instr.op) {
+        case OpCode::WellVar: {
+            auto res = workspace.well_set(instr.name);
+            const auto& wells = workspace.wells();
+            const auto& well_handles = this->handles(instr, wells, context);
+            for (std::size_t index = 0; index < wells.size(); index++)
+                res.assign(index, context.get_well_var(wells[index], instr.name, well_handles[index]));
+            push(std::move(res), instr.sign);
+            break;
+        }
+
+        case OpCode::WellVarNamed:
+            /*
+              Fully qualified well name - evaluates to a scalar which is
+              distributed among all the wells in the result set.
+            */
+            push(UDQSet::scalar(instr.name, context.get_well_var(instr.selector, instr.name, this->handle(instr, context))), instr.sign);
+            break;
+
+        case OpCode::WellVarPattern: {
+            auto res = workspace.well_set(instr.name);
+            res.assign(std::nullopt);
+            const auto wells = context.wells(instr.selector);
+            const auto& well_handles = this->handles(instr, wells, context);
+            for (std::size_t index = 0; index < wells.size(); index++)
+                res.assign(wells[index], context.get_well_var(wells[index], instr.name, well_handles[index]));
+            push(std::move(res), instr.sign);
+            break;
+        }
+
+        case OpCode::GroupVar: {
+            auto res = workspace.group_set(instr.name);
+            const auto& groups = workspace.groups();
+            const auto& group_handles = this->handles(instr, groups, context);
+            for (std::size_t index = 0; index < groups.size(); index++)
+                res.assign(index, context.get_group_var(groups[index], instr.name, group_handles[index]));
+            push(std::move(res), instr.sign);
+            break;
+        }
+
+        case OpCode::GroupVarNamed:
+            // The sign is not applied here; this is as in UDQASTNode::eval().
+            push(UDQSet::scalar(instr.name, context.get_group_var(instr.selector, instr.name, this->handle(instr, context))), 1.0);
+            break;
+
+        case OpCode::GroupVarPattern:
+            throw std::logic_error("Group names with wildcards is not yet supported");
+
+        case OpCode::FieldVar:
+            push(UDQSet::scalar(instr.name, context.get(instr.name, this->handle(instr, context))), instr.sign);
+            break;
+
+        case OpCode::ContextVar: {
+            auto scalar = context.get(instr.name);
+            if (!scalar.has_value())
+                throw std::logic_error("Should not be here: var_type: " + UDQ::typeName(instr.data_type) + " stringvalue:" + instr.name);
+
+            push(UDQSet::scalar(instr.name, scalar.value()), instr.sign);
+            break;
+        }
+
+        case OpCode::Number: {
+            const std::string dummy_name = "DUMMY";
+            switch (target_type) {
+            case UDQVarType::WELL_VAR: {
+                auto res = workspace.well_set(dummy_name);
+                res.assign(instr.value);
+                push(std::move(res), instr.sign);
+                break;
+            }
+            case UDQVarType::GROUP_VAR: {
+                auto res = workspace.group_set(dummy_name);
+                res.assign(instr.value);
+                push(std::move(res), instr.sign);
+                break;
+            }
+            case UDQVarType::SCALAR:
+                push(UDQSet::scalar(dummy_name, instr.value), instr.sign);
+                break;
+            case UDQVarType::FIELD_VAR:
+                push(UDQSet::field(dummy_name, instr.value), instr.sign);
+                break;
+            default:
+                throw std::invalid_argument("Unsupported target_type: " + std::to_string(static_cast<int>(target_type)));
+            }
+            break;
+        }
+
+        case OpCode::ScalarFunc: {
+            const auto& func = dynamic_cast<const UDQScalarFunction&>(context.function_table().get(instr.name));
+            auto arg = pop();
+            push(func.eval(arg), instr.sign);
+            workspace.recycle(std::move(arg));
+            break;
+        }
+
+        case OpCode::UnaryFunc: {
+            const auto& func = dynamic_cast<const UDQUnaryElementalFunction&>(context.function_table().get(instr.name));
+            auto arg = pop();
+            push(func.eval(arg), instr.sign);
+            workspace.recycle(std::move(arg));
+            break;
+        }
+
+        case OpCode::Arithmetic: {
+            auto right_arg = pop();
+            auto left_arg = pop();
+            const auto token_type = static_cast<UDQTokenType>(instr.token_type);
+            if (apply_inplace(token_type, left_arg, right_arg)) {
+                push(std::move(left_arg), instr.sign);
+                workspace.recycle(std::move(right_arg));
+                break;
+            }
+
+            const auto& func = dynamic_cast<const UDQBinaryFunction&>(context.function_table().get(instr.name));
+            push(func.eval(left_arg, right_arg), instr.sign);
+            break;
+        }
+
+        case OpCode::BinaryFunc: {
+            auto right_arg = pop();
+            auto left_arg = pop();
+            const auto& func = dynamic_cast<const UDQBinaryFunction&>(context.function_table().get(instr.name));
+            push(func.eval(left_arg, right_arg), instr.sign);
+            workspace.recycle(std::move(left_arg));
+            workspace.recycle(std::move(right_arg));
+            break;
+        }
+
+        case OpCode::Invalid:
+            throw std::invalid_argument("Should not be here ... this->type: " + std::to_string(instr.token_type));
+        }
+    }
+
+    return pop();
+}
+
+}
@@ -137,10 +137,39 @@ void UDQSet::name(const std::string& name) {
     this->m_name = name;
 }
 
+std::shared_ptr<const UDQSet::NameIndex> UDQSet::make_index(const std::vector<std::string>& wgnames) {
+    auto index = std::make_shared<NameIndex>();
+    index->reserve(wgnames.size());
+    for (std::size_t i = 0; i < wgnames.size(); i++)
+        index->emplace(wgnames[i], i);
+    return index;
+}
+
 UDQSet::UDQSet(const std::string& name, UDQVarType var_type, const std::vector<std::string>& wgnames) :
+    UDQSet(name, var_type, wgnames, make_index(wgnames))
+{}
+
+UDQSet::UDQSet(const std::string& name, UDQVarType var_type, const std::vector<std::string>& wgnames, std::shared_ptr<const NameIndex> index) :
     m_name(name),
-    m_var_type(var_type)
+    m_var_type(var_type),
+    m_index(std::move(index))
 {
+    if (!this->m_index || this->m_index->size() > wgnames.size())
+        throw std::logic_error("UDQSet: name index does not match the list of names");
+
+#ifndef NDEBUG
+    // Every name must map to a slot holding that name.  With repeated names
+    // the index holds the first occurrence, as built by make_index().
+    for (const auto& wgname : wgnames) {
+        const auto iter = this->m_index->find(wgname);
+        if ((iter == this->m_index->end()) ||
+            (iter->second >= wgnames.size()) ||
+            (wgnames[iter->second] != wgname))
+            throw std::logic_error("UDQSet: name index does not match the list of names");
+    }
+#endif
+
+    this->values.reserve(wgnames.size());
     for (const auto& wgname : wgnames)
         this->values.emplace_back(wgname);
 }
@@ -204,11 +233,21 @@ UDQSet UDQSet::wells(const std::string& name, const std::vector<std::string>& we
 }
 
 
+UDQSet UDQSet::wells(const std::string& name, const std::vector<std::string>& wells, std::shared_ptr<const NameIndex> index) {
+    return UDQSet(name, UDQVarType::WELL_VAR, wells, std::move(index));
+}
+
+
 UDQSet UDQSet::groups(const std::string& name, const std::vector<std::string>& groups) {
     return UDQSet(name, UDQVarType::GROUP_VAR, groups);
 }
 
 
+UDQSet UDQSet::groups(const std::string& name, const std::vector<std::string>& groups, std::shared_ptr<const NameIndex> index) {
+    return UDQSet(name, UDQVarType::GROUP_VAR, groups, std::move(index));
+}
+
+
 UDQSet UDQSet::groups(const std::string& name, const std::vector<std::string>& groups, double scalar_value) {
     UDQSet us = UDQSet::groups(name, groups);
     us.assign(scalar_value);
@@ -216,12 +255,23 @@ UDQSet UDQSet::groups(const std::string& name, const std::vector<std::string>& g
 }
 
 
-bool UDQSet::has(const std::string& name) const {
-    for (const auto& res : this->values) {
-        if (res.wgname() == name)
-            return true;
+std::optional<std::size_t> UDQSet::index(const std::string& wgname) const {
+    if (this->m_index) {
+        auto iter = this->m_index->find(wgname);
+        if (iter == this->m_index->end())
+            return std::nullopt;
+        return iter->second;
     }
-    return false;
+
+    for (std::size_t i = 0; i < this->values.size(); i++) {
+        if (this->values[i].wgname() == wgname)
+            return i;
+    }
+    return std::nullopt;
+}
+
+bool UDQSet::has(const std::string& name) const {
+    return this->index(name).has_value();
 }
 
 std::size_t UDQSet::size() const {
@@ -230,27 +280,43 @@ std::size_t UDQSet::size() const {
 
 
 void UDQSet::assign(const std::string& wgname, double value) {
+    if (const auto index = this->index(wgname); index.has_value())
+        this->values[*index].assign(value);
+    else
+        this->assign_matching(wgname, value);
+}
+
+void UDQSet::assign(const std::string& wgname, const std::optional<double>& value) {
+    if (const auto index = this->index(wgname); index.has_value())
+        this->values[*index].assign(value);
+    else
+        this->assign_matching(wgname, value);
+}
+
+void UDQSet::assign_matching(const std::string& pattern, double value) {
     bool assigned = false;
+    const ShellPattern shell_pattern(pattern);
     for (auto& udq_value : this->values) {
-        if (shmatch(wgname, udq_value.wgname())) {
+        if (shell_pattern.match(udq_value.wgname())) {
             udq_value.assign( value );
             assigned = true;
         }
     }
     if (!assigned)
-        throw std::out_of_range("No well/group matching: " + wgname);
+        throw std::out_of_range("No well/group matching: " + pattern);
 }
 
-void UDQSet::assign(const std::string& wgname, const std::optional<double>& value) {
+void UDQSet::assign_matching(const std::string& pattern, const std::optional<double>& value) {
     bool assigned = false;
+    const ShellPattern shell_pattern(pattern);
     for (auto& udq_value : this->values) {
-        if (shmatch(wgname, udq_value.wgname())) {
+        if (shell_pattern.match(udq_value.wgname())) {
             udq_value.assign( value );
             assigned = true;
         }
     }
     if (!assigned)
-        throw std::out_of_range("No well/group matching: " + wgname);
+        throw std::out_of_range("No well/group matching: " + pattern);
 }
 
 void UDQSet::assign(double value) {
@@ -268,6 +334,11 @@ void UDQSet::assign(std::size_t index, double value) {
     scalar.assign(value);
 }
 
+void UDQSet::assign(std::size_t index, const std::optional<double>& value) {
+    auto& scalar = this->values[index];
+    scalar.assign(value);
+}
+
 
 UDQVarType UDQSet::var_type() const {
     return this->m_var_type;
@@ -358,10 +429,10 @@ const UDQScalar& UDQSet::operator[](std::size_t index) const {
 }
 
 const UDQScalar& UDQSet::operator[](const std::string& wgname) const {
-    auto value_iter = std::find_if( this->values.begin(), this->values.end(), [&wgname](const UDQScalar& value) { return (value.wgname() == wgname );});
-    if (value_iter == this->values.end())
+    const auto index = this->index(wgname);
+    if (!index.has_value())
         throw std::out_of_range("No such well/group: " + wgname);
-    return *value_iter;
+    return this->values[*index];
 }
 
 
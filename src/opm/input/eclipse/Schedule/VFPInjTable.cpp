@@ -19,9 +19,9 @@
 
 #include <cassert>
 #include <cmath>
-#include <iostream>
 #include <fmt/format.h>
 
+#include <opm/common/OpmLog/OpmLog.hpp>
 #include <opm/input/eclipse/Deck/DeckItem.hpp>
 #include <opm/input/eclipse/Deck/DeckKeyword.hpp>
 #include <opm/input/eclipse/Deck/DeckRecord.hpp>
@@ -46,6 +46,17 @@ inline const Opm::DeckItem& getNonEmptyItem( const Opm::DeckRecord& record) {
     return retval;
 }
 
+/*
+  Warnings are either logged immediately, or collected by the caller and
+  logged later, in the same way as for VFPPROD.
+*/
+void warning(std::vector<std::string>* warnings, const std::string& msg) {
+    if (warnings)
+        warnings->push_back(msg);
+    else
+        Opm::OpmLog::warning(msg);
+}
+
 } //Namespace
 
 
@@ -61,7 +72,7 @@ VFPInjTable::VFPInjTable()
 }
 
 
-VFPInjTable::VFPInjTable( const DeckKeyword& table, const UnitSystem& deck_unit_system) :
+VFPInjTable::VFPInjTable( const DeckKeyword& table, const UnitSystem& deck_unit_system, std::vector<std::string>* warnings) :
     m_location(table.location())
 {
     using ParserKeywords::VFPINJ;
@@ -165,11 +176,8 @@ VFPInjTable::VFPInjTable( const DeckKeyword& table, const UnitSystem& deck_unit_
 
         for (unsigned int f=0; f<bhp_tht.size(); ++f) {
             const double& value = bhp_tht[f];
-            if (value > 1.0e10) {
-                //TODO: Replace with proper log message
-                std::cerr << "Too large value encountered in VFPINJ in ["
-                        << t << "," << f << "]=" << value << std::endl;
-            }
+            if (value > 1.0e10)
+                warning(warnings, fmt::format("Too large value encountered in VFPINJ in [{},{}]={}", t, f, value));
             (*this)(t,f) = table_scaling_factor*value;
         }
     }
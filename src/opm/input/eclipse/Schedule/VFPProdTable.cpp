@@ -40,6 +40,18 @@ namespace Opm {
 
 namespace {
 
+/*
+  Warnings are either logged immediately, or collected by the caller and
+  logged later; the latter is used when the table is assembled in a worker
+  thread.
+*/
+void warning(std::vector<std::string>* warnings, const std::string& msg) {
+    if (warnings)
+        warnings->push_back(msg);
+    else
+        OpmLog::warning(msg);
+}
+
 VFPProdTable::FLO_TYPE getFloType( const DeckItem& item) {
     const std::string& flo_string = item.getTrimmedString(0);
     if (flo_string == "OIL")
@@ -183,7 +195,7 @@ VFPProdTable VFPProdTable::serializationTestObject()
   If the gaslift_opt flag is set to true the ALQ_TYPE item will default to GRAT.
 */
 
-VFPProdTable::VFPProdTable( const DeckKeyword& table, bool gaslift_opt_active, const UnitSystem& deck_unit_system) :
+VFPProdTable::VFPProdTable( const DeckKeyword& table, bool gaslift_opt_active, const UnitSystem& deck_unit_system, std::vector<std::string>* warnings) :
     m_location(table.location())
 {
     using ParserKeywords::VFPPROD;
@@ -324,13 +336,13 @@ VFPProdTable::VFPProdTable( const DeckKeyword& table, bool gaslift_opt_active, c
                                        this->m_location.filename, this->m_location.lineno,
                                        t,w,g,a,bhp_tht[f]);
 
-                OpmLog::warning(msg);
+                warning(warnings, msg);
             }
             (*this)(t,w,g,a,f) = table_scaling_factor*bhp_tht[f];
         }
     }
 
-    check();
+    check(warnings);
 }
 
 
@@ -349,7 +361,7 @@ void check_axis(const std::vector<double>& axis) {
 }
 
 
-void VFPProdTable::check() {
+void VFPProdTable::check(std::vector<std::string>* warnings) {
     if (this->m_table_num <= 0)
         throw std::invalid_argument(fmt::format("Invalid table number: {}", this->m_table_num));
 
@@ -399,13 +411,13 @@ void VFPProdTable::check() {
 
     if (error_count > 0) {
         const auto& location = this->m_location;
-        OpmLog::warning(fmt::format("VFPPROD table {0} has {1} non-monotonic points of BHP(THP)\n"
-                                    "In {2} line {3}\n"
-                                    "This may cause convergence issues due to switching between BHP and THP control.\n",
-                                    m_table_num,
-                                    error_count,
-                                    location.filename,
-                                    location.lineno));
+        warning(warnings, fmt::format("VFPPROD table {0} has {1} non-monotonic points of BHP(THP)\n"
+                                      "In {2} line {3}\n"
+                                      "This may cause convergence issues due to switching between BHP and THP control.\n",
+                                      m_table_num,
+                                      error_count,
+                                      location.filename,
+                                      location.lineno));
     }
 }
 
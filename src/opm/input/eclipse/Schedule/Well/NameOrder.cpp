@@ -17,19 +17,81 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
 */
 #include <algorithm>
+#include <numeric>
+
+#include <opm/common/utility/shmatch.hpp>
 #include <opm/input/eclipse/Schedule/Well/NameOrder.hpp>
 
 namespace Opm {
 
+NamePatternIndex::NamePatternIndex(const NamePatternIndex&)
+{
+}
+
+NamePatternIndex& NamePatternIndex::operator=(const NamePatternIndex&) {
+    this->clear();
+    return *this;
+}
+
+void NamePatternIndex::clear() {
+    std::lock_guard<std::mutex> lock(this->m_mutex);
+    this->m_sorted.clear();
+    this->m_results.clear();
+}
+
+std::vector<std::string> NamePatternIndex::match(const std::string& pattern, const std::vector<std::string>& names) const {
+    std::lock_guard<std::mutex> lock(this->m_mutex);
+    auto result_iter = this->m_results.find(pattern);
+    if (result_iter != this->m_results.end())
+        return result_iter->second;
+
+    if (this->m_sorted.size() != names.size()) {
+        this->m_sorted.resize(names.size());
+        std::iota(this->m_sorted.begin(), this->m_sorted.end(), std::size_t{0});
+        std::sort(this->m_sorted.begin(), this->m_sorted.end(),
+                  [&names](std::size_t i1, std::size_t i2) { return names[i1] < names[i2]; });
+    }
+
+    const ShellPattern shell_pattern(pattern);
+    const auto& prefix = shell_pattern.prefix();
+    auto iter = std::lower_bound(this->m_sorted.begin(), this->m_sorted.end(), prefix,
+                                 [&names](std::size_t index, const std::string& value) { return names[index] < value; });
+
+    std::vector<std::size_t> matches;
+    for (; iter != this->m_sorted.end(); ++iter) {
+        const auto& name = names[*iter];
+        if (name.compare(0, prefix.size(), prefix) != 0)
+            break;
+
+        if (shell_pattern.match(name))
+            matches.push_back(*iter);
+    }
+
+    std::sort(matches.begin(), matches.end());
+    std::vector<std::string> result;
+    result.reserve(matches.size());
+    for (const auto& index : matches)
+        result.push_back(names[index]);
+
+    return this->m_results.emplace(pattern, std::move(result)).first->second;
+}
+
+/********************************************************************************/
+
 void NameOrder::add(const std::string& name) {
     auto iter = this->m_index_map.find( name );
     if (iter == this->m_index_map.end()) {
         std::size_t insert_index = this->m_name_list.size();
         this->m_index_map.emplace( name, insert_index );
         this->m_name_list.push_back( name );
+        this->m_pattern_index.clear();
     }
 }
 
+std::vector<std::string> NameOrder::match(const std::string& pattern) const {
+    return this->m_pattern_index.match(pattern, this->m_name_list);
+}
+
 NameOrder::NameOrder(const std::vector<std::string>& names) {
     for (const auto& w : names)
         this->add(w);
@@ -96,8 +158,15 @@ GroupOrder::GroupOrder(std::size_t max_groups)
 
 void GroupOrder::add(const std::string& gname) {
     auto iter = std::find(this->m_name_list.begin(), this->m_name_list.end(), gname);
-    if (iter == this->m_name_list.end())
+    if (iter == this->m_name_list.end()) {
         this->m_name_list.push_back( gname );
+        this->m_pattern_index.clear();
+    }
+}
+
+
+std::vector<std::string> GroupOrder::match(const std::string& pattern) const {
+    return this->m_pattern_index.match(pattern, this->m_name_list);
 }
 
 
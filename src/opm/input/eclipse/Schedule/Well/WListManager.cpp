@@ -49,6 +49,7 @@ namespace Opm {
     }
 
     WList& WListManager::newList(const std::string& name, const std::vector<std::string>& new_well_names) {
+        this->wells_cache.clear();
         if (this->hasList(name)) {
             auto& wlist = getList(name);
             if (new_well_names.size() > 0) {
@@ -86,6 +87,7 @@ namespace Opm {
     }
 
     WList& WListManager::getList(const std::string& name) {
+        this->wells_cache.clear();
         return this->wlists.at(name);
     }
 
@@ -110,6 +112,7 @@ namespace Opm {
     }
 
     void WListManager::addWListWell(const std::string& wname, const std::string& wlname) {
+        this->wells_cache.clear();
         //add well to wlist if it is not already in the well list
         auto& wlist = this->getList(wlname);
         wlist.add(wname);
@@ -132,6 +135,7 @@ namespace Opm {
     }
 
     void WListManager::delWell(const std::string& wname) {
+        this->wells_cache.clear();
         for (auto& pair: this->wlists) {
             auto& wlist = pair.second;
             wlist.del(wname);
@@ -151,6 +155,7 @@ namespace Opm {
     }
 
     void WListManager::delWListWell(const std::string& wname, const std::string& wlname) {
+        this->wells_cache.clear();
         //delete well from well list
         auto& wlist = this->getList(wlname);
         wlist.del(wname);
@@ -178,21 +183,27 @@ namespace Opm {
         if (this->hasList(wlist_pattern)) {
             const auto& wlist = this->getList(wlist_pattern);
             return { wlist.wells() };
-        } else {
-            std::vector<std::string> well_set;
-            auto pattern = wlist_pattern.substr(1);
-            for (const auto& [name, wlist] : this->wlists) {
-                auto wlist_name = name.substr(1);
-                if (shmatch(pattern, wlist_name)) {
-                    const auto& well_names = wlist.wells();
-                    for ( auto it = well_names.begin(); it != well_names.end(); it++ ) {
-                       if (std::count(well_set.begin(), well_set.end(), *it) == 0)
-                           well_set.push_back(*it);
-                    }
+        }
+
+        std::lock_guard<std::mutex> lock(this->wells_cache.mutex);
+        auto cache_iter = this->wells_cache.wells.find(wlist_pattern);
+        if (cache_iter != this->wells_cache.wells.end())
+            return cache_iter->second;
+
+        std::vector<std::string> well_set;
+        std::unordered_set<std::string> added;
+        const ShellPattern pattern(wlist_pattern.substr(1));
+        for (const auto& [name, wlist] : this->wlists) {
+            auto wlist_name = name.substr(1);
+            if (pattern.match(wlist_name)) {
+                for (const auto& wname : wlist.wells()) {
+                    if (added.insert(wname).second)
+                        well_set.push_back(wname);
                 }
             }
-            return { well_set };
         }
+
+        return this->wells_cache.wells.emplace(wlist_pattern, std::move(well_set)).first->second;
     }
 
 }
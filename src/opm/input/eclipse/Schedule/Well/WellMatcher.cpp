@@ -19,39 +19,44 @@
 #include <algorithm>
 #include <utility>
 
-#include <opm/common/utility/shmatch.hpp>
 #include <opm/input/eclipse/Schedule/Well/WellMatcher.hpp>
 
 namespace Opm {
 
 
 WellMatcher::WellMatcher(const NameOrder& well_order) :
-    m_well_order(well_order)
+    m_well_order(std::make_shared<const NameOrder>(well_order))
 {
 }
 
 WellMatcher::WellMatcher(std::initializer_list<std::string> wells) :
-    m_well_order(wells)
+    m_well_order(std::make_shared<const NameOrder>(wells))
 {
 }
 
 WellMatcher::WellMatcher(const std::vector<std::string>& wells) :
-    m_well_order(wells)
+    m_well_order(std::make_shared<const NameOrder>(wells))
 {
 }
 
 WellMatcher::WellMatcher(const NameOrder& well_order, const WListManager &wlm) :
-    m_well_order(well_order),
-    m_wlm(wlm)
+    m_well_order(std::make_shared<const NameOrder>(well_order)),
+    m_wlm(std::make_shared<const WListManager>(wlm))
+{
+}
+
+WellMatcher::WellMatcher(std::shared_ptr<const NameOrder> well_order, std::shared_ptr<const WListManager> wlm) :
+    m_well_order(std::move(well_order)),
+    m_wlm(std::move(wlm))
 {
 }
 
 std::vector<std::string> WellMatcher::sort(std::vector<std::string> wells) const {
-    return this->m_well_order.sort(std::move(wells));
+    return this->m_well_order->sort(std::move(wells));
 }
 
 const std::vector<std::string>& WellMatcher::wells() const {
-    return this->m_well_order.names();
+    return this->m_well_order->names();
 }
 
 
@@ -61,20 +66,14 @@ std::vector<std::string> WellMatcher::wells(const std::string& pattern) const {
 
     // WLIST
     if (pattern[0] == '*' && pattern.size() > 1)
-        return this->sort( this->m_wlm.wells(pattern) );
+        return this->sort( this->m_wlm->wells(pattern) );
 
     // Normal pattern matching
     auto star_pos = pattern.find('*');
-    if (star_pos != std::string::npos) {
-        std::vector<std::string> names;
-        for (const auto& wname : this->m_well_order) {
-            if (shmatch(pattern, wname))
-                names.push_back(wname);
-        }
-        return names;
-    }
-
-    if (this->m_well_order.has(pattern))
+    if (star_pos != std::string::npos)
+        return this->m_well_order->match(pattern);
+
+    if (this->m_well_order->has(pattern))
         return { pattern };
 
     return {};
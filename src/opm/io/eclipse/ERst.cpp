@@ -172,7 +172,8 @@ int ERst::occurrence_count(const std::string& name, int reportStepNumber) const
 
 void ERst::initUnified()
 {
-    loadData("SEQNUM");
+    if (!this->fromIndex)
+        loadData("SEQNUM");
 
     std::vector<int> firstIndex;
 
@@ -0,0 +1,376 @@
+/*
+   Copyright 2026 Equinor ASA.
+
+   This file is part of the Open Porous Media project (OPM).
+
+   OPM is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   OPM is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+   */
+
+#include <opm/io/eclipse/EclCompression.hpp>
+
+#include <opm/common/ErrorMacros.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+namespace {
+
+constexpr std::uint32_t storedRaw = 0x80000000u;
+
+constexpr int hashBits = 14;
+constexpr std::size_t minMatch = 4;
+constexpr std::size_t maxOffset = 65535;
+
+// Input bytes at the end of a chunk which are always emitted as literals, so
+// that the match finder may read four bytes at any position before them.
+constexpr std::size_t tailLiterals = 8;
+
+std::uint32_t read32(const unsigned char* p)
+{
+    std::uint32_t value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+std::uint32_t hash(std::uint32_t sequence)
+{
+    return (sequence * 2654435761u) >> (32 - hashBits);
+}
+
+void putLength(std::vector<char>& out, std::size_t length)
+{
+    for (; length >= 255; length -= 255)
+        out.push_back(static_cast<char>(255));
+
+    out.push_back(static_cast<char>(length));
+}
+
+void putSequence(std::vector<char>& out, const unsigned char* literals, std::size_t numLiterals,
+                 std::size_t offset, std::size_t matchLength)
+{
+    const std::size_t matchCode = matchLength > 0 ? matchLength - minMatch : 0;
+
+    out.push_back(static_cast<char>((std::min<std::size_t>(numLiterals, 15) << 4) |
+                                    std::min<std::size_t>(matchCode, 15)));
+
+    if (numLiterals >= 15)
+        putLength(out, numLiterals - 15);
+
+    out.insert(out.end(), literals, literals + numLiterals);
+
+    if (matchLength == 0)
+        return;
+
+    out.push_back(static_cast<char>(offset & 0xff));
+    out.push_back(static_cast<char>(offset >> 8));
+
+    if (matchCode >= 15)
+        putLength(out, matchCode - 15);
+}
+
+/*
+  LZ77 with the sequence layout of the LZ4 block format: a token holding the
+  number of literals and the match length in one nibble each, extended by
+  bytes of 255 when needed, the literals, and a two byte match offset.  The
+  last sequence has literals only.
+*/
+std::vector<char> lzCompress(const unsigned char* src, std::size_t size)
+{
+    std::vector<char> out;
+    out.reserve(size / 2 + 16);
+
+    std::vector<std::uint32_t> table(std::size_t{1} << hashBits, 0);
+
+    std::size_t anchor = 0;
+    std::size_t pos = 0;
+    const std::size_t limit = size > tailLiterals ? size - tailLiterals : 0;
+
+    while (pos < limit) {
+        const auto sequence = read32(src + pos);
+        auto& slot = table[hash(sequence)];
+        const std::size_t candidate = slot;
+        slot = static_cast<std::uint32_t>(pos + 1);
+
+        if ((candidate == 0) || (pos - (candidate - 1) > maxOffset) ||
+            (read32(src + candidate - 1) != sequence)) {
+            pos++;
+            continue;
+        }
+
+        const std::size_t ref = candidate - 1;
+        std::size_t length = minMatch;
+        while ((pos + length < limit) && (src[ref + length] == src[pos + length]))
+            length++;
+
+        putSequence(out, src + anchor, pos - anchor, pos - ref, length);
+
+        pos += length;
+        anchor = pos;
+    }
+
+    putSequence(out, src + anchor, size - anchor, 0, 0);
+
+    return out;
+}
+
+std::size_t getLength(const unsigned char*& ip, const unsigned char* end, std::size_t length)
+{
+    if (length < 15)
+        return length;
+
+    unsigned char byte;
+    do {
+        if (ip == end)
+            OPM_THROW(std::runtime_error, "Corrupt compressed data: truncated length");
+
+        byte = *ip++;
+        length += byte;
+    } while (byte == 255);
+
+    return length;
+}
+
+void lzDecompress(const unsigned char* ip, std::size_t size, unsigned char* op, std::size_t rawSize)
+{
+    const unsigned char* const end = ip + size;
+    std::size_t out = 0;
+
+    while (ip < end) {
+        const unsigned token = *ip++;
+
+        const std::size_t numLiterals = getLength(ip, end, token >> 4);
+        if ((static_cast<std::size_t>(end - ip) < numLiterals) || (rawSize - out < numLiterals))
+            OPM_THROW(std::runtime_error, "Corrupt compressed data: literals out of range");
+
+        std::memcpy(op + out, ip, numLiterals);
+        ip += numLiterals;
+        out += numLiterals;
+
+        if (ip == end)
+            break;
+
+        if (end - ip < 2)
+            OPM_THROW(std::runtime_error, "Corrupt compressed data: truncated match offset");
+
+        const std::size_t offset = ip[0] | (static_cast<std::size_t>(ip[1]) << 8);
+        ip += 2;
+
+        const std::size_t length = getLength(ip, end, token & 0x0f) + minMatch;
+        if ((offset == 0) || (offset > out) || (rawSize - out < length))
+            OPM_THROW(std::runtime_error, "Corrupt compressed data: match out of range");
+
+        // Byte by byte, matches may overlap their own output.
+        for (std::size_t i = 0; i < length; i++, out++)
+            op[out] = op[out - offset];
+    }
+
+    if (out != rawSize)
+        OPM_THROW(std::runtime_error, "Corrupt compressed data: unexpected size");
+}
+
+// Place byte j of element i at j * n + i, for n complete elements of
+// 'stride' bytes.  Trailing bytes are copied unchanged.
+void shuffle(const char* src, std::size_t size, int stride, char* dst)
+{
+    const std::size_t n = size / stride;
+
+    for (std::size_t i = 0; i < n; i++)
+        for (int j = 0; j < stride; j++)
+            dst[j * n + i] = src[i * stride + j];
+
+    std::copy(src + n * stride, src + size, dst + n * stride);
+}
+
+void unshuffle(const char* src, std::size_t size, int stride, char* dst)
+{
+    const std::size_t n = size / stride;
+
+    for (std::size_t i = 0; i < n; i++)
+        for (int j = 0; j < stride; j++)
+            dst[i * stride + j] = src[j * n + i];
+
+    std::copy(src + n * stride, src + size, dst + n * stride);
+}
+
+template <typename T>
+void putBigEndian(std::ostream& os, T value)
+{
+    char bytes[sizeof(T)];
+    for (std::size_t i = 0; i < sizeof(T); i++)
+        bytes[i] = static_cast<char>(value >> (8 * (sizeof(T) - 1 - i)));
+
+    os.write(bytes, sizeof(T));
+}
+
+template <typename T>
+T getBigEndian(std::istream& is)
+{
+    unsigned char bytes[sizeof(T)];
+    if (!is.read(reinterpret_cast<char*>(bytes), sizeof(T)))
+        OPM_THROW(std::runtime_error, "Error reading compressed array data");
+
+    T value = 0;
+    for (std::size_t i = 0; i < sizeof(T); i++)
+        value = (value << 8) | bytes[i];
+
+    return value;
+}
+
+} // Anonymous namespace
+
+namespace Opm { namespace EclIO { namespace Compression {
+
+int shuffleStride(eclArrType type)
+{
+    switch (type) {
+    case INTE:
+    case REAL:
+    case LOGI:
+        return 4;
+    case DOUB:
+        return 8;
+    default:
+        return 1;
+    }
+}
+
+std::vector<char> compress(const char* data, std::size_t size, int stride)
+{
+    if (stride <= 1)
+        return lzCompress(reinterpret_cast<const unsigned char*>(data), size);
+
+    std::vector<char> shuffled(size);
+    shuffle(data, size, stride, shuffled.data());
+
+    return lzCompress(reinterpret_cast<const unsigned char*>(shuffled.data()), size);
+}
+
+void decompress(const char* data, std::size_t size, char* raw, std::size_t rawSize, int stride)
+{
+    if (stride <= 1) {
+        lzDecompress(reinterpret_cast<const unsigned char*>(data), size,
+                     reinterpret_cast<unsigned char*>(raw), rawSize);
+        return;
+    }
+
+    std::vector<char> shuffled(rawSize);
+    lzDecompress(reinterpret_cast<const unsigned char*>(data), size,
+                 reinterpret_cast<unsigned char*>(shuffled.data()), rawSize);
+
+    unshuffle(shuffled.data(), rawSize, stride, raw);
+}
+
+bool readMagic(std::istream& is)
+{
+    const auto pos = is.tellg();
+
+    std::array<char, magic.size()> bytes{};
+    if (is.read(bytes.data(), bytes.size()) && (bytes == magic))
+        return true;
+
+    is.clear();
+    is.seekg(pos);
+
+    return false;
+}
+
+void skipPayload(std::istream& is, std::size_t rawSize)
+{
+    for (std::size_t offset = 0; offset < rawSize; offset += chunkSize) {
+        const auto size = getBigEndian<std::uint32_t>(is);
+        is.seekg(static_cast<std::streamoff>(size & ~storedRaw), std::ios_base::cur);
+    }
+}
+
+std::vector<char> readPayload(std::istream& is, std::size_t rawSize, int stride)
+{
+    std::vector<char> raw(rawSize);
+    std::vector<char> stored;
+
+    for (std::size_t offset = 0; offset < rawSize; offset += chunkSize) {
+        const auto size = getBigEndian<std::uint32_t>(is);
+        const std::size_t chunkRaw = std::min(chunkSize, rawSize - offset);
+        const std::size_t storedSize = size & ~storedRaw;
+
+        if (size & storedRaw) {
+            if (storedSize != chunkRaw)
+                OPM_THROW(std::runtime_error, "Corrupt compressed data: inconsistent chunk size");
+
+            if (!is.read(raw.data() + offset, chunkRaw))
+                OPM_THROW(std::runtime_error, "Error reading compressed array data");
+        } else {
+            stored.resize(storedSize);
+            if (!is.read(stored.data(), storedSize))
+                OPM_THROW(std::runtime_error, "Error reading compressed array data");
+
+            decompress(stored.data(), storedSize, raw.data() + offset, chunkRaw, stride);
+        }
+    }
+
+    return raw;
+}
+
+ChunkWriter::ChunkWriter()
+    : raw_(chunkSize)
+{
+    this->setp(raw_.data(), raw_.data() + raw_.size());
+}
+
+void ChunkWriter::begin(eclArrType type, std::ostream& os)
+{
+    this->stride_ = shuffleStride(type);
+    this->os_ = &os;
+}
+
+ChunkWriter::int_type ChunkWriter::overflow(int_type ch)
+{
+    this->compressChunk();
+
+    if (!traits_type::eq_int_type(ch, traits_type::eof())) {
+        *this->pptr() = traits_type::to_char_type(ch);
+        this->pbump(1);
+    }
+
+    return traits_type::not_eof(ch);
+}
+
+void ChunkWriter::compressChunk()
+{
+    const std::size_t size = this->pptr() - this->pbase();
+    if (size == 0)
+        return;
+
+    if (this->os_ == nullptr)
+        OPM_THROW(std::logic_error, "Compressed array data written before array header");
+
+    const auto compressed = compress(raw_.data(), size, this->stride_);
+
+    if (compressed.size() < size) {
+        putBigEndian(*this->os_, static_cast<std::uint32_t>(compressed.size()));
+        this->os_->write(compressed.data(), compressed.size());
+    } else {
+        putBigEndian(*this->os_, static_cast<std::uint32_t>(size) | storedRaw);
+        this->os_->write(raw_.data(), size);
+    }
+
+    this->setp(raw_.data(), raw_.data() + raw_.size());
+}
+
+void ChunkWriter::finish()
+{
+    this->compressChunk();
+    this->os_ = nullptr;
+}
+
+}}} // namespace Opm::EclIO::Compression
@@ -17,6 +17,7 @@
    */
 
 #include <opm/io/eclipse/EclFile.hpp>
+#include <opm/io/eclipse/EclCompression.hpp>
 #include <opm/io/eclipse/EclUtil.hpp>
 #include <opm/common/ErrorMacros.hpp>
 
@@ -36,8 +37,53 @@
 #include <iostream>
 
 
+namespace {
+
+// Read-only stream buffer over decompressed array data.
+class MemoryBuffer : public std::streambuf
+{
+public:
+    explicit MemoryBuffer(std::vector<char>& data)
+    {
+        this->setg(data.data(), data.data(), data.data() + data.size());
+    }
+};
+
+} // Anonymous namespace
+
 namespace Opm { namespace EclIO {
 
+bool EclFile::loadIndex()
+{
+    const auto index = EclFileIndex::load(this->inputFilename);
+    if (!index.has_value())
+        return false;
+
+    for (const auto& entry : index->entries()) {
+        const int n = array_name.size();
+
+        array_size.push_back(entry.size);
+        array_type.push_back(entry.type);
+        array_name.push_back(entry.name);
+        array_element_size.push_back(entry.element_size);
+
+        array_index[entry.name] = n;
+        ifStreamPos.push_back(entry.data);
+
+        if ((entry.name == "SEQNUM") && (entry.type == INTE) && (entry.size == 1)) {
+            inte_array[n] = { entry.seqnum };
+            arrayLoaded.push_back(true);
+        } else {
+            arrayLoaded.push_back(false);
+        }
+    }
+
+    this->ifStreamPos.push_back(index->fileSize());
+    this->fromIndex = true;
+
+    return true;
+}
+
 void EclFile::load(bool preload) {
     std::fstream fileH;
 
@@ -50,6 +96,17 @@ void EclFile::load(bool preload) {
     if (!fileH)
         throw std::runtime_error(fmt::format("Can not open EclFile: {}", this->inputFilename));
 
+    if (!formatted) {
+        this->compressed = Compression::readMagic(fileH);
+
+        if (this->loadIndex()) {
+            if (preload)
+                this->loadData();
+
+            return;
+        }
+    }
+
     int n = 0;
     while (!isEOF(&fileH)) {
         std::string arrName(8,' ');
@@ -79,6 +136,8 @@ void EclFile::load(bool preload) {
             if (formatted) {
                 uint64_t sizeOfNextArray = sizeOnDiskFormatted(num, arrType, sizeOfElement);
                 fileH.seekg(static_cast<std::streamoff>(sizeOfNextArray), std::ios_base::cur);
+            } else if (compressed) {
+                Compression::skipPayload(fileH, sizeOnDiskBinary(num, arrType, sizeOfElement));
             } else {
                 uint64_t sizeOfNextArray = sizeOnDiskBinary(num, arrType, sizeOfElement);
                 fileH.seekg(static_cast<std::streamoff>(sizeOfNextArray), std::ios_base::cur);
@@ -120,6 +179,26 @@ void EclFile::loadBinaryArray(std::fstream& fileH, std::size_t arrIndex)
 {
     fileH.seekg (ifStreamPos[arrIndex], fileH.beg);
 
+    if (compressed && (array_size[arrIndex] > 0)) {
+        auto data = this->readCompressedArray(fileH, arrIndex);
+        MemoryBuffer buffer(data);
+        std::istream dataH(&buffer);
+
+        this->readBinaryArrayData(dataH, arrIndex);
+    } else {
+        this->readBinaryArrayData(fileH, arrIndex);
+    }
+}
+
+std::vector<char> EclFile::readCompressedArray(std::istream& fileH, std::size_t arrIndex) const
+{
+    const auto rawSize = sizeOnDiskBinary(array_size[arrIndex], array_type[arrIndex], array_element_size[arrIndex]);
+
+    return Compression::readPayload(fileH, rawSize, Compression::shuffleStride(array_type[arrIndex]));
+}
+
+void EclFile::readBinaryArrayData(std::istream& fileH, std::size_t arrIndex)
+{
     switch (array_type[arrIndex]) {
     case INTE:
         inte_array[arrIndex] = readBinaryInteArray(fileH, array_size[arrIndex]);
@@ -391,6 +470,14 @@ std::vector<unsigned int> EclFile::get_bin_logi_raw_values(int arrIndex) const
 
     fileH.seekg (ifStreamPos[arrIndex], fileH.beg);
 
+    if (compressed && (array_size[arrIndex] > 0)) {
+        auto data = this->readCompressedArray(fileH, arrIndex);
+        MemoryBuffer buffer(data);
+        std::istream dataH(&buffer);
+
+        return readBinaryRawLogiArray(dataH, array_size[arrIndex]);
+    }
+
     std::vector<unsigned int> raw_logi = readBinaryRawLogiArray(fileH, array_size[arrIndex]);
 
     return raw_logi;
@@ -491,6 +578,24 @@ size_t EclFile::count(const std::string &name) const
 }
 
 
+EclFileIndex EclFile::directory()
+{
+    if (formatted)
+        OPM_THROW(std::runtime_error, "Array directory is only supported for binary files");
+
+    EclFileIndex index;
+
+    for (std::size_t i = 0; i < array_name.size(); i++) {
+        const auto seqnum = (array_name[i] == "SEQNUM") && (array_type[i] == INTE) && (array_size[i] == 1)
+            ? this->get<int>(i).front() : 0;
+
+        index.append({array_name[i], array_type[i], array_size[i], array_element_size[i],
+                      static_cast<uint64_t>(this->seekPosition(i)), ifStreamPos[i], seqnum});
+    }
+
+    return index;
+}
+
 std::streampos
 EclFile::seekPosition(const std::vector<std::string>::size_type arrIndex) const
 {
@@ -638,6 +743,235 @@ const std::vector<T>& EclFile::getImpl(int arrIndex, eclArrType type,
 }
 
 
+namespace {
+
+template <typename T>
+struct SubsetType;
+
+template <>
+struct SubsetType<int> {
+    static constexpr eclArrType type = INTE;
+    static int flip(int value) { return flipEndianInt(value); }
+};
+
+template <>
+struct SubsetType<float> {
+    static constexpr eclArrType type = REAL;
+    static float flip(float value) { return flipEndianFloat(value); }
+};
+
+template <>
+struct SubsetType<double> {
+    static constexpr eclArrType type = DOUB;
+    static double flip(double value) { return flipEndianDouble(value); }
+};
+
+void checkSubsetIndices(const std::vector<std::size_t>& indices, int64_t size)
+{
+    if (!std::is_sorted(indices.begin(), indices.end()))
+        OPM_THROW(std::invalid_argument, "Subset indices must be sorted in increasing order");
+
+    if (!indices.empty() && (static_cast<int64_t>(indices.back()) >= size))
+        OPM_THROW(std::invalid_argument, "Subset index " + std::to_string(indices.back()) +
+                  " out of range for array with " + std::to_string(size) + " elements");
+}
+
+}
+
+
+template <typename T>
+std::vector<T> EclFile::getSubset(int arrIndex, const std::vector<std::size_t>& indices)
+{
+    if (array_type[arrIndex] != SubsetType<T>::type) {
+        std::string message = "Array with index " + std::to_string(arrIndex) + " is not of the requested type";
+        OPM_THROW(std::runtime_error, message);
+    }
+
+    checkSubsetIndices(indices, array_size[arrIndex]);
+
+    if (formatted || compressed || arrayLoaded[arrIndex]) {
+        const auto& data = this->get<T>(arrIndex);
+
+        std::vector<T> subset;
+        subset.reserve(indices.size());
+        for (const auto& index : indices)
+            subset.push_back(data[index]);
+
+        return subset;
+    }
+
+    return this->readBinarySubset<T>(arrIndex, indices);
+}
+
+
+/*
+  A binary array is stored as a sequence of Fortran records - blocks - with
+  a four byte head and tail holding the size of the block in bytes. All
+  blocks but the last hold the maximum number of elements, so the position
+  of element 'i' can be calculated directly. For every block with at least
+  one requested element we read from the block head up to the last requested
+  element of the block with one positional read, and verify the block head.
+*/
+template <typename T>
+std::vector<T> EclFile::readBinarySubset(std::size_t arrIndex, const std::vector<std::size_t>& indices) const
+{
+    const auto [element_size, max_block_size] = block_size_data_binary(SubsetType<T>::type);
+    const auto block_elements = static_cast<std::size_t>(max_block_size / element_size);
+    const auto block_bytes = static_cast<std::streamoff>(max_block_size + 2 * sizeof(int));
+    const auto num_elements = static_cast<std::size_t>(array_size[arrIndex]);
+
+    std::ifstream fileH(inputFilename, std::ios::in | std::ios::binary);
+    if (!fileH) {
+        std::string message="Could not open file: '" + inputFilename +"'";
+        OPM_THROW(std::runtime_error, message);
+    }
+
+    std::vector<T> subset;
+    subset.reserve(indices.size());
+
+    std::vector<char> buffer;
+    auto index_iter = indices.begin();
+    while (index_iter != indices.end()) {
+        const std::size_t block = *index_iter / block_elements;
+        const std::size_t block_begin = block * block_elements;
+        const std::size_t block_end = std::min(block_begin + block_elements, num_elements);
+        const auto block_last = std::upper_bound(index_iter, indices.end(), block_end - 1) - 1;
+        const std::size_t read_elements = *block_last - block_begin + 1;
+
+        buffer.resize(sizeof(int) + read_elements * element_size);
+        fileH.seekg(static_cast<std::streamoff>(ifStreamPos[arrIndex]) + block * block_bytes);
+        fileH.read(buffer.data(), buffer.size());
+        if (!fileH)
+            OPM_THROW(std::runtime_error, "Error reading binary data from file: '" + inputFilename + "'");
+
+        int head;
+        std::memcpy(&head, buffer.data(), sizeof(head));
+        if (static_cast<std::size_t>(flipEndianInt(head)) != (block_end - block_begin) * element_size)
+            OPM_THROW(std::runtime_error, "Error reading binary data, inconsistent header data or incorrect number of elements");
+
+        for (; index_iter != block_last + 1; ++index_iter) {
+            T value;
+            std::memcpy(&value, buffer.data() + sizeof(int) + (*index_iter - block_begin) * element_size, sizeof(value));
+            subset.push_back(SubsetType<T>::flip(value));
+        }
+    }
+
+    return subset;
+}
+
+
+template std::vector<int> EclFile::getSubset<int>(int, const std::vector<std::size_t>&);
+template std::vector<float> EclFile::getSubset<float>(int, const std::vector<std::size_t>&);
+template std::vector<double> EclFile::getSubset<double>(int, const std::vector<std::size_t>&);
+
+
+template <typename T>
+std::vector<T> EclFile::getRange(int arrIndex, std::size_t first, std::size_t count)
+{
+    if (array_type[arrIndex] != SubsetType<T>::type) {
+        std::string message = "Array with index " + std::to_string(arrIndex) + " is not of the requested type";
+        OPM_THROW(std::runtime_error, message);
+    }
+
+    if (first + count > static_cast<std::size_t>(array_size[arrIndex])) {
+        std::string message = "Range exceeds size of array with index " + std::to_string(arrIndex);
+        OPM_THROW(std::invalid_argument, message);
+    }
+
+    if (formatted || compressed || arrayLoaded[arrIndex]) {
+        const auto& data = this->get<T>(arrIndex);
+        return { data.begin() + first, data.begin() + first + count };
+    }
+
+    return this->readBinaryRange<T>(arrIndex, first, count);
+}
+
+
+template <typename T>
+std::vector<T> EclFile::getRange(const std::string& name, std::size_t first, std::size_t count)
+{
+    auto search = array_index.find(name);
+
+    if (search == array_index.end()) {
+        std::string message="key '"+name + "' not found";
+        OPM_THROW(std::invalid_argument, message);
+    }
+
+    return this->getRange<T>(search->second, first, count);
+}
+
+
+/*
+  Contiguous elements are read with one positional read from the head of the
+  first block holding a requested element up to the last requested element.
+  The block heads and tails in between are verified and skipped.
+*/
+template <typename T>
+std::vector<T> EclFile::readBinaryRange(std::size_t arrIndex, std::size_t first, std::size_t count) const
+{
+    std::vector<T> range;
+    if (count == 0)
+        return range;
+
+    const auto [element_size, max_block_size] = block_size_data_binary(SubsetType<T>::type);
+    const auto block_elements = static_cast<std::size_t>(max_block_size / element_size);
+    const auto block_bytes = static_cast<std::size_t>(max_block_size) + 2 * sizeof(int);
+    const auto num_elements = static_cast<std::size_t>(array_size[arrIndex]);
+
+    const std::size_t last = first + count - 1;
+    const std::size_t first_block = first / block_elements;
+    const std::size_t last_block = last / block_elements;
+
+    const std::size_t begin_byte = first_block * block_bytes;
+    const std::size_t end_byte = last_block * block_bytes + sizeof(int)
+        + (last - last_block * block_elements + 1) * element_size;
+
+    std::ifstream fileH(inputFilename, std::ios::in | std::ios::binary);
+    if (!fileH) {
+        std::string message="Could not open file: '" + inputFilename +"'";
+        OPM_THROW(std::runtime_error, message);
+    }
+
+    std::vector<char> buffer(end_byte - begin_byte);
+    fileH.seekg(static_cast<std::streamoff>(ifStreamPos[arrIndex] + begin_byte));
+    fileH.read(buffer.data(), buffer.size());
+    if (!fileH)
+        OPM_THROW(std::runtime_error, "Error reading binary data from file: '" + inputFilename + "'");
+
+    range.reserve(count);
+
+    for (std::size_t block = first_block; block <= last_block; ++block) {
+        const char* head = buffer.data() + (block - first_block) * block_bytes;
+        const std::size_t block_begin = block * block_elements;
+        const std::size_t block_end = std::min(block_begin + block_elements, num_elements);
+
+        int size;
+        std::memcpy(&size, head, sizeof(size));
+        if (static_cast<std::size_t>(flipEndianInt(size)) != (block_end - block_begin) * element_size)
+            OPM_THROW(std::runtime_error, "Error reading binary data, inconsistent header data or incorrect number of elements");
+
+        const std::size_t from = std::max(first, block_begin);
+        const std::size_t to = std::min(last + 1, block_end);
+
+        for (std::size_t i = from; i < to; ++i) {
+            T value;
+            std::memcpy(&value, head + sizeof(int) + (i - block_begin) * element_size, sizeof(value));
+            range.push_back(SubsetType<T>::flip(value));
+        }
+    }
+
+    return range;
+}
+
+
+template std::vector<int> EclFile::getRange<int>(int, std::size_t, std::size_t);
+template std::vector<float> EclFile::getRange<float>(int, std::size_t, std::size_t);
+template std::vector<double> EclFile::getRange<double>(int, std::size_t, std::size_t);
+template std::vector<int> EclFile::getRange<int>(const std::string&, std::size_t, std::size_t);
+template std::vector<float> EclFile::getRange<float>(const std::string&, std::size_t, std::size_t);
+template std::vector<double> EclFile::getRange<double>(const std::string&, std::size_t, std::size_t);
+
+
 std::size_t EclFile::size() const {
     return this->array_name.size();
 }
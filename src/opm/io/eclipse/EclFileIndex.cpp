@@ -0,0 +1,156 @@
+/*
+   Copyright 2026 Equinor ASA.
+
+   This file is part of the Open Porous Media project (OPM).
+
+   OPM is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   OPM is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+   */
+
+#include <opm/io/eclipse/EclFileIndex.hpp>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+
+namespace {
+
+const std::string indexMagic = "OPM_ECL_INDEX";
+constexpr int indexVersion = 1;
+
+bool validType(int type)
+{
+    return (type >= Opm::EclIO::INTE) && (type <= Opm::EclIO::C0NN);
+}
+
+} // Anonymous namespace
+
+namespace Opm { namespace EclIO {
+
+std::string EclFileIndex::fileName(const std::string& filename)
+{
+    return filename + ".IDX";
+}
+
+std::optional<EclFileIndex> EclFileIndex::load(const std::string& filename)
+{
+    namespace fs = std::filesystem;
+
+    const auto indexName = fileName(filename);
+
+    std::error_code ec;
+    const auto fileSize = fs::file_size(filename, ec);
+    if (ec)
+        return std::nullopt;
+
+    // An index older than its result file was not written by the last
+    // writer of that file.
+    const auto fileTime = fs::last_write_time(filename, ec);
+    const auto indexTime = ec ? fileTime : fs::last_write_time(indexName, ec);
+    if (ec || (indexTime < fileTime))
+        return std::nullopt;
+
+    std::ifstream is(indexName);
+    if (!is)
+        return std::nullopt;
+
+    std::string magic, key;
+    int version = 0;
+    std::size_t numArrays = 0;
+
+    EclFileIndex index;
+
+    is >> magic >> version
+       >> key >> index.file_size_;
+
+    if (!is || (magic != indexMagic) || (version != indexVersion) ||
+        (key != "FILESIZE") || (index.file_size_ != fileSize))
+        return std::nullopt;
+
+    is >> key >> numArrays;
+    if (!is || (key != "ARRAYS"))
+        return std::nullopt;
+
+    index.entries_.reserve(numArrays);
+
+    uint64_t prevData = 0;
+    for (std::size_t i = 0; i < numArrays; i++) {
+        Entry entry;
+        int type = 0;
+
+        is >> std::quoted(entry.name, '\'') >> type >> entry.size
+           >> entry.element_size >> entry.header >> entry.data >> entry.seqnum;
+
+        if (!is || !validType(type) || (entry.header < prevData) ||
+            (entry.data <= entry.header) || (entry.data > fileSize))
+            return std::nullopt;
+
+        entry.type = static_cast<eclArrType>(type);
+        prevData = entry.data;
+
+        index.entries_.push_back(std::move(entry));
+    }
+
+    return index;
+}
+
+void EclFileIndex::save(const std::string& filename)
+{
+    namespace fs = std::filesystem;
+
+    this->file_size_ = fs::file_size(filename);
+
+    // Write to temporary file and rename, so readers never see a partial index.
+    const auto indexName = fileName(filename);
+    const auto tmpName = indexName + ".tmp";
+
+    {
+        std::ofstream os(tmpName);
+        if (!os)
+            throw std::runtime_error("Unable to open index file '" + tmpName + "' for writing");
+
+        os << indexMagic << ' ' << indexVersion << '\n'
+           << "FILESIZE " << this->file_size_ << '\n'
+           << "ARRAYS " << this->entries_.size() << '\n';
+
+        for (const auto& entry : this->entries_) {
+            os << std::quoted(entry.name, '\'') << ' ' << static_cast<int>(entry.type) << ' '
+               << entry.size << ' ' << entry.element_size << ' '
+               << entry.header << ' ' << entry.data << ' ' << entry.seqnum << '\n';
+        }
+
+        if (!os.flush())
+            throw std::runtime_error("Unable to write index file '" + tmpName + "'");
+    }
+
+    fs::rename(tmpName, indexName);
+}
+
+void EclFileIndex::remove(const std::string& filename)
+{
+    std::error_code ec;
+    std::filesystem::remove(fileName(filename), ec);
+}
+
+void EclFileIndex::truncate(uint64_t position)
+{
+    auto end = std::find_if(this->entries_.begin(), this->entries_.end(),
+                            [position](const Entry& entry) { return entry.header >= position; });
+
+    this->entries_.erase(end, this->entries_.end());
+}
+
+}} // namespace Opm::EclIO
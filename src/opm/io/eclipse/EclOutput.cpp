@@ -17,6 +17,7 @@
    */
 
 #include <opm/io/eclipse/EclOutput.hpp>
+#include <opm/io/eclipse/EclCompression.hpp>
 #include <opm/io/eclipse/EclUtil.hpp>
 
 #include <opm/common/ErrorMacros.hpp>
@@ -32,20 +33,35 @@
 #include <sstream>
 #include <stdexcept>
 #include <typeinfo>
+#include <type_traits>
 
 namespace Opm { namespace EclIO {
 
 EclOutput::EclOutput(const std::string&            filename,
                      const bool                    formatted,
-                     const std::ios_base::openmode mode)
+                     const std::ios_base::openmode mode,
+                     const bool                    compressed)
     : isFormatted{formatted}
 {
+    if (formatted && compressed)
+        OPM_THROW(std::invalid_argument, "Compressed output is only supported for binary files");
+
     const auto binmode = mode | std::ios_base::binary;
     ix_standard = false;
 
     this->ofileH.open(filename, this->isFormatted ? mode : binmode);
+
+    if (compressed) {
+        this->compressor = std::make_unique<Compression::ChunkWriter>();
+        this->compressed_data.rdbuf(this->compressor.get());
+
+        if (!(mode & std::ios_base::app))
+            this->ofileH.write(Compression::magic.data(), Compression::magic.size());
+    }
 }
 
+EclOutput::~EclOutput() = default;
+
 
 template<>
 void EclOutput::write<std::string>(const std::string& name,
@@ -156,11 +172,182 @@ void EclOutput::flushStream()
     this->ofileH.flush();
 }
 
+void EclOutput::finishArray()
+{
+    if (this->compressor)
+        this->compressor->finish();
+}
+
+namespace {
+
+template <typename T>
+eclArrType chunkedArrayType()
+{
+    if constexpr (std::is_same_v<T, int>)
+        return INTE;
+    else if constexpr (std::is_same_v<T, float>)
+        return REAL;
+    else
+        return DOUB;
+}
+
+}
+
+template <typename T>
+void EclOutput::beginArray(const std::string& name, int64_t size)
+{
+    if (this->chunked_array.has_value())
+        OPM_THROW(std::logic_error, "beginArray() called for " + name + " while another chunked array is open");
+
+    if (!ofileH.is_open())
+        OPM_THROW(std::runtime_error, "fstream fileH not open for writing");
+
+    const auto arrType = chunkedArrayType<T>();
+    const int element_size = (arrType == DOUB) ? 8 : 4;
+
+    if (isFormatted)
+        writeFormattedHeader(name, size, arrType, element_size);
+    else
+        writeBinaryHeader(name, size, arrType, element_size);
+
+    this->chunked_array = ChunkedArray{arrType, size, 0, 0};
+}
+
+template <typename T>
+void EclOutput::appendChunk(const T* data, std::size_t count)
+{
+    if (!this->chunked_array.has_value() || this->chunked_array->arrType != chunkedArrayType<T>())
+        OPM_THROW(std::logic_error, "appendChunk() called without a matching beginArray()");
+
+    if (this->chunked_array->written + static_cast<int64_t>(count) > this->chunked_array->size)
+        OPM_THROW(std::logic_error, "appendChunk() writes beyond the declared array size");
+
+    if (isFormatted)
+        appendFormattedChunk(data, count);
+    else
+        appendBinaryChunk(data, count);
+}
+
+void EclOutput::endArray()
+{
+    if (!this->chunked_array.has_value())
+        OPM_THROW(std::logic_error, "endArray() called without a matching beginArray()");
+
+    const auto array = this->chunked_array.value();
+    this->chunked_array.reset();
+
+    if (array.written != array.size)
+        OPM_THROW(std::logic_error, "endArray() called before all declared elements were written");
+
+    if (isFormatted) {
+        const auto sizeData = block_size_data_formatted(array.arrType);
+        const int maxBlockSize = std::get<0>(sizeData);
+        const int nColumns = std::get<1>(sizeData);
+        const int n = array.size % maxBlockSize;
+
+        if ((n % nColumns) != 0)
+            ofileH << std::endl;
+    }
+    else
+        this->finishArray();
+}
+
+template <typename T>
+void EclOutput::appendBinaryChunk(const T* data, std::size_t count)
+{
+    auto& array = this->chunked_array.value();
+
+    const auto sizeData = block_size_data_binary(array.arrType);
+    const int sizeOfElement = std::get<0>(sizeData);
+    const int64_t maxNumberOfElements = std::get<1>(sizeData) / sizeOfElement;
+
+    std::vector<T> flipped_data;
+    std::size_t offset = 0;
+
+    while (offset < count) {
+        const int64_t pos_in_record = array.written % maxNumberOfElements;
+        if (pos_in_record == 0) {
+            array.record_size = std::min(maxNumberOfElements, array.size - array.written);
+            const int dhead = flipEndianInt(array.record_size * sizeOfElement);
+            dataStream().write(reinterpret_cast<const char*>(&dhead), sizeof(dhead));
+        }
+
+        const auto num = static_cast<std::size_t>(std::min(array.record_size - pos_in_record,
+                                                           static_cast<int64_t>(count - offset)));
+
+        flipped_data.resize(num);
+        for (std::size_t m = 0; m < num; m++) {
+            if constexpr (std::is_same_v<T, int>)
+                flipped_data[m] = flipEndianInt(data[offset + m]);
+            else if constexpr (std::is_same_v<T, float>)
+                flipped_data[m] = flipEndianFloat(data[offset + m]);
+            else
+                flipped_data[m] = flipEndianDouble(data[offset + m]);
+        }
+
+        dataStream().write(reinterpret_cast<const char*>(flipped_data.data()), num * sizeof(T));
+
+        offset += num;
+        array.written += num;
+
+        if (pos_in_record + static_cast<int64_t>(num) == array.record_size) {
+            const int dhead = flipEndianInt(array.record_size * sizeOfElement);
+            dataStream().write(reinterpret_cast<const char*>(&dhead), sizeof(dhead));
+        }
+    }
+}
+
+template <typename T>
+void EclOutput::appendFormattedChunk(const T* data, std::size_t count)
+{
+    auto& array = this->chunked_array.value();
+
+    const auto sizeData = block_size_data_formatted(array.arrType);
+    const int maxBlockSize = std::get<0>(sizeData);
+    const int nColumns = std::get<1>(sizeData);
+    const int columnWidth = std::get<2>(sizeData);
+
+    for (std::size_t i = 0; i < count; i++) {
+        writeFormattedValue(data[i], columnWidth);
+        array.written++;
+
+        const int n = ((array.written - 1) % maxBlockSize) + 1;
+        if ((n % nColumns) == 0 || n == maxBlockSize)
+            ofileH << std::endl;
+    }
+}
+
+template <typename T>
+void EclOutput::writeFormattedValue(const T& value, int columnWidth)
+{
+    if constexpr (std::is_same_v<T, int>)
+        ofileH << std::setw(columnWidth) << value;
+    else if constexpr (std::is_same_v<T, float>)
+        ofileH << std::setw(columnWidth) << (ix_standard ? make_real_string_ix(value) : make_real_string_ecl(value));
+    else
+        ofileH << std::setw(columnWidth) << (ix_standard ? make_doub_string_ix(value) : make_doub_string_ecl(value));
+}
+
+template void EclOutput::beginArray<int>(const std::string& name, int64_t size);
+template void EclOutput::beginArray<float>(const std::string& name, int64_t size);
+template void EclOutput::beginArray<double>(const std::string& name, int64_t size);
+template void EclOutput::appendChunk<int>(const int* data, std::size_t count);
+template void EclOutput::appendChunk<float>(const float* data, std::size_t count);
+template void EclOutput::appendChunk<double>(const double* data, std::size_t count);
+
 void EclOutput::writeBinaryHeader(const std::string&arrName, int64_t size, eclArrType arrType, int element_size)
 {
     int bhead = flipEndianInt(16);
     std::string name = arrName + std::string(8 - arrName.size(),' ');
 
+    if (this->written_arrays.has_value()) {
+        const uint64_t header = ofileH.tellp();
+        this->written_arrays->push_back({trimr(name), arrType, size, element_size, header, 0});
+    }
+
+    if (this->compressor)
+        this->compressor->begin(arrType, this->ofileH);
+
     // write X231 header if size larger that limits for 4 byte integers
     if (size > std::numeric_limits<int>::max()) {
         int64_t val231 = std::pow(2,31);
@@ -217,6 +404,9 @@ void EclOutput::writeBinaryHeader(const std::string&arrName, int64_t size, eclAr
     }
 
     ofileH.write(reinterpret_cast<char *>(&bhead), sizeof(bhead));
+
+    if (this->written_arrays.has_value())
+        this->written_arrays->back().data = ofileH.tellp();
 }
 
 template <typename T>
@@ -266,7 +456,7 @@ void EclOutput::writeBinaryArray(const std::vector<T>& data)
 
         dhead = flipEndianInt(num * sizeOfElement);
 
-        ofileH.write(reinterpret_cast<char*>(&dhead), sizeof(dhead));
+        dataStream().write(reinterpret_cast<char*>(&dhead), sizeof(dhead));
 
         if (arrType == INTE) {
 
@@ -276,7 +466,7 @@ void EclOutput::writeBinaryArray(const std::vector<T>& data)
             for (int m = 0; m < num; m++)
                 flipped_data[m] = flipEndianInt(data[m + offset]);
 
-            ofileH.write((char*)(flipped_data.data()), flipped_data.size() * sizeof(int)) ;
+            dataStream().write((char*)(flipped_data.data()), flipped_data.size() * sizeof(int)) ;
 
         } else if (arrType == REAL) {
 
@@ -286,7 +476,7 @@ void EclOutput::writeBinaryArray(const std::vector<T>& data)
             for (int m = 0; m < num; m++)
                 flipped_data[m] = flipEndianFloat(data[m + offset]);
 
-            ofileH.write((char*)(flipped_data.data()), flipped_data.size() * sizeof(float)) ;
+            dataStream().write((char*)(flipped_data.data()), flipped_data.size() * sizeof(float)) ;
 
         } else if (arrType == DOUB) {
 
@@ -296,7 +486,7 @@ void EclOutput::writeBinaryArray(const std::vector<T>& data)
             for (int m = 0; m < num; m++)
                 flipped_data[m] = flipEndianDouble(data[m + offset]);
 
-            ofileH.write((char*)(flipped_data.data()), flipped_data.size() * sizeof(double)) ;
+            dataStream().write((char*)(flipped_data.data()), flipped_data.size() * sizeof(double)) ;
 
         } else if (arrType == LOGI) {
 
@@ -309,7 +499,7 @@ void EclOutput::writeBinaryArray(const std::vector<T>& data)
                 else
                     logi_data[m] = false_value;
 
-            ofileH.write((char*)(logi_data.data()), logi_data.size() * sizeof(int)) ;
+            dataStream().write((char*)(logi_data.data()), logi_data.size() * sizeof(int)) ;
 
         } else {
 
@@ -318,8 +508,10 @@ void EclOutput::writeBinaryArray(const std::vector<T>& data)
         }
 
         offset += num;
-        ofileH.write(reinterpret_cast<char*>(&dhead), sizeof(dhead));
+        dataStream().write(reinterpret_cast<char*>(&dhead), sizeof(dhead));
     }
+
+    this->finishArray();
 }
 
 
@@ -365,16 +557,18 @@ void EclOutput::writeBinaryCharArray(const std::vector<std::string>& data, int e
 
         dhead = flipEndianInt(num * sizeOfElement);
 
-        ofileH.write(reinterpret_cast<char*>(&dhead), sizeof(dhead));
+        dataStream().write(reinterpret_cast<char*>(&dhead), sizeof(dhead));
 
         for (int i = 0; i < num; i++) {
             std::string tmpStr = data[n] + std::string(sizeOfElement - data[n].size(),' ');
-            ofileH.write(tmpStr.c_str(), sizeOfElement);
+            dataStream().write(tmpStr.c_str(), sizeOfElement);
             n++;
         }
 
-        ofileH.write(reinterpret_cast<char*>(&dhead), sizeof(dhead));
+        dataStream().write(reinterpret_cast<char*>(&dhead), sizeof(dhead));
     }
+
+    this->finishArray();
 }
 
 void EclOutput::writeBinaryCharArray(const std::vector<PaddedOutputString<8>>& data)
@@ -403,14 +597,16 @@ void EclOutput::writeBinaryCharArray(const std::vector<PaddedOutputString<8>>& d
 
         auto dhead = flipEndianInt(numElm * sizeOfElement);
 
-        ofileH.write(reinterpret_cast<char*>(&dhead), sizeof(dhead));
+        dataStream().write(reinterpret_cast<char*>(&dhead), sizeof(dhead));
 
         for (auto i = 0*numElm; i < numElm; ++i, ++elm) {
-            ofileH.write(elm->c_str(), sizeOfElement);
+            dataStream().write(elm->c_str(), sizeOfElement);
         }
 
-        ofileH.write(reinterpret_cast<char*>(&dhead), sizeof(dhead));
+        dataStream().write(reinterpret_cast<char*>(&dhead), sizeof(dhead));
     }
+
+    this->finishArray();
 }
 
 void EclOutput::writeFormattedHeader(const std::string& arrName, int size, eclArrType arrType, int element_size)
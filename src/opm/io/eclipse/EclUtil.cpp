@@ -418,7 +418,7 @@ void Opm::EclIO::readFormattedHeader(std::fstream& fileH, std::string& arrName,
 }
 
 template<typename T, typename T2>
-std::vector<T> Opm::EclIO::readBinaryArray(std::fstream& fileH, const int64_t size, Opm::EclIO::eclArrType type,
+std::vector<T> Opm::EclIO::readBinaryArray(std::istream& fileH, const int64_t size, Opm::EclIO::eclArrType type,
                                std::function<T(T2)>& flip, int elementSize)
 {
     std::vector<T> arr;
@@ -484,27 +484,27 @@ std::vector<T> Opm::EclIO::readBinaryArray(std::fstream& fileH, const int64_t si
 }
 
 
-std::vector<int> Opm::EclIO::readBinaryInteArray(std::fstream &fileH, const int64_t size)
+std::vector<int> Opm::EclIO::readBinaryInteArray(std::istream& fileH, const int64_t size)
 {
     std::function<int(int)> f = Opm::EclIO::flipEndianInt;
     return readBinaryArray<int,int>(fileH, size, Opm::EclIO::INTE, f, sizeOfInte);
 }
 
 
-std::vector<float> Opm::EclIO::readBinaryRealArray(std::fstream& fileH, const int64_t size)
+std::vector<float> Opm::EclIO::readBinaryRealArray(std::istream& fileH, const int64_t size)
 {
     std::function<float(float)> f = Opm::EclIO::flipEndianFloat;
     return readBinaryArray<float,float>(fileH, size, Opm::EclIO::REAL, f, sizeOfReal);
 }
 
 
-std::vector<double> Opm::EclIO::readBinaryDoubArray(std::fstream& fileH, const int64_t size)
+std::vector<double> Opm::EclIO::readBinaryDoubArray(std::istream& fileH, const int64_t size)
 {
     std::function<double(double)> f = Opm::EclIO::flipEndianDouble;
     return readBinaryArray<double,double>(fileH, size, Opm::EclIO::DOUB, f, sizeOfDoub);
 }
 
-std::vector<bool> Opm::EclIO::readBinaryLogiArray(std::fstream &fileH, const int64_t size)
+std::vector<bool> Opm::EclIO::readBinaryLogiArray(std::istream& fileH, const int64_t size)
 {
     std::function<bool(unsigned int)> f = [](unsigned int intVal)
                                           {
@@ -524,7 +524,7 @@ std::vector<bool> Opm::EclIO::readBinaryLogiArray(std::fstream &fileH, const int
     return readBinaryArray<bool,unsigned int>(fileH, size, Opm::EclIO::LOGI, f, sizeOfLogi);
 }
 
-std::vector<unsigned int> Opm::EclIO::readBinaryRawLogiArray(std::fstream &fileH, const int64_t size)
+std::vector<unsigned int> Opm::EclIO::readBinaryRawLogiArray(std::istream& fileH, const int64_t size)
 {
     std::function<unsigned int(unsigned int)> f = [](unsigned int intVal)
                                           {
@@ -534,7 +534,7 @@ std::vector<unsigned int> Opm::EclIO::readBinaryRawLogiArray(std::fstream &fileH
 }
 
 
-std::vector<std::string> Opm::EclIO::readBinaryCharArray(std::fstream& fileH, const int64_t size)
+std::vector<std::string> Opm::EclIO::readBinaryCharArray(std::istream& fileH, const int64_t size)
 {
     using Char8 = std::array<char, 8>;
     std::function<std::string(Char8)> f = [](const Char8& val)
@@ -546,7 +546,7 @@ std::vector<std::string> Opm::EclIO::readBinaryCharArray(std::fstream& fileH, co
 }
 
 
-std::vector<std::string> Opm::EclIO::readBinaryC0nnArray(std::fstream& fileH, const int64_t size, int elementSize)
+std::vector<std::string> Opm::EclIO::readBinaryC0nnArray(std::istream& fileH, const int64_t size, int elementSize)
 {
     std::function<std::string(std::string)> f = [](const std::string& val)
                                           {
@@ -26,6 +26,8 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <ctime>
 #include <exception>
 #include <filesystem>
@@ -103,11 +105,12 @@ namespace {
         {
             std::unique_ptr<Opm::EclIO::EclOutput>
             write(const std::string& filename,
-                  const bool         isFmt)
+                  const bool         isFmt,
+                  const bool         isCompressed)
             {
                 return std::unique_ptr<Opm::EclIO::EclOutput> {
                     new Opm::EclIO::EclOutput {
-                        filename, isFmt, std::ios_base::out
+                        filename, isFmt, std::ios_base::out, isCompressed
                     }
                 };
             }
@@ -144,22 +147,24 @@ namespace {
 
             std::unique_ptr<Opm::EclIO::EclOutput>
             writeNew(const std::string& filename,
-                     const bool         isFmt)
+                     const bool         isFmt,
+                     const bool         isCompressed)
             {
                 return std::unique_ptr<Opm::EclIO::EclOutput> {
                     new Opm::EclIO::EclOutput {
-                        filename, isFmt, std::ios_base::out
+                        filename, isFmt, std::ios_base::out, isCompressed
                     }
                 };
             }
 
             std::unique_ptr<Opm::EclIO::EclOutput>
             writeExisting(const std::string& filename,
-                          const bool         isFmt)
+                          const bool         isFmt,
+                          const bool         isCompressed)
             {
                 return std::unique_ptr<Opm::EclIO::EclOutput> {
                     new Opm::EclIO::EclOutput {
-                        filename, isFmt, std::ios_base::app
+                        filename, isFmt, std::ios_base::app, isCompressed
                     }
                 };
             }
@@ -209,12 +214,13 @@ namespace {
 // =====================================================================
 
 Opm::EclIO::OutputStream::Init::
-Init(const ResultSet& rset,
-     const Formatted& fmt)
+Init(const ResultSet&  rset,
+     const Formatted&  fmt,
+     const Compressed& comp)
 {
     const auto fname = outputFileName(rset, FileExtension::init(fmt.set));
 
-    this->open(fname, fmt.set);
+    this->open(fname, fmt.set, comp.set);
 }
 
 Opm::EclIO::OutputStream::Init::~Init()
@@ -263,9 +269,10 @@ write(const std::string& kw, const std::vector<double>& data)
 void
 Opm::EclIO::OutputStream::Init::
 open(const std::string& fname,
-     const bool         formatted)
+     const bool         formatted,
+     const bool         compressed)
 {
-    this->stream_ = Open::Init::write(fname, formatted);
+    this->stream_ = Open::Init::write(fname, formatted, compressed);
 }
 
 Opm::EclIO::EclOutput&
@@ -288,10 +295,11 @@ namespace Opm { namespace EclIO { namespace OutputStream {
 // =====================================================================
 
 Opm::EclIO::OutputStream::Restart::
-Restart(const ResultSet& rset,
-        const int        seqnum,
-        const Formatted& fmt,
-        const Unified&   unif)
+Restart(const ResultSet&  rset,
+        const int         seqnum,
+        const Formatted&  fmt,
+        const Unified&    unif,
+        const Compressed& comp)
 {
     const auto ext = FileExtension::
         restart(seqnum, fmt.set, unif.set);
@@ -300,29 +308,41 @@ Restart(const ResultSet& rset,
 
     if (unif.set) {
         // Run uses unified restart files.
-        this->openUnified(fname, fmt.set, seqnum);
+        this->openUnified(fname, fmt.set, comp.set, seqnum);
 
         // Write SEQNUM value to stream to start new output sequence.
         this->stream_->write("SEQNUM", std::vector<int>{ seqnum });
+
+        if (this->index_.has_value()) {
+            this->stream_->written_arrays->back().seqnum = seqnum;
+        }
     }
     else {
         // Run uses separate, not unified, restart files.  Create a
         // new output file and open an output stream on it.
-        this->openNew(fname, fmt.set);
+        this->openNew(fname, fmt.set, comp.set);
     }
 }
 
 Opm::EclIO::OutputStream::Restart::~Restart()
-{}
+{
+    this->saveIndex();
+}
 
 Opm::EclIO::OutputStream::Restart::Restart(Restart&& rhs)
     : stream_{ std::move(rhs.stream_) }
+    , fname_ { std::move(rhs.fname_) }
+    , index_ { std::exchange(rhs.index_, std::nullopt) }
 {}
 
 Opm::EclIO::OutputStream::Restart&
 Opm::EclIO::OutputStream::Restart::operator=(Restart&& rhs)
 {
+    this->saveIndex();
+
     this->stream_ = std::move(rhs.stream_);
+    this->fname_ = std::move(rhs.fname_);
+    this->index_ = std::exchange(rhs.index_, std::nullopt);
 
     return *this;
 }
@@ -379,6 +399,7 @@ void
 Opm::EclIO::OutputStream::Restart::
 openUnified(const std::string& fname,
             const bool         formatted,
+            const bool         compressed,
             const int          seqnum)
 {
     // Determine if we're creating a new output/restart file or
@@ -386,9 +407,16 @@ openUnified(const std::string& fname,
     // write position.
     auto rst = Open::Restart::read(fname);
 
+    // Any existing sidecar index describes the file before this write.
+    EclFileIndex::remove(fname);
+
     if (rst == nullptr) {
         // No such unified restart file exists.  Create new file.
-        this->openNew(fname, formatted);
+        this->openNew(fname, formatted, compressed);
+
+        if (! formatted) {
+            this->startIndex(fname, EclFileIndex{});
+        }
     }
     else if (! rst->hasKey("SEQNUM")) {
         // File with correct filename exists but does not appear
@@ -399,30 +427,89 @@ openUnified(const std::string& fname,
             + "' does not appear to be a unified restart file"
         };
     }
+    else if (rst->compressedInput() != compressed) {
+        // Appending would mix compressed and uncompressed arrays.
+        throw std::invalid_argument {
+            "Existing unified restart file '"
+            + std::filesystem::path{fname}.filename().string()
+            + (compressed ? "' is not compressed" : "' is compressed")
+        };
+    }
     else {
         // Restart file exists and appears to be a unified restart
         // resource.  Open writable restart stream backed by the
         // specific file.
-        this->openExisting(fname, formatted,
-                           rst->restartStepWritePosition(seqnum));
+        const auto writePos = rst->restartStepWritePosition(seqnum);
+
+        this->openExisting(fname, formatted, compressed, writePos);
+
+        if (! formatted) {
+            auto index = rst->directory();
+
+            if (writePos != std::streampos(-1)) {
+                index.truncate(static_cast<std::uint64_t>(writePos));
+            }
+
+            this->startIndex(fname, std::move(index));
+        }
+    }
+}
+
+void
+Opm::EclIO::OutputStream::Restart::
+startIndex(const std::string& fname, EclFileIndex&& index)
+{
+    // Output position of a stream opened in append mode is not
+    // reported by tellp() until it's explicitly placed at EOF.
+    this->stream_->ofileH.seekp(0, std::ios_base::end);
+    this->stream_->written_arrays.emplace();
+
+    this->fname_ = fname;
+    this->index_ = std::move(index);
+}
+
+void
+Opm::EclIO::OutputStream::Restart::saveIndex()
+{
+    if (! this->index_.has_value() || (this->stream_ == nullptr)) {
+        return;
     }
+
+    try {
+        this->stream_->flushStream();
+
+        for (const auto& entry : *this->stream_->written_arrays) {
+            this->index_->append(entry);
+        }
+
+        this->index_->save(this->fname_);
+    }
+    catch (const std::exception&) {
+        // The index is an optimisation only.  Readers fall back to
+        // scanning the restart file if it's missing.
+        EclFileIndex::remove(this->fname_);
+    }
+
+    this->index_.reset();
 }
 
 void
 Opm::EclIO::OutputStream::Restart::
 openNew(const std::string& fname,
-        const bool         formatted)
+        const bool         formatted,
+        const bool         compressed)
 {
-    this->stream_ = Open::Restart::writeNew(fname, formatted);
+    this->stream_ = Open::Restart::writeNew(fname, formatted, compressed);
 }
 
 void
 Opm::EclIO::OutputStream::Restart::
 openExisting(const std::string&   fname,
              const bool           formatted,
+             const bool           compressed,
              const std::streampos writePos)
 {
-    this->stream_ = Open::Restart::writeExisting(fname, formatted);
+    this->stream_ = Open::Restart::writeExisting(fname, formatted, compressed);
 
     if (writePos == std::streampos(-1)) {
         // No specified initial write position.  Typically the case if
@@ -115,10 +115,28 @@ public:
     const std::vector<ElmType>&
     getKeyword(const std::string& vector, const int occurrence)
     {
+        auto pos = this->arrayIndex_.find(vector);
+        if ((pos != this->arrayIndex_.end()) && (occurrence >= 0) &&
+            (static_cast<std::size_t>(occurrence) < pos->second.size()))
+        {
+            return this->rst_file_->
+                getRestartData<ElmType>(pos->second[occurrence], this->report_step_);
+        }
+
         return this->rst_file_->
             getRestartData<ElmType>(vector, this->report_step_, occurrence);
     }
 
+    template <typename ElmType>
+    std::vector<ElmType>
+    getKeywordSubset(const std::string&              vector,
+                     const std::vector<std::size_t>& indices,
+                     const int                       occurrence)
+    {
+        return this->rst_file_->
+            getRestartDataSubset<ElmType>(vector, this->report_step_, indices, occurrence);
+    }
+
     const std::vector<int>& intehead()
     {
         const auto ihkw = std::string { "INTEHEAD" };
@@ -165,12 +183,17 @@ private:
     using TypedColl  = std::unordered_map<
         eclArrType, VectorColl, std::hash<int>
         >;
+    using IndexColl  = std::unordered_map<std::string, std::vector<int>>;
 
     RstFile     rst_file_;
     int         report_step_;
     std::size_t sim_step_;
     TypedColl   vectors_;
 
+    // Position within the report step of each occurrence of each vector,
+    // so repeated getKeyword() calls need not search the array names.
+    IndexColl   arrayIndex_;
+
     bool collectionContains(const VectorColl&  coll,
                             const std::string& vector) const
     {
@@ -192,8 +215,10 @@ Implementation(std::shared_ptr<ERst> restart_file,
 
     this->rst_file_->loadReportStepNumber(this->report_step_);
 
-    for (const auto& vector : this->rst_file_->listOfRstArrays(this->report_step_)) {
-        const auto& type = std::get<1>(vector);
+    const auto arrays = this->rst_file_->listOfRstArrays(this->report_step_);
+    for (auto i = 0*arrays.size(); i < arrays.size(); ++i) {
+        const auto& [name, type, size] = arrays[i];
+        static_cast<void>(size);
 
         switch (type) {
         case ::Opm::EclIO::eclArrType::MESS:
@@ -201,7 +226,8 @@ Implementation(std::shared_ptr<ERst> restart_file,
             continue;
 
         default:
-            this->vectors_[type].emplace(std::get<0>(vector));
+            this->vectors_[type].emplace(name);
+            this->arrayIndex_[name].push_back(static_cast<int>(i));
             break;
         }
     }
@@ -213,6 +239,7 @@ Implementation(Implementation&& rhs)
     , report_step_(rhs.report_step_)
     , sim_step_   (rhs.sim_step_)            // Scalar (size_t)
     , vectors_    (std::move(rhs.vectors_))
+    , arrayIndex_ (std::move(rhs.arrayIndex_))
 {}
 
 Opm::EclIO::RestartFileView::Implementation&
@@ -222,6 +249,7 @@ Opm::EclIO::RestartFileView::Implementation::operator=(Implementation&& rhs)
     this->report_step_ = rhs.report_step_;         // Scalar (int)
     this->sim_step_    = rhs.sim_step_;            // Scalar (size_t)
     this->vectors_     = std::move(rhs.vectors_);
+    this->arrayIndex_  = std::move(rhs.arrayIndex_);
 
     return *this;
 }
@@ -289,6 +317,15 @@ Opm::EclIO::RestartFileView::getKeyword(const std::string& vector,
     return this->pImpl_->template getKeyword<ElmType>(vector, occurrence);
 }
 
+template <typename ElmType>
+std::vector<ElmType>
+Opm::EclIO::RestartFileView::getKeywordSubset(const std::string&              vector,
+                                              const std::vector<std::size_t>& indices,
+                                              const int                       occurrence) const
+{
+    return this->pImpl_->template getKeywordSubset<ElmType>(vector, indices, occurrence);
+}
+
 // =====================================================================
 
 namespace Opm { namespace EclIO {
@@ -314,4 +351,13 @@ RestartFileView::getKeyword<double>(const std::string&, const int) const;
 template const std::vector<std::string>&
 RestartFileView::getKeyword<std::string>(const std::string&, const int) const;
 
+template std::vector<int>
+RestartFileView::getKeywordSubset<int>(const std::string&, const std::vector<std::size_t>&, const int) const;
+
+template std::vector<float>
+RestartFileView::getKeywordSubset<float>(const std::string&, const std::vector<std::size_t>&, const int) const;
+
+template std::vector<double>
+RestartFileView::getKeywordSubset<double>(const std::string&, const std::vector<std::size_t>&, const int) const;
+
 }} // Opm::EclIO
@@ -46,6 +46,7 @@
 #include <opm/output/eclipse/WriteRestartHelpers.hpp>
 
 #include <algorithm>
+#include <cstddef>
 #include <iterator>
 #include <memory>
 #include <numeric>
@@ -74,6 +75,32 @@ namespace {
     {
         return Opm::UDQ::updateType(iudq[udq_index * Opm::UDQDims::entriesPerIUDQ()]);
     }
+
+    // The wells, with their connections and segments, are independent of
+    // each other and are constructed concurrently in models with many
+    // wells.  makeWell(iw) returns the RstWell of well 'iw'; the wells are
+    // appended to 'wells' in restart file order.
+    template <typename MakeWell>
+    void load_wells(const int                             num_wells,
+                    MakeWell&&                            makeWell,
+                    std::vector<Opm::RestartIO::RstWell>& wells)
+    {
+        const auto min_concurrent_wells = 64;
+        const auto nw = static_cast<std::size_t>(std::max(num_wells, 0));
+
+        auto loaded = std::vector<std::optional<Opm::RestartIO::RstWell>>(nw);
+
+        Opm::RestartIO::Helpers::runConcurrently(nw, 16, num_wells >= min_concurrent_wells,
+            [&loaded, &makeWell](const std::size_t iw)
+        {
+            loaded[iw].emplace(makeWell(static_cast<int>(iw)));
+        });
+
+        wells.reserve(wells.size() + nw);
+        for (auto& well : loaded) {
+            wells.push_back(std::move(*well));
+        }
+    }
 }
 
 namespace VI = ::Opm::RestartIO::Helpers::VectorItems;
@@ -173,7 +200,8 @@ void RstState::add_wells(const std::vector<std::string>& zwel,
                          const std::vector<float>& scon,
                          const std::vector<double>& xcon) {
 
-    for (int iw = 0; iw < this->header.num_wells; iw++) {
+    auto make_well = [this, &zwel, &iwel, &swel, &xwel, &icon, &scon, &xcon](const int iw)
+    {
         std::size_t zwel_offset = iw * this->header.nzwelz;
         std::size_t iwel_offset = iw * this->header.niwelz;
         std::size_t swel_offset = iw * this->header.nswelz;
@@ -182,22 +210,26 @@ void RstState::add_wells(const std::vector<std::string>& zwel,
         std::size_t scon_offset = iw * this->header.nsconz * this->header.ncwmax;
         std::size_t xcon_offset = iw * this->header.nxconz * this->header.ncwmax;
         int group_index = iwel[ iwel_offset + VI::IWell::Group ] - 1;
-        const std::string group = this->groups[group_index].name;
-
-        this->wells.emplace_back(this->unit_system,
-                                 this->header,
-                                 group,
-                                 zwel.data() + zwel_offset,
-                                 iwel.data() + iwel_offset,
-                                 swel.data() + swel_offset,
-                                 xwel.data() + xwel_offset,
-                                 icon.data() + icon_offset,
-                                 scon.data() + scon_offset,
-                                 xcon.data() + xcon_offset);
-
-        if (this->wells.back().msw_index)
+        const std::string& group = this->groups[group_index].name;
+
+        auto well = RstWell(this->unit_system,
+                            this->header,
+                            group,
+                            zwel.data() + zwel_offset,
+                            iwel.data() + iwel_offset,
+                            swel.data() + swel_offset,
+                            xwel.data() + xwel_offset,
+                            icon.data() + icon_offset,
+                            scon.data() + scon_offset,
+                            xcon.data() + xcon_offset);
+
+        if (well.msw_index)
             throw std::logic_error("MSW data not accounted for in this constructor");
-    }
+
+        return well;
+    };
+
+    load_wells(this->header.num_wells, make_well, this->wells);
 }
 
 void RstState::add_msw(const std::vector<std::string>& zwel,
@@ -210,7 +242,8 @@ void RstState::add_msw(const std::vector<std::string>& zwel,
                        const std::vector<int>& iseg,
                        const std::vector<double>& rseg) {
 
-    for (int iw = 0; iw < this->header.num_wells; iw++) {
+    auto make_well = [this, &zwel, &iwel, &swel, &xwel, &icon, &scon, &xcon, &iseg, &rseg](const int iw)
+    {
         std::size_t zwel_offset = iw * this->header.nzwelz;
         std::size_t iwel_offset = iw * this->header.niwelz;
         std::size_t swel_offset = iw * this->header.nswelz;
@@ -219,21 +252,23 @@ void RstState::add_msw(const std::vector<std::string>& zwel,
         std::size_t scon_offset = iw * this->header.nsconz * this->header.ncwmax;
         std::size_t xcon_offset = iw * this->header.nxconz * this->header.ncwmax;
         int group_index = iwel[ iwel_offset + VI::IWell::Group ] - 1;
-        const std::string group = this->groups[group_index].name;
-
-        this->wells.emplace_back(this->unit_system,
-                                 this->header,
-                                 group,
-                                 zwel.data() + zwel_offset,
-                                 iwel.data() + iwel_offset,
-                                 swel.data() + swel_offset,
-                                 xwel.data() + xwel_offset,
-                                 icon.data() + icon_offset,
-                                 scon.data() + scon_offset,
-                                 xcon.data() + xcon_offset,
-                                 iseg,
-                                 rseg);
-    }
+        const std::string& group = this->groups[group_index].name;
+
+        return RstWell(this->unit_system,
+                       this->header,
+                       group,
+                       zwel.data() + zwel_offset,
+                       iwel.data() + iwel_offset,
+                       swel.data() + swel_offset,
+                       xwel.data() + xwel_offset,
+                       icon.data() + icon_offset,
+                       scon.data() + scon_offset,
+                       xcon.data() + xcon_offset,
+                       iseg,
+                       rseg);
+    };
+
+    load_wells(this->header.num_wells, make_well, this->wells);
 }
 
 void RstState::add_udqs(const std::vector<int>& iudq,
@@ -169,6 +169,7 @@ RstWell::RstWell(const ::Opm::UnitSystem& unit_system,
         this->tracer_concentration_injection.push_back( swel[VI::SWell::TracerOffset + tracer_index] );
 
 
+    this->connections.reserve(std::max(iwel[VI::IWell::NConn], 0));
     for (int ic = 0; ic < iwel[VI::IWell::NConn]; ic++) {
         std::size_t icon_offset = ic * header.niconz;
         std::size_t scon_offset = ic * header.nsconz;
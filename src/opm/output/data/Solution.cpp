@@ -32,6 +32,10 @@ bool Solution::has(const std::string& keyword) const {
     return this->count( keyword ) > 0;
 }
 
+bool Solution::isSI() const {
+    return this->si;
+}
+
 std::vector<double>& Solution::data(const std::string& keyword) {
     return this->at( keyword ).data;
 }
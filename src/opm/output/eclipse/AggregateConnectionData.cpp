@@ -21,6 +21,7 @@
 
 #include <opm/output/eclipse/VectorItems/connection.hpp>
 #include <opm/output/eclipse/VectorItems/intehead.hpp>
+#include <opm/output/eclipse/WriteRestartHelpers.hpp>
 
 #include <opm/output/data/Wells.hpp>
 
@@ -79,21 +80,29 @@ namespace {
         }
     }
 
+    // The connections of different wells are assembled concurrently in
+    // models with many wells.
     template <class ConnOp>
-    void wellConnectionLoop(const Opm::Schedule&    sched,
-                            const std::size_t       sim_step,
-                            const Opm::EclipseGrid& grid,
-                            const Opm::data::Wells& xw,
-                            ConnOp&&                connOp)
+    void wellConnectionLoop(const Opm::Schedule&     sched,
+                            const std::size_t        sim_step,
+                            const Opm::EclipseGrid&  grid,
+                            const Opm::data::Wells&  xw,
+                            const Opm::SummaryState& smry,
+                            ConnOp&&                 connOp)
     {
-        for (const auto& wname : sched.wellNames(sim_step)) {
-            const auto  well_iter = xw.find(wname);
+        const auto wells = sched.getWellsView(sim_step);
+        const auto concurrent = Opm::RestartIO::Helpers::
+            useConcurrentAggregation(sched, sim_step, smry, wells.size());
+
+        Opm::RestartIO::Helpers::runConcurrently(wells.size(), 16, concurrent,
+            [&wells, &grid, &xw, &connOp](const std::size_t i)
+        {
+            const auto  well_iter = xw.find(wells.name(i));
             const auto* wellRes   = (well_iter == xw.end())
                 ? nullptr : &well_iter->second;
 
-            connectionLoop(grid, sched.getWell(wname, sim_step),
-                           wellRes, std::forward<ConnOp>(connOp));
-        }
+            connectionLoop(grid, wells[i], wellRes, connOp);
+        });
     }
 
     namespace IConn {
@@ -102,16 +111,15 @@ namespace {
             return inteHead[VI::intehead::NICONZ];
         }
 
-        Opm::RestartIO::Helpers::WindowedMatrix<int>
-        allocate(const std::vector<int>& inteHead)
+        void
+        reset(const std::vector<int>& inteHead,
+              Opm::RestartIO::Helpers::WindowedMatrix<int>& array)
         {
             using WM = Opm::RestartIO::Helpers::WindowedMatrix<int>;
 
-            return WM {
-                WM::NumRows   { numWells(inteHead) },
-                WM::NumCols   { maxNumConn(inteHead) },
-                WM::WindowSize{ entriesPerConn(inteHead) }
-            };
+            array.reset(WM::NumRows{ numWells(inteHead) },
+                        WM::NumCols{ maxNumConn(inteHead) },
+                        WM::WindowSize{ entriesPerConn(inteHead) });
         }
 
         template <class IConnArray>
@@ -154,16 +162,15 @@ namespace {
             return inteHead[VI::intehead::NSCONZ];
         }
 
-        Opm::RestartIO::Helpers::WindowedMatrix<float>
-        allocate(const std::vector<int>& inteHead)
+        void
+        reset(const std::vector<int>& inteHead,
+              Opm::RestartIO::Helpers::WindowedMatrix<float>& array)
         {
             using WM = Opm::RestartIO::Helpers::WindowedMatrix<float>;
 
-            return WM {
-                WM::NumRows   { numWells(inteHead) },
-                WM::NumCols   { maxNumConn(inteHead) },
-                WM::WindowSize{ entriesPerConn(inteHead) }
-            };
+            array.reset(WM::NumRows{ numWells(inteHead) },
+                        WM::NumCols{ maxNumConn(inteHead) },
+                        WM::WindowSize{ entriesPerConn(inteHead) });
         }
 
         template <class SConnArray>
@@ -228,16 +235,15 @@ namespace {
             return inteHead[VI::intehead::NXCONZ];
         }
 
-        Opm::RestartIO::Helpers::WindowedMatrix<double>
-        allocate(const std::vector<int>& inteHead)
+        void
+        reset(const std::vector<int>& inteHead,
+              Opm::RestartIO::Helpers::WindowedMatrix<double>& array)
         {
             using WM = Opm::RestartIO::Helpers::WindowedMatrix<double>;
 
-            return WM {
-                WM::NumRows   { numWells(inteHead) },
-                WM::NumCols   { maxNumConn(inteHead) },
-                WM::WindowSize{ entriesPerConn(inteHead) }
-            };
+            array.reset(WM::NumRows{ numWells(inteHead) },
+                        WM::NumCols{ maxNumConn(inteHead) },
+                        WM::WindowSize{ entriesPerConn(inteHead) });
         }
 
         template <class XConnArray>
@@ -304,10 +310,20 @@ namespace {
 
 Opm::RestartIO::Helpers::AggregateConnectionData::
 AggregateConnectionData(const std::vector<int>& inteHead)
-    : iConn_(IConn::allocate(inteHead))
-    , sConn_(SConn::allocate(inteHead))
-    , xConn_(XConn::allocate(inteHead))
-{}
+{
+    this->reset(inteHead);
+}
+
+// ---------------------------------------------------------------------
+
+void
+Opm::RestartIO::Helpers::AggregateConnectionData::
+reset(const std::vector<int>& inteHead)
+{
+    IConn::reset(inteHead, this->iConn_);
+    SConn::reset(inteHead, this->sConn_);
+    XConn::reset(inteHead, this->xConn_);
+}
 
 // ---------------------------------------------------------------------
 
@@ -320,7 +336,7 @@ captureDeclaredConnData(const Schedule&        sched,
                         const SummaryState&    summary_state,
                         const std::size_t      sim_step)
 {
-    wellConnectionLoop(sched, sim_step, grid, xw, [&units, &summary_state, this]
+    wellConnectionLoop(sched, sim_step, grid, xw, summary_state, [&units, &summary_state, this]
         (const std::string&      wellName,
          const std::size_t       wellID,
          const bool              is_producer,
@@ -319,15 +319,14 @@ std::size_t entriesPerGroup(const std::vector<int>& inteHead)
     return inteHead[Opm::RestartIO::Helpers::VectorItems::NIGRPZ];
 }
 
-Opm::RestartIO::Helpers::WindowedArray<int>
-allocate(const std::vector<int>& inteHead)
+void
+reset(const std::vector<int>& inteHead,
+      Opm::RestartIO::Helpers::WindowedArray<int>& array)
 {
     using WV = Opm::RestartIO::Helpers::WindowedArray<int>;
 
-    return WV {
-        WV::NumWindows{ ngmaxz(inteHead) },
-        WV::WindowSize{ entriesPerGroup(inteHead) }
-    };
+    array.reset(WV::NumWindows{ ngmaxz(inteHead) },
+                WV::WindowSize{ entriesPerGroup(inteHead) });
 }
 
 
@@ -767,15 +766,14 @@ std::size_t entriesPerGroup(const std::vector<int>& inteHead)
     return inteHead[Opm::RestartIO::Helpers::VectorItems::NSGRPZ];
 }
 
-Opm::RestartIO::Helpers::WindowedArray<float>
-allocate(const std::vector<int>& inteHead)
+void
+reset(const std::vector<int>& inteHead,
+      Opm::RestartIO::Helpers::WindowedArray<float>& array)
 {
     using WV = Opm::RestartIO::Helpers::WindowedArray<float>;
 
-    return WV {
-        WV::NumWindows{ ngmaxz(inteHead) },
-        WV::WindowSize{ entriesPerGroup(inteHead) }
-    };
+    array.reset(WV::NumWindows{ ngmaxz(inteHead) },
+                WV::WindowSize{ entriesPerGroup(inteHead) });
 }
 
 template <typename SGProp, class SGrpArray>
@@ -1089,15 +1087,14 @@ std::size_t entriesPerGroup(const std::vector<int>& inteHead)
     return inteHead[Opm::RestartIO::Helpers::VectorItems::NXGRPZ];
 }
 
-Opm::RestartIO::Helpers::WindowedArray<double>
-allocate(const std::vector<int>& inteHead)
+void
+reset(const std::vector<int>& inteHead,
+      Opm::RestartIO::Helpers::WindowedArray<double>& array)
 {
     using WV = Opm::RestartIO::Helpers::WindowedArray<double>;
 
-    return WV {
-        WV::NumWindows{ ngmaxz(inteHead) },
-        WV::WindowSize{ entriesPerGroup(inteHead) }
-    };
+    array.reset(WV::NumWindows{ ngmaxz(inteHead) },
+                WV::WindowSize{ entriesPerGroup(inteHead) });
 }
 
 // here define the dynamic group quantities to be written to the restart file
@@ -1146,19 +1143,16 @@ std::size_t entriesPerGroup(const std::vector<int>& inteHead)
     return inteHead[Opm::RestartIO::Helpers::VectorItems::NZGRPZ];
 }
 
-Opm::RestartIO::Helpers::WindowedArray<
-Opm::EclIO::PaddedOutputString<8>
->
-allocate(const std::vector<int>& inteHead)
+void
+reset(const std::vector<int>& inteHead,
+      Opm::RestartIO::Helpers::WindowedArray<Opm::EclIO::PaddedOutputString<8>>& array)
 {
     using WV = Opm::RestartIO::Helpers::WindowedArray<
                Opm::EclIO::PaddedOutputString<8>
                >;
 
-    return WV {
-        WV::NumWindows{ ngmaxz(inteHead) },
-        WV::WindowSize{ entriesPerGroup(inteHead) }
-    };
+    array.reset(WV::NumWindows{ ngmaxz(inteHead) },
+                WV::WindowSize{ entriesPerGroup(inteHead) });
 }
 
 template <class ZGroupArray>
@@ -1175,13 +1169,24 @@ void staticContrib(const Opm::Group& group, ZGroupArray& zGroup)
 
 Opm::RestartIO::Helpers::AggregateGroupData::
 AggregateGroupData(const std::vector<int>& inteHead)
-    : iGroup_ (IGrp::allocate(inteHead))
-    , sGroup_ (SGrp::allocate(inteHead))
-    , xGroup_ (XGrp::allocate(inteHead))
-    , zGroup_ (ZGrp::allocate(inteHead))
-    , nWGMax_ (nwgmax(inteHead))
-    , nGMaxz_ (ngmaxz(inteHead))
-{}
+{
+    this->reset(inteHead);
+}
+
+// ---------------------------------------------------------------------
+
+void
+Opm::RestartIO::Helpers::AggregateGroupData::
+reset(const std::vector<int>& inteHead)
+{
+    IGrp::reset(inteHead, this->iGroup_);
+    SGrp::reset(inteHead, this->sGroup_);
+    XGrp::reset(inteHead, this->xGroup_);
+    ZGrp::reset(inteHead, this->zGroup_);
+
+    this->nWGMax_ = nwgmax(inteHead);
+    this->nGMaxz_ = ngmaxz(inteHead);
+}
 
 // ---------------------------------------------------------------------
 
@@ -413,15 +413,14 @@ namespace {
             return inteHead[176] * inteHead[178];
         }
 
-        Opm::RestartIO::Helpers::WindowedArray<int>
-        allocate(const std::vector<int>& inteHead)
+        void
+        reset(const std::vector<int>& inteHead,
+              Opm::RestartIO::Helpers::WindowedArray<int>& array)
         {
             using WV = Opm::RestartIO::Helpers::WindowedArray<int>;
 
-            return WV {
-                WV::NumWindows{ nswlmx(inteHead) },
-                WV::WindowSize{ entriesPerMSW(inteHead) }
-            };
+            array.reset(WV::NumWindows{ nswlmx(inteHead) },
+                        WV::WindowSize{ entriesPerMSW(inteHead) });
         }
 
         template <class ISegArray>
@@ -519,15 +518,14 @@ namespace {
             return inteHead[176] * inteHead[179];
         }
 
-        Opm::RestartIO::Helpers::WindowedArray<double>
-        allocate(const std::vector<int>& inteHead)
+        void
+        reset(const std::vector<int>& inteHead,
+              Opm::RestartIO::Helpers::WindowedArray<double>& array)
         {
             using WV = Opm::RestartIO::Helpers::WindowedArray<double>;
 
-            return WV {
-                WV::NumWindows{ nswlmx(inteHead) },
-                WV::WindowSize{ entriesPerMSW(inteHead) }
-            };
+            array.reset(WV::NumWindows{ nswlmx(inteHead) },
+                        WV::WindowSize{ entriesPerMSW(inteHead) });
         }
 
         float valveFlowUnitCoefficient(const Opm::UnitSystem::UnitType uType)
@@ -910,15 +908,14 @@ namespace {
             return inteHead[177];
         }
 
-        Opm::RestartIO::Helpers::WindowedArray<int>
-        allocate(const std::vector<int>& inteHead)
+        void
+        reset(const std::vector<int>& inteHead,
+              Opm::RestartIO::Helpers::WindowedArray<int>& array)
         {
             using WV = Opm::RestartIO::Helpers::WindowedArray<int>;
 
-            return WV {
-                WV::NumWindows{ nswlmx(inteHead) },
-                WV::WindowSize{ entriesPerMSW(inteHead) }
-            };
+            array.reset(WV::NumWindows{ nswlmx(inteHead) },
+                        WV::WindowSize{ entriesPerMSW(inteHead) });
         }
 
         template <class ILBSArray>
@@ -949,15 +946,14 @@ namespace {
             return inteHead[177] * inteHead[180];
         }
 
-        Opm::RestartIO::Helpers::WindowedArray<int>
-        allocate(const std::vector<int>& inteHead)
+        void
+        reset(const std::vector<int>& inteHead,
+              Opm::RestartIO::Helpers::WindowedArray<int>& array)
         {
             using WV = Opm::RestartIO::Helpers::WindowedArray<int>;
 
-            return WV {
-                WV::NumWindows{ nswlmx(inteHead) },
-                WV::WindowSize{ entriesPerMSW(inteHead) }
-            };
+            array.reset(WV::NumWindows{ nswlmx(inteHead) },
+                        WV::WindowSize{ entriesPerMSW(inteHead) });
         }
 
         template <class ILBRArray>
@@ -992,11 +988,21 @@ namespace {
 
 Opm::RestartIO::Helpers::AggregateMSWData::
 AggregateMSWData(const std::vector<int>& inteHead)
-    : iSeg_ (ISeg::allocate(inteHead))
-    , rSeg_ (RSeg::allocate(inteHead))
-    , iLBS_ (ILBS::allocate(inteHead))
-    , iLBR_ (ILBR::allocate(inteHead))
-{}
+{
+    this->reset(inteHead);
+}
+
+// ---------------------------------------------------------------------
+
+void
+Opm::RestartIO::Helpers::AggregateMSWData::
+reset(const std::vector<int>& inteHead)
+{
+    ISeg::reset(inteHead, this->iSeg_);
+    RSeg::reset(inteHead, this->rSeg_);
+    ILBS::reset(inteHead, this->iLBS_);
+    ILBR::reset(inteHead, this->iLBR_);
+}
 
 // ---------------------------------------------------------------------
 
@@ -1011,7 +1017,7 @@ captureDeclaredMSWData(const Schedule&         sched,
                        const Opm::data::Wells&  wr
                        )
 {
-    const auto& wells = sched.getWells(rptStep);
+    const auto wells = sched.getWellsView(rptStep);
     auto msw = std::vector<const Opm::Well*>{};
 
     //msw.reserve(wells.size());
@@ -406,15 +406,14 @@ namespace {
 
     namespace iUdq {
 
-        Opm::RestartIO::Helpers::WindowedArray<int>
-        allocate(const std::vector<int>& udqDims)
+        void
+        reset(const std::vector<int>& udqDims,
+              Opm::RestartIO::Helpers::WindowedArray<int>& array)
         {
             using WV = Opm::RestartIO::Helpers::WindowedArray<int>;
             int nwin = std::max(udqDims[0], 1);
-            return WV {
-                WV::NumWindows{ static_cast<std::size_t>(nwin) },
-                WV::WindowSize{ static_cast<std::size_t>(udqDims[1]) }
-            };
+            array.reset(WV::NumWindows{ static_cast<std::size_t>(nwin) },
+                        WV::WindowSize{ static_cast<std::size_t>(udqDims[1]) });
         }
 
         template <class IUDQArray>
@@ -441,15 +440,14 @@ namespace {
 
     namespace iUad {
 
-        Opm::RestartIO::Helpers::WindowedArray<int>
-        allocate(const std::vector<int>& udqDims)
+        void
+        reset(const std::vector<int>& udqDims,
+              Opm::RestartIO::Helpers::WindowedArray<int>& array)
         {
             using WV = Opm::RestartIO::Helpers::WindowedArray<int>;
             int nwin = std::max(udqDims[2], 1);
-            return WV {
-                WV::NumWindows{ static_cast<std::size_t>(nwin) },
-                WV::WindowSize{ static_cast<std::size_t>(udqDims[3]) }
-            };
+            array.reset(WV::NumWindows{ static_cast<std::size_t>(nwin) },
+                        WV::WindowSize{ static_cast<std::size_t>(udqDims[3]) });
         }
 
         template <class IUADArray>
@@ -469,18 +467,15 @@ namespace {
 
     namespace zUdn {
 
-        Opm::RestartIO::Helpers::WindowedArray<
-            Opm::EclIO::PaddedOutputString<8>
-        >
-        allocate(const std::vector<int>& udqDims)
+        void
+        reset(const std::vector<int>& udqDims,
+              Opm::RestartIO::Helpers::WindowedArray<Opm::EclIO::PaddedOutputString<8>>& array)
         {
             using WV = Opm::RestartIO::Helpers::WindowedArray<
                 Opm::EclIO::PaddedOutputString<8>>;
             int nwin = std::max(udqDims[0], 1);
-            return WV {
-                WV::NumWindows{ static_cast<std::size_t>(nwin) },
-                WV::WindowSize{ static_cast<std::size_t>(udqDims[4]) }
-            };
+            array.reset(WV::NumWindows{ static_cast<std::size_t>(nwin) },
+                        WV::WindowSize{ static_cast<std::size_t>(udqDims[4]) });
         }
 
     template <class zUdnArray>
@@ -494,18 +489,15 @@ namespace {
 
     namespace zUdl {
 
-        Opm::RestartIO::Helpers::WindowedArray<
-            Opm::EclIO::PaddedOutputString<8>
-        >
-        allocate(const std::vector<int>& udqDims)
+        void
+        reset(const std::vector<int>& udqDims,
+              Opm::RestartIO::Helpers::WindowedArray<Opm::EclIO::PaddedOutputString<8>>& array)
         {
             using WV = Opm::RestartIO::Helpers::WindowedArray<
                 Opm::EclIO::PaddedOutputString<8>>;
             int nwin = std::max(udqDims[0], 1);
-            return WV {
-                WV::NumWindows{ static_cast<std::size_t>(nwin) },
-                WV::WindowSize{ static_cast<std::size_t>(udqDims[5]) }
-            };
+            array.reset(WV::NumWindows{ static_cast<std::size_t>(nwin) },
+                        WV::WindowSize{ static_cast<std::size_t>(udqDims[5]) });
         }
 
     template <class zUdlArray>
@@ -547,14 +539,13 @@ namespace {
 
     namespace iGph {
 
-        Opm::RestartIO::Helpers::WindowedArray<int>
-        allocate(const std::vector<int>& udqDims)
+        void
+        reset(const std::vector<int>& udqDims,
+              Opm::RestartIO::Helpers::WindowedArray<int>& array)
         {
             using WV = Opm::RestartIO::Helpers::WindowedArray<int>;
-            return WV {
-                WV::NumWindows{ static_cast<std::size_t>(udqDims[6]) },
-                WV::WindowSize{ static_cast<std::size_t>(1) }
-            };
+            array.reset(WV::NumWindows{ static_cast<std::size_t>(udqDims[6]) },
+                        WV::WindowSize{ static_cast<std::size_t>(1) });
         }
 
         template <class IGPHArray>
@@ -567,15 +558,14 @@ namespace {
 
     namespace iUap {
 
-        Opm::RestartIO::Helpers::WindowedArray<int>
-        allocate(const std::vector<int>& udqDims)
+        void
+        reset(const std::vector<int>& udqDims,
+              Opm::RestartIO::Helpers::WindowedArray<int>& array)
         {
             using WV = Opm::RestartIO::Helpers::WindowedArray<int>;
             int nwin = std::max(udqDims[7], 1);
-            return WV {
-                WV::NumWindows{ static_cast<std::size_t>(nwin) },
-                WV::WindowSize{ static_cast<std::size_t>(1) }
-            };
+            array.reset(WV::NumWindows{ static_cast<std::size_t>(nwin) },
+                        WV::WindowSize{ static_cast<std::size_t>(1) });
         }
 
         template <class IUAPArray>
@@ -588,16 +578,15 @@ namespace {
 
     namespace dUdw {
 
-        Opm::RestartIO::Helpers::WindowedArray<double>
-        allocate(const std::vector<int>& udqDims)
+        void
+        reset(const std::vector<int>& udqDims,
+              Opm::RestartIO::Helpers::WindowedArray<double>& array)
         {
             using WV = Opm::RestartIO::Helpers::WindowedArray<double>;
             int nwin = std::max(udqDims[9], 1);
             int nitPrWin = std::max(udqDims[8], 1);
-            return WV {
-                WV::NumWindows{ static_cast<std::size_t>(nwin) },
-                WV::WindowSize{ static_cast<std::size_t>(nitPrWin) }
-            };
+            array.reset(WV::NumWindows{ static_cast<std::size_t>(nwin) },
+                        WV::WindowSize{ static_cast<std::size_t>(nitPrWin) });
         }
 
         template <class DUDWArray>
@@ -622,15 +611,14 @@ namespace {
 
         namespace dUdg {
 
-        Opm::RestartIO::Helpers::WindowedArray<double>
-        allocate(const std::vector<int>& udqDims)
+        void
+        reset(const std::vector<int>& udqDims,
+              Opm::RestartIO::Helpers::WindowedArray<double>& array)
         {
             using WV = Opm::RestartIO::Helpers::WindowedArray<double>;
             int nwin = std::max(udqDims[11], 1);
-            return WV {
-                WV::NumWindows{ static_cast<std::size_t>(nwin) },
-                WV::WindowSize{ static_cast<std::size_t>(udqDims[10]) }
-            };
+            array.reset(WV::NumWindows{ static_cast<std::size_t>(nwin) },
+                        WV::WindowSize{ static_cast<std::size_t>(udqDims[10]) });
         }
 
         template <class DUDGArray>
@@ -659,15 +647,14 @@ namespace {
 
         namespace dUdf {
 
-        Opm::RestartIO::Helpers::WindowedArray<double>
-        allocate(const std::vector<int>& udqDims)
+        void
+        reset(const std::vector<int>& udqDims,
+              Opm::RestartIO::Helpers::WindowedArray<double>& array)
         {
             using WV = Opm::RestartIO::Helpers::WindowedArray<double>;
             int nwin = std::max(udqDims[12], 1);
-            return WV {
-                WV::NumWindows{ static_cast<std::size_t>(nwin) },
-                WV::WindowSize{ static_cast<std::size_t>(1) }
-            };
+            array.reset(WV::NumWindows{ static_cast<std::size_t>(nwin) },
+                        WV::WindowSize{ static_cast<std::size_t>(1) });
         }
 
         template <class DUDFArray>
@@ -790,16 +777,26 @@ iuap_data(const Opm::Schedule& sched,
 
 Opm::RestartIO::Helpers::AggregateUDQData::
 AggregateUDQData(const std::vector<int>& udqDims)
-    : iUDQ_ (iUdq::allocate(udqDims)),
-      iUAD_ (iUad::allocate(udqDims)),
-      zUDN_ (zUdn::allocate(udqDims)),
-      zUDL_ (zUdl::allocate(udqDims)),
-      iGPH_ (iGph::allocate(udqDims)),
-      iUAP_ (iUap::allocate(udqDims)),
-      dUDW_ (dUdw::allocate(udqDims)),
-      dUDG_ (dUdg::allocate(udqDims)),
-      dUDF_ (dUdf::allocate(udqDims))
-{}
+{
+    this->reset(udqDims);
+}
+
+// ---------------------------------------------------------------------
+
+void
+Opm::RestartIO::Helpers::AggregateUDQData::
+reset(const std::vector<int>& udqDims)
+{
+    iUdq::reset(udqDims, this->iUDQ_);
+    iUad::reset(udqDims, this->iUAD_);
+    zUdn::reset(udqDims, this->zUDN_);
+    zUdl::reset(udqDims, this->zUDL_);
+    iGph::reset(udqDims, this->iGPH_);
+    iUap::reset(udqDims, this->iUAP_);
+    dUdw::reset(udqDims, this->dUDW_);
+    dUdg::reset(udqDims, this->dUDG_);
+    dUdf::reset(udqDims, this->dUDF_);
+}
 
 // ---------------------------------------------------------------------
 
@@ -22,6 +22,7 @@
 
 #include <opm/output/eclipse/VectorItems/intehead.hpp>
 #include <opm/output/eclipse/VectorItems/well.hpp>
+#include <opm/output/eclipse/WriteRestartHelpers.hpp>
 
 #include <opm/output/data/Wells.hpp>
 
@@ -90,16 +91,19 @@ namespace {
         return s.substr(b, e - b + 1);
     }
 
+    // The contributions of the individual wells are independent of each
+    // other, and are assembled concurrently in models with many wells.
     template <typename WellOp>
-    void wellLoop(const std::vector<std::string>& wells,
-                  const Opm::Schedule&            sched,
-                  const std::size_t               simStep,
-                  WellOp&&                        wellOp)
+    void wellLoop(const Opm::ScheduleState::WellsView& wells,
+                  const bool                           concurrent,
+                  WellOp&&                             wellOp)
     {
-        for (const auto& wname : wells) {
-            const auto& well = sched.getWell(wname, simStep);
+        Opm::RestartIO::Helpers::runConcurrently(wells.size(), 16, concurrent,
+            [&wells, &wellOp](const std::size_t i)
+        {
+            const auto& well = wells[i];
             wellOp(well, well.seqIndex());
-        }
+        });
     }
 
     namespace IWell {
@@ -108,15 +112,14 @@ namespace {
             return inteHead[VI::intehead::NIWELZ];
         }
 
-        Opm::RestartIO::Helpers::WindowedArray<int>
-        allocate(const std::vector<int>& inteHead)
+        void
+        reset(const std::vector<int>& inteHead,
+              Opm::RestartIO::Helpers::WindowedArray<int>& array)
         {
             using WV = Opm::RestartIO::Helpers::WindowedArray<int>;
 
-            return WV {
-                WV::NumWindows{ numWells(inteHead) },
-                WV::WindowSize{ entriesPerWell(inteHead) }
-            };
+            array.reset(WV::NumWindows{ numWells(inteHead) },
+                        WV::WindowSize{ entriesPerWell(inteHead) });
         }
 
         std::map <const std::string, size_t>  currentGroupMapNameIndex(const Opm::Schedule& sched, const size_t simStep, const std::vector<int>& inteHead)
@@ -615,15 +618,14 @@ namespace {
                 : std::nullopt;
         }
 
-        Opm::RestartIO::Helpers::WindowedArray<float>
-        allocate(const std::vector<int>& inteHead)
+        void
+        reset(const std::vector<int>& inteHead,
+              Opm::RestartIO::Helpers::WindowedArray<float>& array)
         {
             using WV = Opm::RestartIO::Helpers::WindowedArray<float>;
 
-            return WV {
-                WV::NumWindows{ numWells(inteHead) },
-                WV::WindowSize{ entriesPerWell(inteHead) }
-            };
+            array.reset(WV::NumWindows{ numWells(inteHead) },
+                        WV::WindowSize{ entriesPerWell(inteHead) });
         }
 
         std::vector<float> defaultSWell()
@@ -1090,15 +1092,14 @@ namespace {
             return inteHead[VI::intehead::NXWELZ];
         }
 
-        Opm::RestartIO::Helpers::WindowedArray<double>
-        allocate(const std::vector<int>& inteHead)
+        void
+        reset(const std::vector<int>& inteHead,
+              Opm::RestartIO::Helpers::WindowedArray<double>& array)
         {
             using WV = Opm::RestartIO::Helpers::WindowedArray<double>;
 
-            return WV {
-                WV::NumWindows{ numWells(inteHead) },
-                WV::WindowSize{ entriesPerWell(inteHead) }
-            };
+            array.reset(WV::NumWindows{ numWells(inteHead) },
+                        WV::WindowSize{ entriesPerWell(inteHead) });
         }
 
         template <class XWellArray>
@@ -1390,19 +1391,16 @@ namespace {
             return inteHead[VI::intehead::NZWELZ];
         }
 
-        Opm::RestartIO::Helpers::WindowedArray<
-            Opm::EclIO::PaddedOutputString<8>
-        >
-        allocate(const std::vector<int>& inteHead)
+        void
+        reset(const std::vector<int>& inteHead,
+              Opm::RestartIO::Helpers::WindowedArray<Opm::EclIO::PaddedOutputString<8>>& array)
         {
             using WV = Opm::RestartIO::Helpers::WindowedArray<
                 Opm::EclIO::PaddedOutputString<8>
             >;
 
-            return WV {
-                WV::NumWindows{ numWells(inteHead) },
-                WV::WindowSize{ entriesPerWell(inteHead) }
-            };
+            array.reset(WV::NumWindows{ numWells(inteHead) },
+                        WV::WindowSize{ entriesPerWell(inteHead) });
         }
 
         template <class ZWellArray>
@@ -1427,12 +1425,23 @@ namespace {
 
 Opm::RestartIO::Helpers::AggregateWellData::
 AggregateWellData(const std::vector<int>& inteHead)
-    : iWell_ (IWell::allocate(inteHead))
-    , sWell_ (SWell::allocate(inteHead))
-    , xWell_ (XWell::allocate(inteHead))
-    , zWell_ (ZWell::allocate(inteHead))
-    , nWGMax_(maxNumGroups(inteHead))
-{}
+{
+    this->reset(inteHead);
+}
+
+// ---------------------------------------------------------------------
+
+void
+Opm::RestartIO::Helpers::AggregateWellData::
+reset(const std::vector<int>& inteHead)
+{
+    IWell::reset(inteHead, this->iWell_);
+    SWell::reset(inteHead, this->sWell_);
+    XWell::reset(inteHead, this->xWell_);
+    ZWell::reset(inteHead, this->zWell_);
+
+    this->nWGMax_ = maxNumGroups(inteHead);
+}
 
 // ---------------------------------------------------------------------
 
@@ -1446,28 +1455,36 @@ captureDeclaredWellData(const Schedule&             sched,
                         const ::Opm::SummaryState&  smry,
                         const std::vector<int>&     inteHead)
 {
-    const auto& wells = sched.wellNames(sim_step);
+    const auto wells = sched.getWellsView(sim_step);
     const auto& step_glo = sched.glo(sim_step);
+    const auto concurrent = Opm::RestartIO::Helpers::
+        useConcurrentAggregation(sched, sim_step, smry, wells.size());
 
     // Static contributions to IWEL array.
     {
         //const auto grpNames = groupNames(sched.getGroups());
         const auto groupMapNameIndex = IWell::currentGroupMapNameIndex(sched, sim_step, inteHead);
+
+        // 1-based index of the multi-segment wells, by well ID.
+        auto msWellIDs = std::vector<std::size_t>(this->iWell_.numWindows(), 0);
         auto msWellID = std::size_t{0};
+        for (const auto& well : wells) {
+            msWellID += well.isMultiSegment();
+            msWellIDs[well.seqIndex()] = msWellID;
+        }
 
-        wellLoop(wells, sched, sim_step, [&groupMapNameIndex, &msWellID, &step_glo, &wtest_state, &smry, &sched, &sim_step, this]
+        wellLoop(wells, concurrent, [&groupMapNameIndex, &msWellIDs, &step_glo, &wtest_state, &smry, &sched, &sim_step, this]
             (const Well& well, const std::size_t wellID) -> void
         {
-            msWellID += well.isMultiSegment();  // 1-based index.
             auto iw   = this->iWell_[wellID];
             const auto& wtest_config = sched[sim_step].wtest_config();
 
-            IWell::staticContrib(well, step_glo, wtest_config, wtest_state, smry, msWellID, groupMapNameIndex, iw);
+            IWell::staticContrib(well, step_glo, wtest_config, wtest_state, smry, msWellIDs[wellID], groupMapNameIndex, iw);
         });
     }
 
     // Static contributions to SWEL array.
-    wellLoop(wells, sched, sim_step, [&step_glo, &sim_step, &sched, &tracers, &wtest_state, &smry, this]
+    wellLoop(wells, concurrent, [&step_glo, &sim_step, &sched, &tracers, &wtest_state, &smry, this]
         (const Well& well, const std::size_t wellID) -> void
     {
         auto sw = this->sWell_[wellID];
@@ -1476,7 +1493,7 @@ captureDeclaredWellData(const Schedule&             sched,
     });
 
     // Static contributions to XWEL array.
-    wellLoop(wells, sched, sim_step, [&sched, &smry, this]
+    wellLoop(wells, concurrent, [&sched, &smry, this]
         (const Well& well, const std::size_t wellID) -> void
     {
         auto xw = this->xWell_[wellID];
@@ -1486,7 +1503,7 @@ captureDeclaredWellData(const Schedule&             sched,
 
     {
         // Static contributions to ZWEL array.
-        wellLoop(wells, sched, sim_step, [&sim_step, &action_state, &sched, this]
+        wellLoop(wells, concurrent, [&sim_step, &action_state, &sched, this]
             (const Well& well, const std::size_t wellID) -> void
         {
             auto zw = this->zWell_[wellID];
@@ -1505,10 +1522,12 @@ captureDynamicWellData(const Opm::Schedule&        sched,
                        const Opm::data::Wells&     xw,
                        const ::Opm::SummaryState&  smry)
 {
-    const auto& wells = sched.wellNames(sim_step);
+    const auto wells = sched.getWellsView(sim_step);
+    const auto concurrent = Opm::RestartIO::Helpers::
+        useConcurrentAggregation(sched, sim_step, smry, wells.size());
 
     // Dynamic contributions to IWEL array.
-    wellLoop(wells, sched, sim_step, [this, &xw]
+    wellLoop(wells, concurrent, [this, &xw]
         (const Well& well, const std::size_t wellID) -> void
     {
         auto iWell = this->iWell_[wellID];
@@ -1526,7 +1545,7 @@ captureDynamicWellData(const Opm::Schedule&        sched,
     });
 
     // Dynamic contributions to XWEL array.
-    wellLoop(wells, sched, sim_step, [this, &sched, &tracers, &smry]
+    wellLoop(wells, concurrent, [this, &sched, &tracers, &smry]
         (const Well& well, const std::size_t wellID) -> void
     {
         auto xwell = this->xWell_[wellID];
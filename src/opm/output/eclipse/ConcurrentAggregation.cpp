@@ -0,0 +1,128 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/output/eclipse/WriteRestartHelpers.hpp>
+
+#include <opm/input/eclipse/Schedule/Schedule.hpp>
+#include <opm/input/eclipse/Schedule/SummaryState.hpp>
+
+#include <cstddef>
+#include <exception>
+#include <functional>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace {
+
+#ifdef _OPENMP
+    // Pointers rather than references, since reference arguments are
+    // copied into the tasks of an OpenMP taskloop.
+    void runTaskLoop(const long                              num_tasks,
+                     const long                              grain_size,
+                     const std::function<void(std::size_t)>* task,
+                     std::exception_ptr*                     error)
+    {
+#pragma omp taskloop grainsize(grain_size)
+        for (long i = 0; i < num_tasks; ++i) {
+            try {
+                (*task)(static_cast<std::size_t>(i));
+            }
+            catch (...) {
+#pragma omp critical(restart_aggregation_error)
+                if (! *error)
+                    *error = std::current_exception();
+            }
+        }
+    }
+#endif // _OPENMP
+
+} // Anonymous namespace
+
+// #####################################################################
+// Public Interface Below Separator
+// ---------------------------------------------------------------------
+
+bool
+Opm::RestartIO::Helpers::
+useConcurrentAggregation(const Schedule&     sched,
+                         const std::size_t   sim_step,
+                         const SummaryState& smry,
+                         const std::size_t   num_wells)
+{
+#ifdef _OPENMP
+    const std::size_t min_concurrent_wells = 64;
+    if ((num_wells < min_concurrent_wells) || (omp_get_max_threads() < 2)) {
+        return false;
+    }
+
+    sched.back();
+    sched[sim_step];
+    smry.wells();
+    smry.groups();
+
+    return true;
+#else
+    static_cast<void>(sched);
+    static_cast<void>(sim_step);
+    static_cast<void>(smry);
+    static_cast<void>(num_wells);
+    return false;
+#endif
+}
+
+void
+Opm::RestartIO::Helpers::
+runConcurrently(const std::size_t                       num_tasks,
+                const std::size_t                       grain_size,
+                const bool                              concurrent,
+                const std::function<void(std::size_t)>& task)
+{
+#ifdef _OPENMP
+    if (concurrent && (num_tasks > 1)) {
+        std::exception_ptr error{};
+
+        const auto n     = static_cast<long>(num_tasks);
+        const auto grain = static_cast<long>(grain_size > 0 ? grain_size : 1);
+
+        if (omp_in_parallel()) {
+            // Called from a task; share the threads of the current team.
+            runTaskLoop(n, grain, &task, &error);
+        }
+        else {
+#pragma omp parallel
+#pragma omp single
+            runTaskLoop(n, grain, &task, &error);
+        }
+
+        if (error)
+            std::rethrow_exception(error);
+
+        return;
+    }
+#else
+    static_cast<void>(grain_size);
+    static_cast<void>(concurrent);
+#endif // _OPENMP
+
+    for (auto i = 0*num_tasks; i < num_tasks; ++i) {
+        task(i);
+    }
+}
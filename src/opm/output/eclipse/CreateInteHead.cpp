@@ -77,7 +77,7 @@ namespace {
         }
 
         auto ncwmax = 0;
-        for (const auto& well : sched.getWells(lookup_step)) {
+        for (const auto& well : sched.getWellsView(lookup_step)) {
             const auto ncw = well.getConnections().size();
 
             ncwmax = std::max(ncwmax, static_cast<int>(ncw));
@@ -42,6 +42,7 @@
 
 #include <opm/output/eclipse/AggregateAquiferData.hpp>
 #include <opm/output/eclipse/RestartIO.hpp>
+#include <opm/output/eclipse/ResultsBus.hpp>
 #include <opm/output/eclipse/Summary.hpp>
 #include <opm/output/eclipse/WriteInit.hpp>
 #include <opm/output/eclipse/WriteRFT.hpp>
@@ -114,6 +115,11 @@ class EclipseIO::Impl {
 
         void recordSummaryOutput(const double secs_elapsed);
 
+        void publishResults(const SummaryState& st,
+                            const int           report_step,
+                            const double        secs_elapsed,
+                            RestartValue&&      value);
+
         const EclipseState& es;
         EclipseGrid grid;
         const Schedule& schedule;
@@ -123,6 +129,9 @@ class EclipseIO::Impl {
         out::Summary summary;
         bool output_enabled;
         std::optional<RestartIO::Helpers::AggregateAquiferData> aquiferData{std::nullopt};
+        RestartIO::OutputContext restartContext{};
+        RftIO::GatherPlans rftPlans{};
+        ResultsBus resultsBus{};
 
 private:
     mutable bool sumthin_active_{false};
@@ -165,9 +174,13 @@ void EclipseIO::Impl::writeINITFile(const data::Solution&                   simP
                                     std::map<std::string, std::vector<int>> int_data,
                                     const std::vector<NNCdata>&             nnc) const
 {
+    const auto& ioConfig = this->es.cfg().io();
+
     EclIO::OutputStream::Init initFile {
-        EclIO::OutputStream::ResultSet { this->outputDir, this->baseName },
-        EclIO::OutputStream::Formatted { this->es.cfg().io().getFMTOUT() }
+        EclIO::OutputStream::ResultSet  { this->outputDir, this->baseName },
+        EclIO::OutputStream::Formatted  { ioConfig.getFMTOUT() },
+        EclIO::OutputStream::Compressed { ioConfig.getCompressedOutput() &&
+                                          !ioConfig.getFMTOUT() }
     };
 
     InitIO::write(this->es, this->grid, this->schedule,
@@ -226,6 +239,30 @@ void EclipseIO::Impl::recordSummaryOutput(const double secs_elapsed)
         this->last_sumthin_output_ = secs_elapsed;
 }
 
+void EclipseIO::Impl::publishResults(const SummaryState& st,
+                                     const int           report_step,
+                                     const double        secs_elapsed,
+                                     RestartValue&&      value)
+{
+    auto snapshot = std::make_shared<ResultSnapshot>();
+
+    snapshot->reportStep = report_step;
+    snapshot->secondsElapsed = secs_elapsed;
+    snapshot->summaryState = st;
+    snapshot->wells = std::move(value.wells);
+    snapshot->groupAndNetwork = std::move(value.grp_nwrk);
+
+    // Move, rather than copy, requested solution arrays.
+    snapshot->solution = data::Solution{ value.solution.isSI() };
+    for (const auto& key : this->resultsBus.solutionKeys()) {
+        auto node = value.solution.extract(key);
+        if (! node.empty())
+            snapshot->solution.insert(std::move(node));
+    }
+
+    this->resultsBus.publish(std::move(snapshot));
+}
+
 bool EclipseIO::Impl::checkAndRecordIfSumthinTriggered(const int    report_step,
                                                        const double secs_elapsed) const
 {
@@ -315,13 +352,16 @@ void EclipseIO::writeTimeStep(const Action::State& action_state,
             EclIO::OutputStream::ResultSet { this->impl->outputDir,
                                              this->impl->baseName },
             report_step,
-            EclIO::OutputStream::Formatted { ioConfig.getFMTOUT() },
-            EclIO::OutputStream::Unified   { ioConfig.getUNIFOUT() }
+            EclIO::OutputStream::Formatted  { ioConfig.getFMTOUT() },
+            EclIO::OutputStream::Unified    { ioConfig.getUNIFOUT() },
+            EclIO::OutputStream::Compressed { ioConfig.getCompressedOutput() &&
+                                              !ioConfig.getFMTOUT() }
         };
 
         RestartIO::save(rstFile, report_step, secs_elapsed, value,
                         es, grid, schedule, action_state, wtest_state, st,
-                        udq_state, this->impl->aquiferData, write_double);
+                        udq_state, this->impl->aquiferData,
+                        this->impl->restartContext, write_double);
     }
 
     // RFT file written only if requested and never for substeps.
@@ -341,8 +381,8 @@ void EclipseIO::writeTimeStep(const Action::State& action_state,
             openExisting
         };
 
-        RftIO::write(report_step, secs_elapsed, es.getUnits(),
-                     grid, schedule, value.wells, rftFile);
+        RftIO::write(report_step, secs_elapsed, es.getUnits(), grid, schedule,
+                     value.wells, this->impl->rftPlans, rftFile);
     }
 
     if (!isSubstep) {
@@ -357,6 +397,11 @@ void EclipseIO::writeTimeStep(const Action::State& action_state,
                 OpmLog::note(log_string);
         }
     }
+
+    // Published last, as the snapshot takes over the contents of 'value'.
+    if (!isSubstep && this->impl->resultsBus.hasSubscribers()) {
+        this->impl->publishResults(st, report_step, secs_elapsed, std::move(value));
+    }
  }
 
 
@@ -394,6 +439,10 @@ const out::Summary& EclipseIO::summary() {
     return this->impl->summary;
 }
 
+ResultsBus& EclipseIO::resultsBus() {
+    return this->impl->resultsBus;
+}
+
 
 EclipseIO::~EclipseIO() {}
 
@@ -562,14 +562,24 @@ namespace {
     }
 
     std::vector<double>
-    double_vector(const std::string& key, const Opm::EclIO::RestartFileView& rst_view)
+    double_vector(const std::string&                 key,
+                  const Opm::EclIO::RestartFileView& rst_view,
+                  const std::vector<std::size_t>*    cells = nullptr)
     {
         if (rst_view.hasKeyword<double>(key)) {
             // Data exists as type DOUB.  Return unchanged.
-            return rst_view.getKeyword<double>(key);
+            return (cells != nullptr)
+                ? rst_view.getKeywordSubset<double>(key, *cells)
+                : rst_view.getKeyword<double>(key);
         }
         else if (rst_view.hasKeyword<float>(key)) {
             // Data exists as type REAL.  Convert to double.
+            if (cells != nullptr) {
+                const auto data = rst_view.getKeywordSubset<float>(key, *cells);
+
+                return { data.begin(), data.end() };
+            }
+
             const auto& data = rst_view.getKeyword<float>(key);
 
             return { data.begin(), data.end() };
@@ -579,6 +589,23 @@ namespace {
         return {};
     }
 
+    // Whether or not an empty result from double_vector() means that the
+    // vector is unavailable.  An available vector is also empty if it is
+    // loaded for an empty subset of the active cells.
+    bool isMissing(const std::vector<double>&           kwdata,
+                   const std::string&                   key,
+                   const std::vector<double>::size_type numcells,
+                   const Opm::EclIO::RestartFileView&   rst_view)
+    {
+        if (! kwdata.empty()) {
+            return false;
+        }
+
+        return (numcells > 0)
+            || (! rst_view.hasKeyword<double>(key) &&
+                ! rst_view.hasKeyword<float>(key));
+    }
+
     void insertSolutionVector(const std::vector<double>&           vector,
                               const Opm::RestartKey&               value,
                               const std::vector<double>::size_type numcells,
@@ -599,11 +626,12 @@ namespace {
     void loadIfAvailable(const Opm::RestartKey&               value,
                          const std::vector<double>::size_type numcells,
                          const Opm::EclIO::RestartFileView&   rst_view,
+                         const std::vector<std::size_t>*      cells,
                          Opm::data::Solution&                 sol)
     {
-        const auto& kwdata = double_vector(value.key, rst_view);
+        const auto& kwdata = double_vector(value.key, rst_view, cells);
 
-        if (kwdata.empty()) {
+        if (isMissing(kwdata, value.key, numcells, rst_view)) {
             throwIfMissingRequired(value);
 
             // If we get here, the requested value was not available in the
@@ -619,15 +647,16 @@ namespace {
                                    const Opm::RestartKey&               fallback_key,
                                    const std::vector<double>::size_type numcells,
                                    const Opm::EclIO::RestartFileView&   rst_view,
+                                   const std::vector<std::size_t>*      cells,
                                    Opm::data::Solution&                 sol)
     {
-        auto kwdata = double_vector(primary, rst_view);
+        auto kwdata = double_vector(primary, rst_view, cells);
 
-        if (kwdata.empty()) {
+        if (isMissing(kwdata, primary, numcells, rst_view)) {
             // Primary key does not exist in rst_view.  Attempt to load
             // fallback keys directly.
 
-            loadIfAvailable(fallback_key, numcells, rst_view, sol);
+            loadIfAvailable(fallback_key, numcells, rst_view, cells, sol);
         }
         else {
             // Primary exists in rst_view.  Translate to Flow's hysteresis
@@ -655,6 +684,7 @@ namespace {
     void restoreHysteresisVector(const Opm::RestartKey&             value,
                                  const int                          numcells,
                                  const Opm::EclIO::RestartFileView& rst_view,
+                                 const std::vector<std::size_t>*    cells,
                                  Opm::data::Solution&               sol)
     {
         const auto& key = value.key;
@@ -664,14 +694,14 @@ namespace {
             // Attempt to load from SOMAX, fall back to value.key if
             // unavailable--typically in OPM Extended restart file.
             loadHysteresisIfAvailable("SOMAX", value, numcells,
-                                      rst_view, sol);
+                                      rst_view, cells, sol);
         }
         else if ((key == "KRNSW_GO") || (key == "PCSWM_GO"))
         {
             // Attempt to load from SGMAX, fall back to value.key if
             // unavailable--typically in OPM Extended restart file.
             loadHysteresisIfAvailable("SGMAX", value, numcells,
-                                      rst_view, sol);
+                                      rst_view, cells, sol);
         }
     }
 
@@ -693,10 +723,13 @@ namespace {
         return { usys.to_si(M::time, TsInit) };
     }
 
+    // Restore the solution vectors of all active cells, or only of the
+    // active cells in 'cells' if non-null.
     Opm::data::Solution
     restoreSOLUTION(const std::vector<Opm::RestartKey>& solution_keys,
                     const int                           numcells,
-                    const Opm::EclIO::RestartFileView&  rst_view)
+                    const Opm::EclIO::RestartFileView&  rst_view,
+                    const std::vector<std::size_t>*     cells = nullptr)
     {
         Opm::data::Solution sol(/* init_si = */ false);
 
@@ -705,12 +738,12 @@ namespace {
                 // Special case handling of hysteresis data.  Possibly needs
                 // translation from ECLIPSE-compatible set to Flow's known
                 // set of hysteresis vectors.
-                restoreHysteresisVector(value, numcells, rst_view, sol);
+                restoreHysteresisVector(value, numcells, rst_view, cells, sol);
                 continue;
             }
 
             // Load regular (non-hysteresis) vector if available.
-            loadIfAvailable(value, numcells, rst_view, sol);
+            loadIfAvailable(value, numcells, rst_view, cells, sol);
         }
 
         return sol;
@@ -1643,27 +1676,53 @@ namespace {
             }
         }
     }
-} // Anonymous namespace
 
-namespace Opm { namespace RestartIO  {
+    std::vector<std::size_t>
+    activeCellSubset(const std::vector<std::size_t>& cells,
+                     const Opm::RestartIO::CellIndex index_type,
+                     const Opm::EclipseGrid&         grid)
+    {
+        if (index_type == Opm::RestartIO::CellIndex::Active) {
+            return cells;
+        }
 
-    RestartValue
-    load(const std::string&             filename,
-         int                            report_step,
-         Action::State&                 /*  action_state  */,
-         SummaryState&                  summary_state,
-         const std::vector<RestartKey>& solution_keys,
-         const EclipseState&            es,
-         const EclipseGrid&             grid,
-         const Schedule&                schedule,
-         const std::vector<RestartKey>& extra_keys)
+        auto active_cells = std::vector<std::size_t>{};
+        active_cells.reserve(cells.size());
+
+        for (const auto& global_index : cells) {
+            if (! grid.cellActive(global_index)) {
+                throw std::invalid_argument {
+                    fmt::format("Restart file: Cannot load solution "
+                                "for inactive cell {}", global_index)
+                };
+            }
+
+            active_cells.push_back(grid.activeIndex(global_index));
+        }
+
+        return active_cells;
+    }
+
+    Opm::RestartValue
+    loadRestart(const std::string&                    filename,
+                int                                   report_step,
+                Opm::SummaryState&                    summary_state,
+                const std::vector<Opm::RestartKey>&   solution_keys,
+                const Opm::EclipseState&              es,
+                const Opm::EclipseGrid&               grid,
+                const Opm::Schedule&                  schedule,
+                const std::vector<std::size_t>*       cells,
+                const std::vector<Opm::RestartKey>&   extra_keys)
     {
         auto rst_file = std::make_shared<Opm::EclIO::ERst>(filename);
         auto rst_view = std::make_shared<Opm::EclIO::RestartFileView>
             (std::move(rst_file), report_step);
 
-        auto xr = restoreSOLUTION(solution_keys,
-                                  grid.getNumActive(), *rst_view);
+        const int numcells = (cells != nullptr)
+            ? static_cast<int>(cells->size())
+            : grid.getNumActive();
+
+        auto xr = restoreSOLUTION(solution_keys, numcells, *rst_view, cells);
 
         xr.convertToSI(es.getUnits());
 
@@ -1674,9 +1733,9 @@ namespace Opm { namespace RestartIO  {
         auto xgrp_nwrk = restore_grp_nwrk(schedule, es.getUnits(), rst_view);
 
         auto aquifers = hasAquifers(*rst_view)
-            ? restore_aquifers(es, rst_view) : data::Aquifers{};
+            ? restore_aquifers(es, rst_view) : Opm::data::Aquifers{};
 
-        auto rst_value = RestartValue {
+        auto rst_value = Opm::RestartValue {
             std::move(xr), std::move(xw), std::move(xgrp_nwrk), std::move(aquifers)
         };
 
@@ -1689,5 +1748,44 @@ namespace Opm { namespace RestartIO  {
 
         return rst_value;
     }
+} // Anonymous namespace
+
+namespace Opm { namespace RestartIO  {
+
+    RestartValue
+    load(const std::string&             filename,
+         int                            report_step,
+         Action::State&                 /*  action_state  */,
+         SummaryState&                  summary_state,
+         const std::vector<RestartKey>& solution_keys,
+         const EclipseState&            es,
+         const EclipseGrid&             grid,
+         const Schedule&                schedule,
+         const std::vector<RestartKey>& extra_keys)
+    {
+        return loadRestart(filename, report_step, summary_state,
+                           solution_keys, es, grid, schedule,
+                           nullptr, extra_keys);
+    }
+
+    RestartValue
+    load(const std::string&              filename,
+         int                             report_step,
+         Action::State&                  /*  action_state  */,
+         SummaryState&                   summary_state,
+         const std::vector<RestartKey>&  solution_keys,
+         const EclipseState&             es,
+         const EclipseGrid&              grid,
+         const Schedule&                 schedule,
+         const std::vector<std::size_t>& cells,
+         const CellIndex                 index_type,
+         const std::vector<RestartKey>&  extra_keys)
+    {
+        const auto active_cells = activeCellSubset(cells, index_type, grid);
+
+        return loadRestart(filename, report_step, summary_state,
+                           solution_keys, es, grid, schedule,
+                           &active_cells, extra_keys);
+    }
 
 }} // Opm::RestartIO
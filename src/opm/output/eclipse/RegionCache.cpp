@@ -32,7 +32,7 @@ RegionCache::RegionCache(const std::set<std::string>& fip_regions, const FieldPr
     for (const auto& fip_name : fip_regions) {
         const auto& fip_region = fp.get_int(fip_name);
 
-        const auto& wells = schedule.getWellsatEnd();
+        const auto wells = schedule.getWellsViewatEnd();
         for (const auto& well : wells) {
             const auto& connections = well.getConnections( );
             if (connections.empty())
@@ -54,12 +54,15 @@
 #include <opm/common/OpmLog/OpmLog.hpp>
 
 #include <algorithm>
+#include <array>
 #include <cassert>
 #include <cstddef>
 #include <fstream>
+#include <functional>
 #include <initializer_list>
 #include <iomanip>
 #include <iterator>
+#include <optional>
 #include <sstream>
 #include <stdexcept>
 #include <string>
@@ -93,11 +96,16 @@ namespace {
         return extra_solution.count(vector) > 0;
     }
 
-    double nextStepSize(const Opm::RestartValue& rst_value)
+    double nextStepSize(const Opm::RestartValue& rst_value,
+                        const Opm::UnitSystem&   units)
     {
-        return rst_value.hasExtra("OPMEXTRA")
-            ? rst_value.getExtra("OPMEXTRA")[0]
-            : 0.0;
+        for (const auto& [key, data] : rst_value.extra) {
+            if (key.key == "OPMEXTRA") {
+                return units.from_si(key.dim, data[0]);
+            }
+        }
+
+        return 0.0;
     }
 
     std::vector<int>
@@ -253,41 +261,157 @@ namespace {
         return ih;
     }
 
-    void writeGroup(int                           sim_step,
-                    const UnitSystem&             units,
-                    const Schedule&               schedule,
-                    const Opm::SummaryState&      sumState,
-                    const std::vector<int>&       ih,
-                    EclIO::OutputStream::Restart& rstFile)
+    // The restart arrays which are assembled from the schedule, the summary
+    // state and the simulator results.  The aggregators do not depend on
+    // each other and run concurrently in models with many wells; the arrays
+    // are written afterwards, in the usual order, so the output does not
+    // depend on the number of threads.  The larger arrays live in the
+    // caller's OutputContext; null if not aggregated at this report step.
+    struct AggregatedArrays
+    {
+        const Helpers::AggregateGroupData*              groupData{nullptr};
+        std::optional<Helpers::AggregateNetworkData>    networkData{};
+        const Helpers::AggregateMSWData*                mswData{nullptr};
+        const Helpers::AggregateWellData*               wellData{nullptr};
+        std::optional<Helpers::AggregateWListData>      wListData{};
+        const Helpers::AggregateConnectionData*         connectionData{nullptr};
+        std::vector<int>                                udqDims{};
+        const Helpers::AggregateUDQData*                udqData{nullptr};
+        std::optional<Helpers::AggregateActionxData>    actionxData{};
+    };
+
+    // Aggregator of the context reinitialised for dimensions 'dims',
+    // reusing the storage of previous report steps.
+    template <typename Aggregator>
+    Aggregator& prepare(std::optional<Aggregator>& aggregator,
+                        const std::vector<int>&    dims)
     {
-        // write IGRP to restart file
-        const size_t simStep = static_cast<size_t> (sim_step);
+        if (aggregator.has_value()) {
+            aggregator->reset(dims);
+        }
+        else {
+            aggregator.emplace(dims);
+        }
+
+        return *aggregator;
+    }
+
+    AggregatedArrays
+    aggregateArrays(OutputContext&            context,
+                    const int                 report_step,
+                    const int                 sim_step,
+                    const EclipseState&       es,
+                    const EclipseGrid&        grid,
+                    const Schedule&           schedule,
+                    const data::Wells&        wellSol,
+                    const Action::State&      action_state,
+                    const WellTestState&      wtest_state,
+                    const SummaryState&       sumState,
+                    const UDQState&           udq_state,
+                    const std::vector<int>&   ih)
+    {
+        auto arrays = AggregatedArrays{};
+
+        if (report_step == 0) {
+            // Initial condition.  No dynamic data yet.
+            return arrays;
+        }
+
+        const auto  simStep = static_cast<std::size_t>(sim_step);
+        const auto& units   = schedule.getUnits();
+        const auto& wells   = schedule.wellNames(sim_step);
+
+        auto aggregators = std::vector<std::function<void()>>{};
+
+        if (! wells.empty()) {
+            aggregators.emplace_back([&]() {
+                auto& wellData = prepare(context.wellData, ih);
+                wellData.captureDeclaredWellData(schedule, es.tracer(), simStep,
+                                                 action_state, wtest_state, sumState, ih);
+                wellData.captureDynamicWellData(schedule, es.tracer(), simStep,
+                                                wellSol, sumState);
+                arrays.wellData = &wellData;
+            });
+
+            aggregators.emplace_back([&]() {
+                auto& connectionData = prepare(context.connectionData, ih);
+                connectionData.captureDeclaredConnData(schedule, grid, units,
+                                                       wellSol, sumState, simStep);
+                arrays.connectionData = &connectionData;
+            });
+
+            aggregators.emplace_back([&]() {
+                arrays.wListData.emplace(ih)
+                    .captureDeclaredWListData(schedule, simStep, ih);
+            });
+
+            const auto haveMSW =
+                std::any_of(std::begin(wells), std::end(wells),
+                    [&schedule, sim_step](const std::string& well)
+                {
+                    return schedule.getWell(well, sim_step).isMultiSegment();
+                });
+
+            if (haveMSW) {
+                aggregators.emplace_back([&]() {
+                    auto& mswData = prepare(context.mswData, ih);
+                    mswData.captureDeclaredMSWData(schedule, simStep, units,
+                                                   ih, grid, sumState, wellSol);
+                    arrays.mswData = &mswData;
+                });
+            }
+        }
 
-        auto  groupData = Helpers::AggregateGroupData(ih);
+        aggregators.emplace_back([&]() {
+            auto& groupData = prepare(context.groupData, ih);
+            groupData.captureDeclaredGroupData(schedule, units, simStep, sumState, ih);
+            arrays.groupData = &groupData;
+        });
 
-        groupData.captureDeclaredGroupData(schedule, units, simStep, sumState, ih);
+        // Network data only if the network option is used and network defined
+        if ((es.runspec().networkDimensions().maxNONodes() >= 1) &&
+            schedule[sim_step].network().active())
+        {
+            aggregators.emplace_back([&]() {
+                arrays.networkData.emplace(ih)
+                    .captureDeclaredNetworkData(es, schedule, units, simStep, sumState, ih);
+            });
+        }
 
+        aggregators.emplace_back([&]() {
+            arrays.udqDims = Helpers::createUdqDims(schedule, simStep, ih);
+            auto& udqData = prepare(context.udqData, arrays.udqDims);
+            udqData.captureDeclaredUDQData(schedule, simStep, udq_state, ih);
+            arrays.udqData = &udqData;
+        });
+
+        if (schedule[sim_step].actions().ecl_size() > 0) {
+            aggregators.emplace_back([&]() {
+                arrays.actionxData.emplace(schedule, action_state, sumState, simStep);
+            });
+        }
+
+        const auto concurrent = Helpers::
+            useConcurrentAggregation(schedule, simStep, sumState, wells.size());
+
+        Helpers::runConcurrently(aggregators.size(), 1, concurrent,
+            [&aggregators](const std::size_t i) { aggregators[i](); });
+
+        return arrays;
+    }
+
+    void writeGroup(const Helpers::AggregateGroupData& groupData,
+                    EclIO::OutputStream::Restart&      rstFile)
+    {
         rstFile.write("IGRP", groupData.getIGroup());
         rstFile.write("SGRP", groupData.getSGroup());
         rstFile.write("XGRP", groupData.getXGroup());
         rstFile.write("ZGRP", groupData.getZGroup());
     }
 
-    void writeNetwork(const Opm::EclipseState&      es,
-                      int                           sim_step,
-                      const UnitSystem&             units,
-                      const Schedule&               schedule,
-                      const Opm::SummaryState&      sumState,
-                      const std::vector<int>&       ih,
-                      EclIO::OutputStream::Restart& rstFile)
+    void writeNetwork(const Helpers::AggregateNetworkData& networkData,
+                      EclIO::OutputStream::Restart&        rstFile)
     {
-        // write network data to restart file
-        const size_t simStep = static_cast<size_t> (sim_step);
-
-        auto  networkData = Helpers::AggregateNetworkData(ih);
-
-        networkData.captureDeclaredNetworkData(es, schedule, units, simStep, sumState, ih);
-
         rstFile.write("INODE", networkData.getINode());
         rstFile.write("IBRAN", networkData.getIBran());
         rstFile.write("INOBR", networkData.getINobr());
@@ -296,47 +420,26 @@ namespace {
         rstFile.write("ZNODE", networkData.getZNode());
     }
 
-    void writeMSWData(int                           sim_step,
-                      const UnitSystem&             units,
-                      const Schedule&               schedule,
-                      const EclipseGrid&            grid,
-                      const Opm::SummaryState&      sumState,
-                      const Opm::data::Wells&       wells,
-                      const std::vector<int>&       ih,
-                      EclIO::OutputStream::Restart& rstFile)
+    void writeMSWData(const Helpers::AggregateMSWData& MSWData,
+                      EclIO::OutputStream::Restart&    rstFile)
     {
-        // write ISEG, RSEG, ILBS and ILBR to restart file
-        const auto simStep = static_cast<std::size_t> (sim_step);
-
-        auto  MSWData = Helpers::AggregateMSWData(ih);
-        MSWData.captureDeclaredMSWData(schedule, simStep, units,
-                                       ih, grid, sumState, wells);
-
         rstFile.write("ISEG", MSWData.getISeg());
         rstFile.write("ILBS", MSWData.getILBs());
         rstFile.write("ILBR", MSWData.getILBr());
         rstFile.write("RSEG", MSWData.getRSeg());
     }
 
-    void writeUDQ(const int                     report_step,
-                  const int                     sim_step,
-                  const Schedule&               schedule,
-                  const UDQState&               udq_state,
-                  const std::vector<int>&       ih,
+    void writeUDQ(const AggregatedArrays&       arrays,
                   EclIO::OutputStream::Restart& rstFile)
     {
-        if (report_step == 0) {
+        if (arrays.udqData == nullptr) {
             // Initial condition.  No UDQs yet.
             return;
         }
 
-        // write UDQ - data to restart file
-        const std::size_t simStep = static_cast<size_t> (sim_step);
+        const auto& udqDims = arrays.udqDims;
+        const auto& udqData = *arrays.udqData;
 
-        const auto udqDims = Helpers::createUdqDims(schedule, simStep, ih);
-        auto  udqData = Helpers::AggregateUDQData(udqDims);
-        udqData.captureDeclaredUDQData(schedule, simStep, udq_state, ih);
-        
         if (udqDims[0] >= 1) {
             rstFile.write("ZUDN", udqData.getZUDN());
             rstFile.write("ZUDL", udqData.getZUDL());
@@ -350,21 +453,13 @@ namespace {
         }
     }
 
-    void writeActionx(const int                     report_step,
-                      const int                     sim_step,
-                      const Schedule&               schedule,
-                      const Action::State&          action_state,
-                      const SummaryState&           sum_state,
+    void writeActionx(const AggregatedArrays&       arrays,
                       EclIO::OutputStream::Restart& rstFile)
     {
-        if (report_step == 0)
-            return;
-
-        if (schedule[sim_step].actions().ecl_size() == 0)
+        if (! arrays.actionxData.has_value())
             return;
 
-        const std::size_t simStep = static_cast<size_t> (sim_step);
-        Opm::RestartIO::Helpers::AggregateActionxData actionxData{schedule, action_state, sum_state, simStep};
+        const auto& actionxData = arrays.actionxData.value();
 
         rstFile.write("IACT", actionxData.getIACT());
         rstFile.write("SACT", actionxData.getSACT());
@@ -381,26 +476,19 @@ namespace {
                    const Phases&                   phases,
                    const EclipseGrid&              grid,
                    const Schedule&                 schedule,
-                   const TracerConfig&             tracers,
                    const std::vector<std::string>& well_names,
                    const data::Wells&              wells,
-                   const Opm::Action::State&       action_state,
-                   const Opm::WellTestState&       wtest_state,
-                   const Opm::SummaryState&        sumState,
-                   const std::vector<int>&         ih,
+                   const AggregatedArrays&         arrays,
                    EclIO::OutputStream::Restart&   rstFile)
     {
-        auto wellData = Helpers::AggregateWellData(ih);
-        wellData.captureDeclaredWellData(schedule, tracers, sim_step, action_state, wtest_state, sumState, ih);
-        wellData.captureDynamicWellData(schedule, tracers, sim_step, wells, sumState);
+        const auto& wellData = *arrays.wellData;
 
         rstFile.write("IWEL", wellData.getIWell());
         rstFile.write("SWEL", wellData.getSWell());
         rstFile.write("XWEL", wellData.getXWell());
         rstFile.write("ZWEL", wellData.getZWell());
 
-        auto wListData = Helpers::AggregateWListData(ih);
-        wListData.captureDeclaredWListData(schedule, sim_step, ih);
+        const auto& wListData = arrays.wListData.value();
 
         rstFile.write("ZWLS", wListData.getZWls());
         rstFile.write("IWLS", wListData.getIWls());
@@ -418,9 +506,7 @@ namespace {
             rstFile.write("OPM_XWEL", opm_xwel);
         }
 
-        auto connectionData = Helpers::AggregateConnectionData(ih);
-        connectionData.captureDeclaredConnData(schedule, grid, schedule.getUnits(),
-                                               wells, sumState, sim_step);
+        const auto& connectionData = *arrays.connectionData;
 
         rstFile.write("ICON", connectionData.getIConn());
         rstFile.write("SCON", connectionData.getSConn());
@@ -482,41 +568,29 @@ namespace {
                           const EclipseState&                           es,
                           const Schedule&                               schedule,
                           const data::Wells&                            wellSol,
-                          const Opm::Action::State&                     action_state,
-                          const Opm::WellTestState&                     wtest_state,
                           const Opm::SummaryState&                      sumState,
-                          const std::vector<int>&                       inteHD,
+                          const AggregatedArrays&                       arrays,
                           const data::Aquifers&                         aquDynData,
                           std::optional<Helpers::AggregateAquiferData>& aquiferData,
                           EclIO::OutputStream::Restart&                 rstFile)
     {
-        writeGroup(sim_step, schedule.getUnits(), schedule, sumState, inteHD, rstFile);
+        writeGroup(*arrays.groupData, rstFile);
 
         // Write network data if the network option is used and network defined
-        if ((es.runspec().networkDimensions().maxNONodes() >= 1) &&
-            schedule[sim_step].network().active())
-        {
-            writeNetwork(es, sim_step, schedule.getUnits(), schedule, sumState, inteHD, rstFile);
+        if (arrays.networkData.has_value()) {
+            writeNetwork(arrays.networkData.value(), rstFile);
         }
 
         // Write well and MSW data only when applicable (i.e., when present)
         const auto& wells = schedule.wellNames(sim_step);
 
         if (! wells.empty()) {
-            const auto haveMSW =
-                std::any_of(std::begin(wells), std::end(wells),
-                    [&schedule, sim_step](const std::string& well)
-                {
-                    return schedule.getWell(well, sim_step).isMultiSegment();
-                });
-
-            if (haveMSW) {
-                writeMSWData(sim_step, schedule.getUnits(), schedule, grid,
-                             sumState, wellSol, inteHD, rstFile);
+            if (arrays.mswData != nullptr) {
+                writeMSWData(*arrays.mswData, rstFile);
             }
 
-            writeWell(sim_step, ecl_compatible_rst, phases, grid, schedule, es.tracer(),
-                      wells, wellSol, action_state, wtest_state, sumState, inteHD, rstFile);
+            writeWell(sim_step, ecl_compatible_rst, phases, grid, schedule,
+                      wells, wellSol, arrays, rstFile);
         }
 
         if ((es.aquifer().hasAnalyticalAquifer() || es.aquifer().hasNumericalAquifer()) &&
@@ -538,26 +612,51 @@ namespace {
         return false;
     }
 
-    std::vector<double>
-    convertedHysteresisSat(const RestartValue& value,
-                           const std::string&  primary,
-                           const std::string&  fallback)
+    // Conversion of a solution vector from SI to output units, applied
+    // element by element while writing.  Replaces the in-place conversion
+    // of the complete RestartValue.
+    class ToOutputUnits
     {
-        auto smax = std::vector<double>{};
-
-        if (value.solution.has(primary)) {
-            smax = value.solution.data(primary);
-        }
-        else if (value.solution.has(fallback)) {
-            smax = value.solution.data(fallback);
+    public:
+        ToOutputUnits(const UnitSystem&         units,
+                      const UnitSystem::measure dim,
+                      const bool                convert)
+            : units_  (units)
+            , dim_    (dim)
+            , convert_(convert && (dim != UnitSystem::measure::identity))
+        {}
+
+        double operator()(const double x) const
+        {
+            return this->convert_ ? this->units_.from_si(this->dim_, x) : x;
         }
 
-        if (! smax.empty()) {
-            std::transform(std::begin(smax), std::end(smax), std::begin(smax),
-                           [](const double s) { return 1.0 - s; });
+    private:
+        const UnitSystem&   units_;
+        UnitSystem::measure dim_;
+        bool                convert_;
+    };
+
+    ToOutputUnits outputUnits(const UnitSystem&     units,
+                              const RestartValue&   value,
+                              const data::CellData& vector)
+    {
+        return { units, vector.dim, value.solution.isSI() };
+    }
+
+    const data::CellData*
+    hysteresisSource(const RestartValue& value,
+                     const std::string&  primary,
+                     const std::string&  fallback)
+    {
+        for (const auto* key : { &primary, &fallback }) {
+            auto pos = value.solution.find(*key);
+            if (pos != value.solution.end()) {
+                return &pos->second;
+            }
         }
 
-        return smax;
+        return nullptr;
     }
 
     std::vector<std::string>
@@ -593,36 +692,46 @@ namespace {
     }
 
     template <class OutputVector>
-    void writeSolutionVectors(const RestartValue&             value,
+    void writeSolutionVectors(const UnitSystem&               units,
+                              const RestartValue&             value,
                               const std::vector<std::string>& vectors,
                               const bool                      write_double,
                               OutputVector&&                  writeVector)
     {
         for (const auto& vector : vectors) {
-            writeVector(vector, value.solution.data(vector), write_double);
+            const auto& cells   = value.solution.at(vector);
+            const auto  convert = outputUnits(units, value, cells);
+
+            writeVector(vector, cells.data.size(),
+                        [&cells, &convert](const std::size_t i)
+                        { return convert(cells.data[i]); },
+                        write_double);
         }
     }
 
     template <class OutputVector>
-    void writeRegularSolutionVectors(const RestartValue& value,
+    void writeRegularSolutionVectors(const UnitSystem&   units,
+                                     const RestartValue& value,
                                      const bool          write_double,
                                      OutputVector&&      writeVector)
     {
-        writeSolutionVectors(value, solutionVectorNames(value), write_double,
+        writeSolutionVectors(units, value, solutionVectorNames(value), write_double,
                              std::forward<OutputVector>(writeVector));
     }
 
     template <class OutputVector>
-    void writeExtendedSolutionVectors(const RestartValue& value,
+    void writeExtendedSolutionVectors(const UnitSystem&   units,
+                                      const RestartValue& value,
                                       const bool          write_double,
                                       OutputVector&&      writeVector)
     {
-        writeSolutionVectors(value, extendedSolutionVectorNames(value), write_double,
+        writeSolutionVectors(units, value, extendedSolutionVectorNames(value), write_double,
                              std::forward<OutputVector>(writeVector));
     }
 
     template <class OutputVector>
-    void writeExtraVectors(const RestartValue& value,
+    void writeExtraVectors(const UnitSystem&   units,
+                           const RestartValue& value,
                            OutputVector&&      writeVector)
     {
         for (const auto& elm : value.extra) {
@@ -630,38 +739,41 @@ namespace {
             if (extraInSolution(key)) {
                 // Observe that the extra data is unconditionally
                 // output as double precision.
-                writeVector(key, elm.second, true);
+                const auto  dim  = elm.first.dim;
+                const auto& data = elm.second;
+                writeVector(key, data.size(),
+                            [&units, &data, dim](const std::size_t i)
+                            { return units.from_si(dim, data[i]); },
+                            true);
             }
         }
     }
 
     template <class OutputVector>
-    void writeEclipseCompatHysteresis(const RestartValue& value,
+    void writeEclipseCompatHysteresis(const UnitSystem&   units,
+                                      const RestartValue& value,
                                       const bool          write_double,
                                       OutputVector&&      writeVector)
     {
         // Convert Flow-specific vectors {KRNSW,PCSWM}_OW to ECLIPSE's
-        // requisite SOMAX vector.  Only partially characterised.
-        // Sufficient for Norne.
-        {
-            const auto somax =
-                convertedHysteresisSat(value, "KRNSW_OW", "PCSWM_OW");
-
-            if (! somax.empty()) {
-                writeVector("SOMAX", somax, write_double);
-            }
-        }
-
-        // Convert Flow-specific vectors {KRNSW,PCSWM}_GO to ECLIPSE's
+        // requisite SOMAX vector, and {KRNSW,PCSWM}_GO to ECLIPSE's
         // requisite SGMAX vector.  Only partially characterised.
         // Sufficient for Norne.
+        for (const auto& [smax, primary, fallback] : {
+                std::array<std::string, 3> { "SOMAX", "KRNSW_OW", "PCSWM_OW" },
+                std::array<std::string, 3> { "SGMAX", "KRNSW_GO", "PCSWM_GO" },
+            })
         {
-            const auto sgmax =
-                convertedHysteresisSat(value, "KRNSW_GO", "PCSWM_GO");
-
-            if (! sgmax.empty()) {
-                writeVector("SGMAX", sgmax, write_double);
+            const auto* source = hysteresisSource(value, primary, fallback);
+            if ((source == nullptr) || source->data.empty()) {
+                continue;
             }
+
+            const auto convert = outputUnits(units, value, *source);
+            writeVector(smax, source->data.size(),
+                        [source, &convert](const std::size_t i)
+                        { return 1.0 - convert(source->data[i]); },
+                        write_double);
         }
     }
 
@@ -687,71 +799,80 @@ namespace {
             ztracer.push_back(fmt::format("{}/{}", tracer.unit_string, unit_system.name( UnitSystem::measure::volume )));
             rstFile.write("ZTRACER", ztracer);
 
-            const auto& data = vector.data;
+            const auto& data    = vector.data;
+            const auto  convert = outputUnits(unit_system, value, vector);
             if (write_double) {
-                rstFile.write(tracer_rst_name, data);
+                rstFile.writeGenerated<double>(tracer_rst_name, data.size(),
+                    [&data, &convert](const std::size_t i)
+                    { return convert(data[i]); });
             }
             else {
-                rstFile.write(tracer_rst_name, std::vector<float> {
-                        data.begin(), data.end()
-                    });
+                rstFile.writeGenerated<float>(tracer_rst_name, data.size(),
+                    [&data, &convert](const std::size_t i)
+                    { return static_cast<float>(convert(data[i])); });
             }
         }
     }
 
     void writeSolution(const RestartValue&           value,
                        const Schedule&               schedule,
-                       const UDQState&               udq_state,
                        const TracerConfig&           tracer_config,
-                       int                           report_step,
-                       int                           sim_step,
+                       const UnitSystem&             units,
+                       const AggregatedArrays&       arrays,
                        const bool                    ecl_compatible_rst,
                        const bool                    write_double_arg,
-                       const std::vector<int>&       inteHD,
                        EclIO::OutputStream::Restart& rstFile)
     {
+        // Converts, narrows and writes each vector in one pass, block by
+        // block, without copies of the caller's data.
         auto write = [&rstFile]
-            (const std::string&         key,
-             const std::vector<double>& data,
-             const bool                 write_double) -> void
+            (const std::string& key,
+             const std::size_t  size,
+             const auto&        element,
+             const bool         write_double) -> void
         {
             if (write_double) {
-                rstFile.write(key, data);
+                rstFile.writeGenerated<double>(key, size, element);
             }
             else {
-                rstFile.write(key, std::vector<float> {
-                    data.begin(), data.end()
-                });
+                rstFile.writeGenerated<float>(key, size,
+                    [&element](const std::size_t i)
+                    { return static_cast<float>(element(i)); });
             }
         };
 
         rstFile.message("STARTSOL");
 
-        writeRegularSolutionVectors(value, write_double_arg, write);
+        writeRegularSolutionVectors(units, value, write_double_arg, write);
         writeTracerVectors(schedule.getUnits(), tracer_config, value, write_double_arg, rstFile);
-        writeUDQ(report_step, sim_step, schedule, udq_state, inteHD, rstFile);
+        writeUDQ(arrays, rstFile);
 
-        writeExtraVectors(value, write);
+        writeExtraVectors(units, value, write);
 
         if (ecl_compatible_rst && haveHysteresis(value)) {
-            writeEclipseCompatHysteresis(value, write_double_arg, write);
+            writeEclipseCompatHysteresis(units, value, write_double_arg, write);
         }
 
         if (! ecl_compatible_rst) {
-            writeExtendedSolutionVectors(value, write_double_arg, write);
+            writeExtendedSolutionVectors(units, value, write_double_arg, write);
         }
 
         rstFile.message("ENDSOL");
     }
 
-    void writeExtraData(const RestartValue::ExtraVector& extra_data,
+    void writeExtraData(const UnitSystem&                units,
+                        const RestartValue::ExtraVector& extra_data,
                         EclIO::OutputStream::Restart&    rstFile)
     {
         for (const auto& extra_value : extra_data) {
             const std::string& key = extra_value.first.key;
 
             if (! extraInSolution(key)) {
-                rstFile.write(key, extra_value.second);
+                const auto  dim  = extra_value.first.dim;
+                const auto& data = extra_value.second;
+                rstFile.writeGenerated<double>(key, data.size(),
+                    [&units, &data, dim](const std::size_t i)
+                    { return units.from_si(dim, data[i]); });
             }
         }
     }
@@ -789,7 +910,28 @@ namespace {
 void save(EclIO::OutputStream::Restart&                 rstFile,
           int                                           report_step,
           double                                        seconds_elapsed,
-          RestartValue                                  value,
+          const RestartValue&                           value,
+          const EclipseState&                           es,
+          const EclipseGrid&                            grid,
+          const Schedule&                               schedule,
+          const Action::State&                          action_state,
+          const WellTestState&                          wtest_state,
+          const SummaryState&                           sumState,
+          const UDQState&                               udqState,
+          std::optional<Helpers::AggregateAquiferData>& aquiferData,
+          bool                                          write_double)
+{
+    auto context = OutputContext{};
+
+    save(rstFile, report_step, seconds_elapsed, value, es, grid, schedule,
+         action_state, wtest_state, sumState, udqState, aquiferData,
+         context, write_double);
+}
+
+void save(EclIO::OutputStream::Restart&                 rstFile,
+          int                                           report_step,
+          double                                        seconds_elapsed,
+          const RestartValue&                           value,
           const EclipseState&                           es,
           const EclipseGrid&                            grid,
           const Schedule&                               schedule,
@@ -798,6 +940,7 @@ void save(EclIO::OutputStream::Restart&                 rstFile,
           const SummaryState&                           sumState,
           const UDQState&                               udqState,
           std::optional<Helpers::AggregateAquiferData>& aquiferData,
+          OutputContext&                                context,
           bool                                          write_double)
 {
     ::Opm::RestartIO::checkSaveArguments(es, value, grid);
@@ -812,26 +955,29 @@ void save(EclIO::OutputStream::Restart&                 rstFile,
         write_double = false;
     }
 
-    // Convert solution fields and extra values from SI to user units.
-    value.convertFromSI(units);
-
+    // Solution fields and extra values are converted from SI to user
+    // units while they are written, leaving 'value' untouched.
     const auto inteHD =
-        writeHeader(report_step, sim_step, nextStepSize(value),
+        writeHeader(report_step, sim_step, nextStepSize(value, units),
                     seconds_elapsed, schedule, grid, es, rstFile);
 
+    const auto arrays =
+        aggregateArrays(context, report_step, sim_step, es, grid, schedule, value.wells,
+                        action_state, wtest_state, sumState, udqState, inteHD);
+
     if (report_step > 0) {
         writeDynamicData(sim_step, ecl_compatible_rst, es.runspec().phases(),
-                         grid, es, schedule, value.wells, action_state, wtest_state,
-                         sumState, inteHD, value.aquifer, aquiferData, rstFile);
+                         grid, es, schedule, value.wells, sumState, arrays,
+                         value.aquifer, aquiferData, rstFile);
     }
 
-    writeActionx(report_step, sim_step, schedule, action_state, sumState, rstFile);
+    writeActionx(arrays, rstFile);
 
-    writeSolution(value, schedule, udqState, es.tracer(), report_step, sim_step,
-                  ecl_compatible_rst, write_double, inteHD, rstFile);
+    writeSolution(value, schedule, es.tracer(), units, arrays,
+                  ecl_compatible_rst, write_double, rstFile);
 
     if (! ecl_compatible_rst) {
-        writeExtraData(value.extra, rstFile);
+        writeExtraData(units, value.extra, rstFile);
     }
 
     logRestartOutput(report_step, schedule.size() - 1, inteHD);
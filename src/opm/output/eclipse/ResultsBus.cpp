@@ -0,0 +1,97 @@
+/*
+  Copyright (c) 2026 Equinor ASA
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/output/eclipse/ResultsBus.hpp>
+
+#include <utility>
+#include <vector>
+
+namespace Opm {
+
+ResultsBus::SubscriptionId
+ResultsBus::subscribe(Callback callback, std::set<std::string> solutionKeys)
+{
+    std::lock_guard<std::mutex> lock{ this->mutex_ };
+
+    const auto id = this->nextId_++;
+    this->subscriptions_.emplace(id, Subscription {
+        std::make_shared<const Callback>(std::move(callback)),
+        std::move(solutionKeys)
+    });
+
+    return id;
+}
+
+void ResultsBus::unsubscribe(const SubscriptionId id)
+{
+    std::lock_guard<std::mutex> lock{ this->mutex_ };
+
+    this->subscriptions_.erase(id);
+}
+
+bool ResultsBus::hasSubscribers() const
+{
+    std::lock_guard<std::mutex> lock{ this->mutex_ };
+
+    return ! this->subscriptions_.empty();
+}
+
+std::set<std::string> ResultsBus::solutionKeys() const
+{
+    std::lock_guard<std::mutex> lock{ this->mutex_ };
+
+    auto keys = std::set<std::string>{};
+    for (const auto& subscription : this->subscriptions_) {
+        keys.insert(subscription.second.solutionKeys.begin(),
+                    subscription.second.solutionKeys.end());
+    }
+
+    return keys;
+}
+
+void ResultsBus::publish(Snapshot snapshot)
+{
+    // Callbacks run without the lock held, so that they may subscribe or
+    // unsubscribe.
+    auto callbacks = std::vector<std::shared_ptr<const Callback>>{};
+
+    {
+        std::lock_guard<std::mutex> lock{ this->mutex_ };
+
+        this->latest_ = snapshot;
+
+        callbacks.reserve(this->subscriptions_.size());
+        for (const auto& subscription : this->subscriptions_) {
+            callbacks.push_back(subscription.second.callback);
+        }
+    }
+
+    for (const auto& callback : callbacks) {
+        (*callback)(snapshot);
+    }
+}
+
+ResultsBus::Snapshot ResultsBus::latest() const
+{
+    std::lock_guard<std::mutex> lock{ this->mutex_ };
+
+    return this->latest_;
+}
+
+} // namespace Opm
@@ -76,6 +76,7 @@
 #include <limits>
 #include <memory>
 #include <numeric>
+#include <optional>
 #include <regex>
 #include <sstream>
 #include <stdexcept>
@@ -86,6 +87,10 @@
 
 #include <fmt/format.h>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 template <> struct fmt::formatter<Opm::EclIO::SummaryNode::Category>: fmt::formatter<string_view> {
     // parse is inherited from formatter<string_view>.
     template <typename FormatContext>
@@ -503,7 +508,7 @@ struct fn_args
     const Opm::out::RegionCache& regionCache;
     const Opm::EclipseGrid& grid;
     const Opm::Schedule& schedule;
-    const std::vector< std::pair< std::string, double > > eff_factors;
+    const std::vector< std::pair< std::string, double > >& eff_factors;
     const Opm::Inplace& initial_inplace;
     const Opm::Inplace& inplace;
     const Opm::UnitSystem& unit_system;
@@ -2411,9 +2416,10 @@ find_field_wells(const Opm::Schedule& schedule,
 {
     auto fieldwells = std::vector<const Opm::Well*>{};
 
-    const auto& wells = schedule[sim_step].wells;
-    for (const auto& well : wells.keys()) {
-        fieldwells.push_back(&wells.get(well));
+    const auto wells = schedule.getWellsView(sim_step);
+    fieldwells.reserve(wells.size());
+    for (const auto& well : wells) {
+        fieldwells.push_back(&well);
     }
 
     sort_wells_by_insert_index(fieldwells);
@@ -2587,6 +2593,129 @@ void EfficiencyFactor::setFactors(const Opm::EclIO::SummaryNode&       node,
 }
 
 namespace Evaluator {
+    class Base;
+
+    /*
+     * The set of wells and the efficiency factors needed by the
+     * FunctionRelation evaluators. The summary nodes are grouped on the
+     * properties which determine the well set and the efficiency factors,
+     * i.e. category, well/group name, region and rate/total, so that all
+     * the vectors for e.g. one group share one entry.
+     *
+     * The entries are recomputed whenever the schedule's well or group
+     * objects differ from those the entries were computed for; both well
+     * sets and efficiency factors are fully determined by these objects and
+     * the (static) region cache.  The plan holds on to the objects, so the
+     * cached well pointers remain valid, and the comparison is repeated on
+     * every call since wells may be replaced within a report step, e.g.,
+     * when they are shut or by an ACTIONX.
+     */
+    class EvaluationPlan
+    {
+    public:
+        struct WellSet
+        {
+            bool need_wells{false};
+            std::vector<const Opm::Well*> wells{};
+            EfficiencyFactor::FacColl factors{};
+        };
+
+        void add(const Base* evaluator, const Opm::EclIO::SummaryNode& node);
+
+        void prepare(const Opm::Schedule&         sched,
+                     const Opm::out::RegionCache& reg,
+                     const std::size_t            sim_step);
+
+        const WellSet* wellSet(const Base* evaluator) const;
+
+    private:
+        std::vector<Opm::EclIO::SummaryNode> nodes_{};
+        std::vector<WellSet> sets_{};
+        std::unordered_map<std::string, std::size_t> set_index_{};
+        std::unordered_map<const Base*, std::size_t> evaluator_index_{};
+        std::optional<std::size_t> sim_step_{};
+        Opm::ScheduleState::map_member<std::string, Opm::Well> wells_{};
+        Opm::ScheduleState::map_member<std::string, Opm::Group> groups_{};
+    };
+
+    template <typename Map>
+    bool sameObjects(const Map& map1, const Map& map2)
+    {
+        if (map1.size() != map2.size())
+            return false;
+
+        return std::all_of(map1.begin(), map1.end(),
+                           [&map2](const auto& elm)
+                           {
+                               return map2.get_ptr(elm.first) == elm.second;
+                           });
+    }
+
+    void EvaluationPlan::add(const Base* evaluator, const Opm::EclIO::SummaryNode& node)
+    {
+        using Cat = Opm::EclIO::SummaryNode::Category;
+
+        const auto is_region = node.category == Cat::Region;
+        const auto wells_needed = need_wells(node);
+        const auto key = fmt::format("{}:{}:{}:{}:{}:{}",
+                                     static_cast<int>(node.category), node.wgname,
+                                     is_region ? node.fip_region.value_or("") : std::string{},
+                                     is_region ? node.number : 0,
+                                     node.type == Opm::EclIO::SummaryNode::Type::Total,
+                                     wells_needed);
+
+        const auto [pos, inserted] = this->set_index_.emplace(key, this->nodes_.size());
+        if (inserted) {
+            this->nodes_.push_back(node);
+            this->sets_.emplace_back();
+            this->sets_.back().need_wells = wells_needed;
+        }
+
+        this->evaluator_index_.insert_or_assign(evaluator, pos->second);
+        this->sim_step_.reset();
+    }
+
+    void EvaluationPlan::prepare(const Opm::Schedule&         sched,
+                                 const Opm::out::RegionCache& reg,
+                                 const std::size_t            sim_step)
+    {
+        const auto& curr = sched[sim_step];
+        if (this->sim_step_.has_value() &&
+            sameObjects(this->wells_, curr.wells) &&
+            sameObjects(this->groups_, curr.groups))
+        {
+            this->sim_step_ = sim_step;
+            return;
+        }
+
+        for (std::size_t i = 0; i < this->nodes_.size(); ++i) {
+            auto& wset = this->sets_[i];
+            wset.wells.clear();
+            if (wset.need_wells)
+                wset.wells = find_wells(sched, this->nodes_[i], static_cast<int>(sim_step), reg);
+
+            EfficiencyFactor efac{};
+            efac.setFactors(this->nodes_[i], sched, wset.wells, static_cast<int>(sim_step));
+            wset.factors = std::move(efac.factors);
+        }
+
+        this->wells_ = curr.wells;
+        this->groups_ = curr.groups;
+        this->sim_step_ = sim_step;
+    }
+
+    const EvaluationPlan::WellSet* EvaluationPlan::wellSet(const Base* evaluator) const
+    {
+        if (! this->sim_step_.has_value())
+            return nullptr;
+
+        const auto pos = this->evaluator_index_.find(evaluator);
+        if (pos == this->evaluator_index_.end())
+            return nullptr;
+
+        return &this->sets_[pos->second];
+    }
+
     struct InputData
     {
         const Opm::EclipseState& es;
@@ -2594,6 +2723,7 @@ namespace Evaluator {
         const Opm::EclipseGrid& grid;
         const Opm::out::RegionCache& reg;
         const Opm::Inplace initial_inplace;
+        const EvaluationPlan* plan;
     };
 
     struct SimulatorResults
@@ -2608,6 +2738,138 @@ namespace Evaluator {
         const std::unordered_map<std::string, Opm::data::InterRegFlowMap>& ireg;
     };
 
+    /*
+     * SummaryState handles of the summary vectors.  A handle is registered
+     * the first time a vector is stored in a SummaryState, after which the
+     * well, group and field values are updated through the handle instead
+     * of assembling and looking up the summary key in every evaluation.
+     * The handles are registered again if the values are stored in a
+     * different SummaryState object.
+     */
+    class HandleTable
+    {
+    public:
+        void update(const Opm::EclIO::SummaryNode& node,
+                    const double                   value,
+                    Opm::SummaryState&             st)
+        {
+            if (st.handle_owner() != this->owner_) {
+                this->handles_.clear();
+                this->owner_ = st.handle_owner();
+            }
+
+            auto pos = this->handles_.find(&node);
+            if (pos == this->handles_.end())
+                pos = this->handles_.emplace(&node, makeHandle(node, st)).first;
+
+            if (pos->second.has_value())
+                st.update(*pos->second, value);
+            else
+                updateValue(node, value, st);
+        }
+
+    private:
+        using Handle = Opm::SummaryState::Handle;
+
+        std::size_t owner_{0};
+        std::unordered_map<const Opm::EclIO::SummaryNode*, std::optional<Handle>> handles_{};
+
+        static std::optional<Handle>
+        makeHandle(const Opm::EclIO::SummaryNode& node, Opm::SummaryState& st)
+        {
+            using Cat = Opm::EclIO::SummaryNode::Category;
+
+            switch (node.category) {
+            case Cat::Well:
+                return st.well_var_handle(node.wgname, node.keyword);
+
+            case Cat::Group:
+            case Cat::Node:
+                return st.group_var_handle(node.wgname, node.keyword);
+
+            case Cat::Connection:
+                // Connection values are not available through handles.
+                return std::nullopt;
+
+            default:
+                return st.handle(node.unique_key());
+            }
+        }
+    };
+
+    /*
+     * Destination of the values computed by an evaluator.  An Output which
+     * is constructed from a SummaryState writes straight into that object.
+     * An Output which is reset() to buffer mode records the values instead,
+     * and they are transferred to a SummaryState with commit().  This is
+     * used to evaluate the summary vectors concurrently, in which case the
+     * SummaryState returned by state() is only read from.
+     */
+    class Output
+    {
+    public:
+        Output() = default;
+
+        Output(Opm::SummaryState& st, HandleTable& handles)
+            : st_     (&st)
+            , target_ (&st)
+            , handles_(&handles)
+        {}
+
+        const Opm::SummaryState& state() const
+        {
+            return *this->st_;
+        }
+
+        void update(const Opm::EclIO::SummaryNode& node, const double value)
+        {
+            if (this->target_ != nullptr)
+                this->handles_->update(node, value, *this->target_);
+            else
+                this->values_.push_back({ &node, std::string{}, value });
+        }
+
+        void update(const std::string& key, const double value)
+        {
+            if (this->target_ != nullptr)
+                this->target_->update(key, value);
+            else
+                this->values_.push_back({ nullptr, key, value });
+        }
+
+        void reset(const Opm::SummaryState& st)
+        {
+            this->st_ = &st;
+            this->target_ = nullptr;
+            this->values_.clear();
+        }
+
+        void commit(Opm::SummaryState& st, HandleTable& handles)
+        {
+            for (const auto& value : this->values_) {
+                if (value.node != nullptr)
+                    handles.update(*value.node, value.value, st);
+                else
+                    st.update(value.key, value.value);
+            }
+
+            this->values_.clear();
+        }
+
+    private:
+        struct Value
+        {
+            const Opm::EclIO::SummaryNode* node;
+            std::string key;
+            double value;
+        };
+
+        const Opm::SummaryState* st_{nullptr};
+        Opm::SummaryState* target_{nullptr};
+        HandleTable* handles_{nullptr};
+        std::vector<Value> values_{};
+    };
+
     class Base
     {
     public:
@@ -2617,7 +2879,20 @@ namespace Evaluator {
                             const double            stepSize,
                             const InputData&        input,
                             const SimulatorResults& simRes,
-                            Opm::SummaryState&      st) const = 0;
+                            Output&                 out) const = 0;
+
+        // Summary node for evaluators which need an EvaluationPlan entry.
+        virtual const Opm::EclIO::SummaryNode* planNode() const
+        {
+            return nullptr;
+        }
+
+        // Whether the evaluator reads summary values which are computed in
+        // the same evaluation, and must run after those have been stored.
+        virtual bool readsEvaluatedValues() const
+        {
+            return false;
+        }
     };
 
     class FunctionRelation : public Base
@@ -2630,49 +2905,71 @@ namespace Evaluator {
             if (this->use_number()) {
                 this->number_ = this->node_.number;
             }
+
+            // ROEW is computed from the COPT values, see roew().
+            using fn_ptr = quantity (*)(const fn_args&);
+            const auto* target = this->fcn_.target<fn_ptr>();
+            this->reads_evaluated_ = (target != nullptr) && (*target == &roew);
         }
 
         void update(const std::size_t       sim_step,
                     const double            stepSize,
                     const InputData&        input,
                     const SimulatorResults& simRes,
-                    Opm::SummaryState&      st) const override
+                    Output&                 out) const override
         {
-            const auto get_wells = need_wells(this->node_);
-
-            const auto wells = get_wells
-                ? find_wells(input.sched, this->node_,
-                             static_cast<int>(sim_step), input.reg)
-                : std::vector<const Opm::Well*>{};
+            const auto* wset = (input.plan != nullptr)
+                ? input.plan->wellSet(this) : nullptr;
+
+            auto local = EvaluationPlan::WellSet{};
+            if (wset == nullptr) {
+                local.need_wells = need_wells(this->node_);
+                if (local.need_wells)
+                    local.wells = find_wells(input.sched, this->node_,
+                                             static_cast<int>(sim_step), input.reg);
+
+                EfficiencyFactor efac{};
+                efac.setFactors(this->node_, input.sched, local.wells, sim_step);
+                local.factors = std::move(efac.factors);
+                wset = &local;
+            }
 
-            if (get_wells && wells.empty())
+            if (wset->need_wells && wset->wells.empty())
                 // Parameter depends on well information, but no active
                 // wells apply at this sim_step.  Nothing to do.
                 return;
 
-            EfficiencyFactor efac{};
-            efac.setFactors(this->node_, input.sched, wells, sim_step);
-
             const fn_args args {
-                wells, this->group_name(), this->node_.keyword, stepSize, static_cast<int>(sim_step),
+                wset->wells, this->group_name(), this->node_.keyword, stepSize, static_cast<int>(sim_step),
                 std::max(0, this->number_),
                 this->node_.fip_region,
-                st, simRes.wellSol, simRes.grpNwrkSol,
+                out.state(), simRes.wellSol, simRes.grpNwrkSol,
                 input.reg, input.grid, input.sched,
-                std::move(efac.factors), input.initial_inplace, simRes.inplace,
+                wset->factors, input.initial_inplace, simRes.inplace,
                 input.sched.getUnits()
             };
 
             const auto& usys = input.es.getUnits();
             const auto  prm  = this->fcn_(args);
 
-            updateValue(this->node_, usys.from_si(prm.unit, prm.value), st);
+            out.update(this->node_, usys.from_si(prm.unit, prm.value));
+        }
+
+        const Opm::EclIO::SummaryNode* planNode() const override
+        {
+            return &this->node_;
+        }
+
+        bool readsEvaluatedValues() const override
+        {
+            return this->reads_evaluated_;
         }
 
     private:
         Opm::EclIO::SummaryNode node_;
         ofun                    fcn_;
         int                     number_{0};
+        bool                    reads_evaluated_{false};
 
         std::string group_name() const
         {
@@ -2712,7 +3009,7 @@ namespace Evaluator {
                     const double         /* stepSize */,
                     const InputData&        input,
                     const SimulatorResults& simRes,
-                    Opm::SummaryState&      st) const override
+                    Output&                 out) const override
         {
             auto xPos = simRes.block.find(this->lookupKey());
             if (xPos == simRes.block.end()) {
@@ -2720,7 +3017,7 @@ namespace Evaluator {
             }
 
             const auto& usys = input.es.getUnits();
-            updateValue(this->node_, usys.from_si(this->m_, xPos->second), st);
+            out.update(this->node_, usys.from_si(this->m_, xPos->second));
         }
 
     private:
@@ -2746,7 +3043,7 @@ namespace Evaluator {
                     const double         /* stepSize */,
                     const InputData&        input,
                     const SimulatorResults& simRes,
-                    Opm::SummaryState&      st) const override
+                    Output&                 out) const override
         {
             auto xPos = simRes.aquifers.find(this->node_.number);
             if (xPos == simRes.aquifers.end()) {
@@ -2754,7 +3051,7 @@ namespace Evaluator {
             }
 
             const auto& usys = input.es.getUnits();
-            updateValue(this->node_, usys.from_si(this->m_, xPos->second.get(this->node_.keyword)), st);
+            out.update(this->node_, usys.from_si(this->m_, xPos->second.get(this->node_.keyword)));
         }
     private:
         Opm::EclIO::SummaryNode  node_;
@@ -2774,7 +3071,7 @@ namespace Evaluator {
                     const double         /* stepSize */,
                     const InputData&        input,
                     const SimulatorResults& simRes,
-                    Opm::SummaryState&      st) const override
+                    Output&                 out) const override
         {
             if (this->node_.number < 0)
                 return;
@@ -2790,7 +3087,7 @@ namespace Evaluator {
             const auto  val  = xPos->second[ix];
             const auto& usys = input.es.getUnits();
 
-            updateValue(this->node_, usys.from_si(this->m_, val), st);
+            out.update(this->node_, usys.from_si(this->m_, val));
         }
 
     private:
@@ -2821,7 +3118,7 @@ namespace Evaluator {
                     const double            stepSize,
                     const InputData&        input,
                     const SimulatorResults& simRes,
-                    Opm::SummaryState&      st) const override
+                    Output&                 out) const override
         {
             if (this->component_ == Component::NumComponents) {
                 return;
@@ -2840,7 +3137,7 @@ namespace Evaluator {
             const auto& usys = input.es.getUnits();
             const auto  val  = this->getValue(flow->first, flow->second, stepSize);
 
-            updateValue(this->node_, usys.from_si(this->m_, val), st);
+            out.update(this->node_, usys.from_si(this->m_, val));
         }
 
     private:
@@ -3009,7 +3306,7 @@ namespace Evaluator {
                     const double         /* stepSize */,
                     const InputData&        input,
                     const SimulatorResults& simRes,
-                    Opm::SummaryState&      st) const override
+                    Output&                 out) const override
         {
             auto xPos = simRes.single.find(this->node_.keyword);
             if (xPos == simRes.single.end())
@@ -3018,7 +3315,7 @@ namespace Evaluator {
             const auto  val  = xPos->second;
             const auto& usys = input.es.getUnits();
 
-            updateValue(this->node_, usys.from_si(this->m_, val), st);
+            out.update(this->node_, usys.from_si(this->m_, val));
         }
 
     private:
@@ -3033,7 +3330,7 @@ namespace Evaluator {
                     const double            /* stepSize */,
                     const InputData&        /* input */,
                     const SimulatorResults& /* simRes */,
-                    Opm::SummaryState&      /* st */) const override
+                    Output&                 /* out */) const override
         {
             // No-op
         }
@@ -3050,15 +3347,15 @@ namespace Evaluator {
                     const double               stepSize,
                     const InputData&           input,
                     const SimulatorResults& /* simRes */,
-                    Opm::SummaryState&         st) const override
+                    Output&                    out) const override
         {
             const auto& usys = input.es.getUnits();
 
             const auto m   = ::Opm::UnitSystem::measure::time;
-            const auto val = st.get_elapsed() + stepSize;
+            const auto val = out.state().get_elapsed() + stepSize;
 
-            st.update(this->saveKey_, usys.from_si(m, val));
-            st.update("TIME", usys.from_si(m, val));
+            out.update(this->saveKey_, usys.from_si(m, val));
+            out.update("TIME", usys.from_si(m, val));
         }
 
     private:
@@ -3076,10 +3373,10 @@ namespace Evaluator {
                     const double               stepSize,
                     const InputData&           input,
                     const SimulatorResults& /* simRes */,
-                    Opm::SummaryState&         st) const override
+                    Output&                    out) const override
         {
-            auto sim_time = make_sim_time(input.sched, st, stepSize);
-            st.update(this->saveKey_, sim_time.day());
+            auto sim_time = make_sim_time(input.sched, out.state(), stepSize);
+            out.update(this->saveKey_, sim_time.day());
         }
 
     private:
@@ -3097,10 +3394,10 @@ namespace Evaluator {
                     const double               stepSize,
                     const InputData&           input,
                     const SimulatorResults& /* simRes */,
-                    Opm::SummaryState&         st) const override
+                    Output&                    out) const override
         {
-            auto sim_time = make_sim_time(input.sched, st, stepSize);
-            st.update(this->saveKey_, sim_time.month());
+            auto sim_time = make_sim_time(input.sched, out.state(), stepSize);
+            out.update(this->saveKey_, sim_time.month());
         }
 
     private:
@@ -3118,10 +3415,10 @@ namespace Evaluator {
                     const double               stepSize,
                     const InputData&           input,
                     const SimulatorResults& /* simRes */,
-                    Opm::SummaryState&         st) const override
+                    Output&                    out) const override
         {
-            auto sim_time = make_sim_time(input.sched, st, stepSize);
-            st.update(this->saveKey_, sim_time.year());
+            auto sim_time = make_sim_time(input.sched, out.state(), stepSize);
+            out.update(this->saveKey_, sim_time.year());
         }
 
     private:
@@ -3139,13 +3436,13 @@ namespace Evaluator {
                     const double               stepSize,
                     const InputData&        /* input */,
                     const SimulatorResults& /* simRes */,
-                    Opm::SummaryState&         st) const override
+                    Output&                    out) const override
         {
             using namespace ::Opm::unit;
 
-            const auto val = st.get_elapsed() + stepSize;
+            const auto val = out.state().get_elapsed() + stepSize;
 
-            st.update(this->saveKey_, convert::to(val, ecl_year));
+            out.update(this->saveKey_, convert::to(val, ecl_year));
         }
 
     private:
@@ -3718,6 +4015,20 @@ void validateElapsedTime(const double             secs_elapsed,
     };
 }
 
+// The summary vectors are evaluated concurrently when more than one thread
+// is available and there are enough vectors to amortize the overhead.
+bool useParallelEvaluation(const std::size_t num_evaluators)
+{
+#ifdef _OPENMP
+    const std::size_t min_parallel_evaluators = 512;
+    return (num_evaluators >= min_parallel_evaluators)
+        && (omp_get_max_threads() > 1);
+#else
+    static_cast<void>(num_evaluators);
+    return false;
+#endif
+}
+
 } // Anonymous namespace
 
 class Opm::out::Summary::SummaryImplementation
@@ -3777,6 +4088,13 @@ private:
 
     mutable int miniStepID_{0};
     mutable double prevEvalTime_{std::numeric_limits<double>::lowest()};
+    mutable Evaluator::EvaluationPlan plan_{};
+
+    // All evaluators in evaluation order, with one output buffer each for
+    // the parallel evaluation mode.
+    std::vector<const Evaluator::Base*> evaluators_{};
+    mutable std::vector<Evaluator::Output> outputs_{};
+    mutable Evaluator::HandleTable handles_{};
 
     int prevCreate_{-1};
     int prevReportStepID_{-1};
@@ -3805,6 +4123,13 @@ private:
                                             Evaluator::Factory&  evaluatorFactory);
 
     void configureUDQ(const EclipseState& es, const SummaryConfig& summary_config, const Schedule& sched);
+    void configureEvaluationPlan();
+
+    void evalParallel(const int                          sim_step,
+                      const double                       duration,
+                      const Evaluator::InputData&        input,
+                      const Evaluator::SimulatorResults& simRes,
+                      SummaryState&                      st) const;
 
     MiniStep& getNextMiniStep(const int report_step, bool isSubstep);
     const MiniStep& lastUnwritten() const;
@@ -3844,6 +4169,7 @@ SummaryImplementation(const EclipseState&  es,
     this->configureRequiredRestartParameters(sumcfg, es.aquifer(),
                                              sched, evaluatorFactory);
     this->configureUDQ(es, sumcfg, sched);
+    this->configureEvaluationPlan();
 
     for (const auto& config_node : sumcfg.keywords("WBP*"))
         this->wbp_wells.insert( config_node.namedEntity() );
@@ -3917,8 +4243,11 @@ eval(const int                          sim_step,
     single_values["TIMESTEP"] = duration;
     st.update("TIMESTEP", this->es_.get().getUnits().from_si(Opm::UnitSystem::measure::time, duration));
 
+    this->plan_.prepare(this->sched_, this->regCache_, sim_step);
+
     const Evaluator::InputData input {
-        this->es_, this->sched_, this->grid_, this->regCache_, initial_inplace
+        this->es_, this->sched_, this->grid_, this->regCache_, initial_inplace,
+        &this->plan_
     };
 
     const Evaluator::SimulatorResults simRes {
@@ -3926,13 +4255,14 @@ eval(const int                          sim_step,
         region_values, block_values, aquifer_values, interreg_flows
     };
 
-    for (auto& evalPtr : this->outputParameters_.getEvaluators()) {
-        evalPtr->update(sim_step, duration, input, simRes, st);
+    if (useParallelEvaluation(this->evaluators_.size())) {
+        this->evalParallel(sim_step, duration, input, simRes, st);
     }
-
-    for (auto& [_, evalPtr] : this->extra_parameters) {
-        (void)_;
-        evalPtr->update(sim_step, duration, input, simRes, st);
+    else {
+        auto out = Evaluator::Output { st, this->handles_ };
+        for (const auto* evaluator : this->evaluators_) {
+            evaluator->update(sim_step, duration, input, simRes, out);
+        }
     }
 
     st.update_elapsed(duration);
@@ -3943,6 +4273,58 @@ eval(const int                          sim_step,
     }
 }
 
+void
+Opm::out::Summary::SummaryImplementation::
+evalParallel(const int                          sim_step,
+             const double                       duration,
+             const Evaluator::InputData&        input,
+             const Evaluator::SimulatorResults& simRes,
+             SummaryState&                      st) const
+{
+    // The Schedule and the SummaryState build some of their data on first
+    // access; make sure that has happened before the threads start reading.
+    input.sched.back();
+    input.sched[sim_step];
+    st.wells();
+    st.groups();
+
+    const auto num_evaluators = static_cast<int>(this->evaluators_.size());
+    std::exception_ptr error{};
+
+#pragma omp parallel for schedule(dynamic, 64)
+    for (int i = 0; i < num_evaluators; ++i) {
+        const auto* evaluator = this->evaluators_[i];
+        auto& out = this->outputs_[i];
+
+        out.reset(st);
+        if (evaluator->readsEvaluatedValues())
+            continue;
+
+        try {
+            evaluator->update(sim_step, duration, input, simRes, out);
+        }
+        catch (...) {
+#pragma omp critical(summary_eval_error)
+            if (! error)
+                error = std::current_exception();
+        }
+    }
+
+    if (error)
+        std::rethrow_exception(error);
+
+    // Commit in evaluation order, then evaluate the vectors which depend on
+    // the values just stored.
+    for (auto& out : this->outputs_)
+        out.commit(st, this->handles_);
+
+    auto out = Evaluator::Output { st, this->handles_ };
+    for (const auto* evaluator : this->evaluators_) {
+        if (evaluator->readsEvaluatedValues())
+            evaluator->update(sim_step, duration, input, simRes, out);
+    }
+}
+
 void Opm::out::Summary::SummaryImplementation::write(const bool is_final_summary)
 {
     const auto zero = std::vector<MiniStep>::size_type{0};
@@ -4231,6 +4613,28 @@ void Opm::out::Summary::SummaryImplementation::configureUDQ(const EclipseState&
     }
 }
 
+void Opm::out::Summary::SummaryImplementation::configureEvaluationPlan()
+{
+    auto add = [this](const EvalPtr& evalPtr)
+    {
+        this->evaluators_.push_back(evalPtr.get());
+
+        const auto* node = evalPtr->planNode();
+        if (node != nullptr)
+            this->plan_.add(evalPtr.get(), *node);
+    };
+
+    for (const auto& evalPtr : this->outputParameters_.getEvaluators())
+        add(evalPtr);
+
+    for (const auto& [_, evalPtr] : this->extra_parameters) {
+        (void)_;
+        add(evalPtr);
+    }
+
+    this->outputs_.resize(this->evaluators_.size());
+}
+
 void
 Opm::out::Summary::SummaryImplementation::
 configureRequiredRestartParameters(const SummaryConfig& sumcfg,
@@ -40,6 +40,7 @@
 
 #include <opm/input/eclipse/Units/UnitSystem.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <initializer_list>
 #include <stdexcept>
@@ -224,11 +225,6 @@ namespace {
 
     // =================================================================
 
-    std::vector<float> singlePrecision(const std::vector<double>& x)
-    {
-        return { x.begin(), x.end() };
-    }
-
     ::Opm::RestartIO::LogiHEAD::PVTModel
     pvtFlags(const ::Opm::Runspec& rspec, const ::Opm::TableManager& tabMgr)
     {
@@ -308,12 +304,40 @@ namespace {
 
 
     void writePoreVolume(const ::Opm::EclipseState&        es,
+                         const ::Opm::EclipseGrid&         grid,
                          const ::Opm::UnitSystem&          units,
                          ::Opm::EclIO::OutputStream::Init& initFile)
     {
-        auto porv = es.globalFieldProps().porv(true);
-        units.from_si(::Opm::UnitSystem::measure::volume, porv);
-        initFile.write("PORV", singlePrecision(porv));
+        const auto volume = ::Opm::UnitSystem::measure::volume;
+        const auto& fp    = es.globalFieldProps();
+        const auto  porv  = fp.porv(false);
+
+        if (porv.size() != grid.getNumActive()) {
+            // Property container does not share the grid's active cells.
+            // Expand through the container's own ACTNUM.  The generator is
+            // invoked for increasing cell indices so the active cell is
+            // tracked by a running counter.
+            const auto& actnum = fp.actnumRaw();
+            auto activeCell = std::size_t{0};
+            initFile.writeGenerated<float>("PORV", actnum.size(),
+                [&actnum, &porv, &units, &activeCell, volume](const std::size_t globCell)
+            {
+                return (actnum[globCell] != 0)
+                    ? static_cast<float>(units.from_si(volume, porv[activeCell++]))
+                    : 0.0f;
+            });
+
+            return;
+        }
+
+        // Inactive cells have zero pore volume in the INIT file.
+        initFile.writeGenerated<float>("PORV", grid.getCartesianSize(),
+            [&grid, &porv, &units, volume](const std::size_t globCell)
+        {
+            return grid.cellActive(globCell)
+                ? static_cast<float>(units.from_si(volume, porv[grid.activeIndex(globCell)]))
+                : 0.0f;
+        });
     }
 
     void writeIntegerCellProperties(const ::Opm::EclipseState&        es,
@@ -366,71 +390,37 @@ namespace {
         initFile.write("DZ"   , dz);
     }
 
-    template <class WriteVector>
-    void writeCellDoublePropertiesWithDefaultFlag(const Properties& propList,
-                                                  const ::Opm::FieldPropsManager& fp,
-                                                  WriteVector&&  write)
+    void writeDoubleCellProperties(const Properties&                    propList,
+                                   const ::Opm::FieldPropsManager&      fp,
+                                   const ::Opm::UnitSystem&             units,
+                                   const bool                           needDflt,
+                                   ::Opm::EclIO::OutputStream::Init&    initFile)
     {
         for (const auto& prop : propList) {
             if (! fp.has_double(prop.name))
                 continue;
 
-            auto data = fp.get_double(prop.name);
-            auto defaulted = fp.defaulted<double>(prop.name);
-            write(prop, std::move(defaulted), std::move(data));
-        }
-    }
+            const auto& value = fp.get_double(prop.name);
 
-    template <class WriteVector>
-    void writeCellPropertiesValuesOnly(const Properties& propList,
-                                       const ::Opm::FieldPropsManager& fp,
-                                       WriteVector&&                   write)
-    {
-        for (const auto& prop : propList) {
-
-            if (!fp.has_double(prop.name))
-                continue;
-            auto data = fp.get_double(prop.name);
-            write(prop, std::move(data));
-        }
-    }
+            if (needDflt) {
+                const auto dflt = fp.defaulted<double>(prop.name);
 
-    void writeDoubleCellProperties(const Properties&                    propList,
-                                   const ::Opm::FieldPropsManager&      fp,
-                                   const ::Opm::UnitSystem&             units,
-                                   const bool                           needDflt,
-                                   ::Opm::EclIO::OutputStream::Init&    initFile)
-    {
-        if (needDflt) {
-            writeCellDoublePropertiesWithDefaultFlag(propList, fp,
-                [&units, &initFile](const CellProperty&   prop,
-                                    std::vector<bool>&&   dflt,
-                                    std::vector<double>&& value)
-            {
-                units.from_si(prop.unit, value);
-
-                for (auto n = dflt.size(), i = 0*n; i < n; ++i) {
-                    if (dflt[i]) {
-                        // Element defaulted.  Output sentinel value
-                        // (-1.0e+20) to signify defaulted element.
-                        //
-                        // Note: Start as float for roundtripping through
-                        // function singlePrecision().
-                        value[i] = static_cast<double>(-1.0e+20f);
-                    }
-                }
-
-                initFile.write(prop.name, singlePrecision(value));
-            });
-        }
-        else {
-            writeCellPropertiesValuesOnly(propList, fp,
-                [&units, &initFile](const CellProperty&   prop,
-                                    std::vector<double>&& value)
-            {
-                units.from_si(prop.unit, value);
-                initFile.write(prop.name, singlePrecision(value));
-            });
+                // Defaulted elements are output as the sentinel value
+                // -1.0e+20 to signify defaulted element.
+                initFile.writeGenerated<float>(prop.name, value.size(),
+                    [&units, &prop, &value, &dflt](const std::size_t i)
+                {
+                    return dflt[i] ? -1.0e+20f
+                        : static_cast<float>(units.from_si(prop.unit, value[i]));
+                });
+            }
+            else {
+                initFile.writeGenerated<float>(prop.name, value.size(),
+                    [&units, &prop, &value](const std::size_t i)
+                {
+                    return static_cast<float>(units.from_si(prop.unit, value[i]));
+                });
+            }
         }
     }
 
@@ -459,10 +449,24 @@ namespace {
                                   const ::Opm::data::Solution&      simProps,
                                   ::Opm::EclIO::OutputStream::Init& initFile)
     {
+        const auto nAct = grid.getNumActive();
+
         for (const auto& prop : simProps) {
-            const auto& value = grid.compressedVector(prop.second.data);
+            const auto& value = prop.second.data;
 
-            initFile.write(prop.first, singlePrecision(value));
+            if (value.size() == nAct) {
+                initFile.writeGenerated<float>(prop.first, nAct,
+                    [&value](const std::size_t i)
+                { return static_cast<float>(value[i]); });
+            }
+            else {
+                if (value.size() != grid.getCartesianSize())
+                    throw std::invalid_argument("Input vector must have full size");
+
+                initFile.writeGenerated<float>(prop.first, nAct,
+                    [&grid, &value](const std::size_t i)
+                { return static_cast<float>(value[grid.getGlobalIndex(i)]); });
+            }
         }
     }
 
@@ -546,16 +550,11 @@ namespace {
                                       const ::Opm::UnitSystem&           units,
                                       ::Opm::EclIO::OutputStream::Init&  initFile)
     {
-        auto tran = std::vector<double>{};
-        tran.reserve(nnc.size());
-
-        for (const auto& nd : nnc) {
-            tran.push_back(nd.trans);
-        }
-
-        units.from_si(::Opm::UnitSystem::measure::transmissibility, tran);
+        const auto tran = ::Opm::UnitSystem::measure::transmissibility;
 
-        initFile.write("TRANNNC", singlePrecision(tran));
+        initFile.writeGenerated<float>("TRANNNC", nnc.size(),
+            [&nnc, &units, tran](const std::size_t i)
+        { return static_cast<float>(units.from_si(tran, nnc[i].trans)); });
     }
 
     // output aquifer cell and aquifer connection information for numerical aquifers
@@ -633,7 +632,7 @@ void Opm::InitIO::write(const ::Opm::EclipseState&              es,
     // set to zero for inactive cells.  This treatment implies that the
     // active/inactive cell mapping can be inferred by reading the PORV
     // vector from the result set.
-    writePoreVolume(es, units, initFile);
+    writePoreVolume(es, grid, units, initFile);
     writeGridGeometry(grid, units, initFile);
     writeDoubleCellProperties(es, units, initFile);
     writeSimulatorProperties(grid, simProps, initFile);
@@ -30,6 +30,7 @@
 #include <opm/output/data/Wells.hpp>
 
 #include <opm/output/eclipse/InteHEAD.hpp>
+#include <opm/output/eclipse/WriteRestartHelpers.hpp>
 
 #include <opm/input/eclipse/EclipseState/Grid/EclipseGrid.hpp>
 #include <opm/input/eclipse/Schedule/Schedule.hpp>
@@ -47,6 +48,8 @@
 #include <optional>
 #include <stdexcept>
 #include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace {
@@ -162,15 +165,110 @@ namespace {
 
     // =======================================================================
 
+    /// Gather plan of a single well.  See Opm::RftIO::GatherPlans.
+    struct ConnectionPlan
+    {
+        /// Global cell index of each of the well's connections, whether
+        /// active or not.  Used to detect changes to the connections.
+        std::vector<std::size_t> connCells{};
+
+        /// Global cell index, one-based (I,J,K), and depth in SI units of
+        /// each connection in an active cell.
+        std::vector<std::size_t> cells{};
+        std::vector<int> i{};
+        std::vector<int> j{};
+        std::vector<int> k{};
+        std::vector<double> depth{};
+
+        /// Position of each active connection's dynamic results in
+        /// data::Well::connections at the previous report step.  Only a
+        /// hint, verified before use.
+        std::vector<std::size_t> resultPos{};
+
+        bool matches(const ::Opm::WellConnections& connections) const;
+
+        void build(const ::Opm::EclipseGrid&      grid,
+                   const ::Opm::WellConnections& connections);
+
+        /// Position of dynamic results of active connection 'c' in
+        /// 'xcon', or xcon.size() if not available.
+        std::size_t
+        findResults(const std::size_t                          c,
+                    const std::vector<::Opm::data::Connection>& xcon);
+    };
+
+    bool ConnectionPlan::matches(const ::Opm::WellConnections& connections) const
+    {
+        return std::equal(this->connCells.begin(), this->connCells.end(),
+                          connections.begin(), connections.end(),
+                          [](const std::size_t ix, const ::Opm::Connection& conn)
+                          {
+                              return ix == conn.global_index();
+                          });
+    }
+
+    void ConnectionPlan::build(const ::Opm::EclipseGrid&      grid,
+                               const ::Opm::WellConnections& connections)
+    {
+        *this = ConnectionPlan{};
+
+        this->connCells.reserve(connections.size());
+
+        for (const auto& connection : connections) {
+            const auto ix = connection.global_index();
+            this->connCells.push_back(ix);
+
+            if (! grid.cellActive(ix)) {
+                // Inactive cell.  Ignore.
+                continue;
+            }
+
+            this->cells.push_back(ix);
+            this->i.push_back(connection.getI() + 1);
+            this->j.push_back(connection.getJ() + 1);
+            this->k.push_back(connection.getK() + 1);
+            this->depth.push_back(grid.getCellDepth(ix));
+        }
+
+        this->resultPos.assign(this->cells.size(), 0);
+    }
+
+    std::size_t
+    ConnectionPlan::findResults(const std::size_t                          c,
+                                const std::vector<::Opm::data::Connection>& xcon)
+    {
+        const auto ix = this->cells[c];
+
+        auto& pos = this->resultPos[c];
+        if ((pos < xcon.size()) && (xcon[pos].index == ix)) {
+            return pos;
+        }
+
+        auto xconPos = std::find_if(xcon.begin(), xcon.end(),
+            [ix](const ::Opm::data::Connection& conn)
+        {
+            return conn.index == ix;
+        });
+
+        if (xconPos == xcon.end()) {
+            return xcon.size();
+        }
+
+        pos = std::distance(xcon.begin(), xconPos);
+
+        return pos;
+    }
+
+    // =======================================================================
+
     class RFTRecord
     {
     public:
         explicit RFTRecord(const std::size_t nconn = 0);
 
-        void collectRecordData(const ::Opm::UnitSystem&  usys,
-                               const ::Opm::EclipseGrid& grid,
-                               const ::Opm::Well&        well,
-                               const ::Opm::data::Well&  wellSol);
+        void collectRecordData(const ::Opm::UnitSystem& usys,
+                               ConnectionPlan&          plan,
+                               const ::Opm::data::Well& wellSol);
 
         std::size_t nConn() const { return this->i_.size(); }
 
@@ -189,9 +287,9 @@ namespace {
         std::vector<Opm::EclIO::PaddedOutputString<8>> host_;
 
         void addConnection(const ::Opm::UnitSystem&       usys,
-                           const ::Opm::Connection&       conn,
-                           const ::Opm::data::Connection& xcon,
-                           const double                   depth);
+                           const ConnectionPlan&          plan,
+                           const std::size_t              c,
+                           const ::Opm::data::Connection& xcon);
     };
 
     RFTRecord::RFTRecord(const std::size_t nconn)
@@ -210,33 +308,21 @@ namespace {
         this->host_.reserve(nconn);
     }
 
-    void RFTRecord::collectRecordData(const ::Opm::UnitSystem&  usys,
-                                      const ::Opm::EclipseGrid& grid,
-                                      const ::Opm::Well&        well,
-                                      const ::Opm::data::Well&  wellSol)
+    void RFTRecord::collectRecordData(const ::Opm::UnitSystem& usys,
+                                      ConnectionPlan&          plan,
+                                      const ::Opm::data::Well& wellSol)
     {
         const auto& xcon = wellSol.connections;
 
-        for (const auto& connection : well.getConnections()) {
-            const auto ix = connection.global_index();
+        for (std::size_t c = 0; c < plan.cells.size(); ++c) {
+            const auto xconPos = plan.findResults(c, xcon);
 
-            if (! grid.cellActive(ix)) {
-                // Inactive cell.  Ignore.
-                continue;
-            }
-
-            auto xconPos = std::find_if(xcon.begin(), xcon.end(),
-                [ix](const ::Opm::data::Connection& c)
-            {
-                return c.index == ix;
-            });
-
-            if (xconPos == xcon.end()) {
+            if (xconPos == xcon.size()) {
                 // RFT data not available for this connection.  Unexpected.
                 continue;
             }
 
-            this->addConnection(usys, connection, *xconPos, grid.getCellDepth(ix));
+            this->addConnection(usys, plan, c, xcon[xconPos]);
         }
     }
 
@@ -255,13 +341,13 @@ namespace {
     }
 
     void RFTRecord::addConnection(const ::Opm::UnitSystem&       usys,
-                                  const ::Opm::Connection&       conn,
-                                  const ::Opm::data::Connection& xcon,
-                                  const double                   depth)
+                                  const ConnectionPlan&          plan,
+                                  const std::size_t              c,
+                                  const ::Opm::data::Connection& xcon)
     {
-        this->i_.push_back(conn.getI() + 1);
-        this->j_.push_back(conn.getJ() + 1);
-        this->k_.push_back(conn.getK() + 1);
+        this->i_.push_back(plan.i[c]);
+        this->j_.push_back(plan.j[c]);
+        this->k_.push_back(plan.k[c]);
 
         using M = ::Opm::UnitSystem::measure;
         auto cvrt = [&usys](const M meas, const double x) -> float
@@ -269,7 +355,7 @@ namespace {
             return usys.from_si(meas, x);
         };
 
-        this->depth_.push_back(cvrt(M::length  , depth));
+        this->depth_.push_back(cvrt(M::length  , plan.depth[c]));
         this->press_.push_back(cvrt(M::pressure, xcon.cell_pressure));
 
         this->swat_.push_back(xcon.cell_saturation_water);
@@ -291,7 +377,7 @@ namespace {
                                    const double                                 elapsed,
                                    const ::Opm::RestartIO::InteHEAD::TimePoint& timePoint,
                                    const ::Opm::UnitSystem&                     usys,
-                                   const ::Opm::EclipseGrid&                    grid,
+                                   ConnectionPlan&                              plan,
                                    const ::Opm::Well&                           well);
 
         void addDynamicData(const Opm::data::Well& wellSol);
@@ -310,7 +396,7 @@ namespace {
         using CreateTypeHandler = void (WellRFTOutputData::*)();
 
         std::reference_wrapper<const Opm::UnitSystem>  usys_;
-        std::reference_wrapper<const Opm::EclipseGrid> grid_;
+        std::reference_wrapper<ConnectionPlan>         plan_;
         std::reference_wrapper<const Opm::Well>        well_;
         double                                         elapsed_{};
         Opm::RestartIO::InteHEAD::TimePoint            timeStamp_{};
@@ -337,10 +423,10 @@ namespace {
                                          const double                                 elapsed,
                                          const ::Opm::RestartIO::InteHEAD::TimePoint& timeStamp,
                                          const ::Opm::UnitSystem&                     usys,
-                                         const ::Opm::EclipseGrid&                    grid,
+                                         ConnectionPlan&                              plan,
                                          const ::Opm::Well&                           well)
         : usys_     { std::cref(usys) }
-        , grid_     { std::cref(grid) }
+        , plan_     { std::ref(plan)  }
         , well_     { std::cref(well) }
         , elapsed_  { elapsed         }
         , timeStamp_{ timeStamp       }
@@ -386,13 +472,12 @@ namespace {
             return;
         }
 
-        this->rft_ = RFTRecord{ this->well_.get().getConnections().size() };
+        this->rft_ = RFTRecord{ this->plan_.get().cells.size() };
 
         this->dataHandlers_.emplace_back(
             [this](const Opm::data::Well& wellSol)
         {
-            this->rft_->collectRecordData(this->usys_, this->grid_,
-                                          this->well_, wellSol);
+            this->rft_->collectRecordData(this->usys_, this->plan_, wellSol);
         });
 
         this->recordWriters_.emplace_back(
@@ -495,6 +580,27 @@ namespace {
 
 // ===========================================================================
 
+struct Opm::RftIO::GatherPlans::Impl
+{
+    std::unordered_map<std::string, ConnectionPlan> plans{};
+};
+
+Opm::RftIO::GatherPlans::GatherPlans()
+    : pImpl_{ std::make_unique<Impl>() }
+{}
+
+Opm::RftIO::GatherPlans::~GatherPlans() = default;
+
+Opm::RftIO::GatherPlans::GatherPlans(GatherPlans&& rhs) = default;
+
+Opm::RftIO::GatherPlans&
+Opm::RftIO::GatherPlans::operator=(GatherPlans&& rhs) = default;
+
+std::size_t Opm::RftIO::GatherPlans::numWells() const
+{
+    return this->pImpl_->plans.size();
+}
+
 void Opm::RftIO::write(const int                        reportStep,
                        const double                     elapsed,
                        const ::Opm::UnitSystem&         usys,
@@ -502,6 +608,20 @@ void Opm::RftIO::write(const int                        reportStep,
                        const ::Opm::Schedule&           schedule,
                        const ::Opm::data::Wells&        wellSol,
                        ::Opm::EclIO::OutputStream::RFT& rftFile)
+{
+    auto plans = GatherPlans{};
+
+    write(reportStep, elapsed, usys, grid, schedule, wellSol, plans, rftFile);
+}
+
+void Opm::RftIO::write(const int                        reportStep,
+                       const double                     elapsed,
+                       const ::Opm::UnitSystem&         usys,
+                       const ::Opm::EclipseGrid&        grid,
+                       const ::Opm::Schedule&           schedule,
+                       const ::Opm::data::Wells&        wellSol,
+                       GatherPlans&                     plans,
+                       ::Opm::EclIO::OutputStream::RFT& rftFile)
 {
     const auto& rftCfg = schedule[reportStep].rft_config();
     if (! rftCfg.active()) {
@@ -512,7 +632,17 @@ void Opm::RftIO::write(const int                        reportStep,
     const auto timePoint = ::Opm::RestartIO::
         getSimulationTimePoint(schedule.getStartTime(), elapsed);
 
-    for (const auto& wname : schedule.wellNames(reportStep)) {
+    const auto wells = schedule.getWellsView(reportStep);
+
+    // The data handlers of WellRFTOutputData refer to the object itself,
+    // so the elements must not be relocated once created.
+    auto rftOutput = std::vector<WellRFTOutputData>{};
+    auto xwells = std::vector<const ::Opm::data::Well*>{};
+    rftOutput.reserve(wells.size());
+    xwells.reserve(wells.size());
+
+    for (const auto& well : wells) {
+        const auto& wname = well.name();
         auto rftTypes = std::vector<WellRFTOutputData::DataTypes>{};
 
         if (rftCfg.rft(wname) || rftCfg.plt(wname)) {
@@ -531,17 +661,29 @@ void Opm::RftIO::write(const int                        reportStep,
         }
 
         // RFT output requested for 'wname' at this time and dynamic data is
-        // available.  Collect requisite information.
-        auto rftOutput = WellRFTOutputData {
-            rftTypes, elapsed, timePoint, usys, grid,
-            schedule[reportStep].wells(wname)
-        };
+        // available.  Recreate the well's gather plan if its connections
+        // changed since it was last output.
+        auto& plan = plans.pImpl_->plans[wname];
+        if (! plan.matches(well.getConnections())) {
+            plan.build(grid, well.getConnections());
+        }
 
-        rftOutput.addDynamicData(xwPos->second);
+        rftOutput.emplace_back(rftTypes, elapsed, timePoint, usys, plan, well);
+        xwells.push_back(&xwPos->second);
+    }
 
-        // Emit RFT record for 'wname'.  This transparently handles wells
-        // without connections--e.g., if the well is only connected in
-        // inactive/deactivated cells.
-        rftOutput.write(rftFile);
+    // Collect requisite information for all affected wells in one pass.
+    // Each well has its own plan, so the wells are independent.
+    ::Opm::RestartIO::Helpers::runConcurrently(rftOutput.size(), 16, rftOutput.size() >= 64,
+        [&rftOutput, &xwells](const std::size_t w)
+    {
+        rftOutput[w].addDynamicData(*xwells[w]);
+    });
+
+    // Emit RFT records.  This transparently handles wells without
+    // connections--e.g., if the well is only connected in
+    // inactive/deactivated cells.
+    for (const auto& output : rftOutput) {
+        output.write(rftFile);
     }
 }
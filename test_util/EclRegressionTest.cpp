@@ -45,6 +45,10 @@
 #include <typeinfo>
 #include <vector>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 // helper macro to handle error throws or not
 #define HANDLE_ERROR(type, message) \
   { \
@@ -64,6 +68,58 @@ std::vector<T> sorted(std::vector<T> v) {
     return v;
 }
 
+// Indices, in increasing order, of the elements for which
+// deviates(v1[i], v2[i]) holds.  Evaluated in parallel, the predicate must
+// be free of side effects.
+template <typename T, typename Predicate>
+std::vector<std::size_t> deviatingIndices(const std::vector<T>& v1, const std::vector<T>& v2,
+                                          Predicate&& deviates)
+{
+    const std::size_t n = v1.size();
+    std::vector<std::size_t> indices;
+
+#ifdef _OPENMP
+    if (n > 16384 && omp_get_max_threads() > 1) {
+        // Each thread scans one contiguous range, so concatenating the
+        // per-thread lists in thread order keeps the indices sorted.
+        std::vector<std::vector<std::size_t>> local(omp_get_max_threads());
+
+#pragma omp parallel
+        {
+            const std::size_t num_threads = omp_get_num_threads();
+            const std::size_t thread = omp_get_thread_num();
+            const std::size_t begin = n * thread / num_threads;
+            const std::size_t end = n * (thread + 1) / num_threads;
+
+            for (std::size_t i = begin; i < end; i++) {
+                if (deviates(v1[i], v2[i]))
+                    local[thread].push_back(i);
+            }
+        }
+
+        for (const auto& thread_indices : local)
+            indices.insert(indices.end(), thread_indices.begin(), thread_indices.end());
+
+        return indices;
+    }
+#endif
+
+    for (std::size_t i = 0; i < n; i++) {
+        if (deviates(v1[i], v2[i]))
+            indices.push_back(i);
+    }
+
+    return indices;
+}
+
+std::size_t arraySize(const std::vector<Opm::EclIO::EclFile::EclEntry>& arrays, const std::string& name)
+{
+    auto it = std::find_if(arrays.begin(), arrays.end(),
+                           [&name](const Opm::EclIO::EclFile::EclEntry& array) { return std::get<0>(array) == name; });
+
+    return it == arrays.end() ? 0 : std::get<2>(*it);
+}
+
 }
 
 using namespace Opm::EclIO;
@@ -152,6 +208,77 @@ void ECLRegressionTest::compareVectors(const std::vector<T>& t1, const std::vect
 }
 
 
+template <typename T, typename Reader1, typename Reader2>
+void ECLRegressionTest::compareStreamedVectors(Reader1&& read1, Reader2&& read2,
+                                               std::size_t size1, std::size_t size2,
+                                               const std::string& keyword, const std::string& reference)
+{
+    if (size1 != size2) {
+        HANDLE_ERROR(std::runtime_error, "\nError trying to compare two vectors with different size " << keyword << " - " << reference
+                     << "\n > size of first vector : " << size1 << "\n > size of second vector: " << size2);
+        return;
+    }
+
+    auto it = std::find(keywordDisallowNegatives.begin(), keywordDisallowNegatives.end(), keyword);
+    const bool allowNegatives = it == keywordDisallowNegatives.end();
+
+    it = std::find(keywordsStrictTol.begin(), keywordsStrictTol.end(), keyword);
+    const bool strictTol = it != keywordsStrictTol.end();
+
+    // Same tolerances as deviationsForCell(), which reports the elements
+    // this predicate selects.
+    const double absTol = strictTol ? strictAbsTol : getAbsTolerance();
+    const double relTol = strictTol ? strictAbsTol : getRelTolerance();
+
+    auto deviates = [absTol, relTol, allowNegatives](T t1, T t2)
+    {
+        if constexpr (std::is_floating_point_v<T>) {
+            double val1 = std::abs(static_cast<double>(t1));
+            double val2 = std::abs(static_cast<double>(t2));
+
+            if (!allowNegatives) {
+                if ((t1 < 0 && val1 > absTol) || (t2 < 0 && val2 > absTol))
+                    return true;
+
+                val1 = t1 < 0 ? 0.0 : val1;
+                val2 = t2 < 0 ? 0.0 : val2;
+            }
+
+            const double absDev = std::abs(val1 - val2);
+            const bool relExceeded = (val1 == 0) || (val2 == 0) || (absDev > relTol * std::max(val1, val2));
+
+            return (absDev > absTol) && relExceeded;
+        } else {
+            return t1 != t2;
+        }
+    };
+
+    std::size_t reported = 0;
+
+    for (std::size_t offset = 0; offset < size1; offset += streamBlockSize) {
+        const std::size_t count = std::min(streamBlockSize, size1 - offset);
+        const std::vector<T> block1 = read1(offset, count);
+        const std::vector<T> block2 = read2(offset, count);
+
+        for (const auto i : deviatingIndices(block1, block2, deviates)) {
+
+            if constexpr (std::is_floating_point_v<T>) {
+                deviationsForCell(static_cast<double>(block1[i]), static_cast<double>(block2[i]),
+                                  keyword, reference, size1, offset + i, allowNegatives, strictTol);
+            } else {
+                deviationsForNonFloatingPoints(block1[i], block2[i], keyword, reference, size1, offset + i);
+            }
+
+            if (++reported == maxStreamDeviations) {
+                std::cout << "\nStopped comparing " << keyword << " after " << reported
+                          << " deviating elements. ";
+                return;
+            }
+        }
+    }
+}
+
+
 template <typename T>
 void ECLRegressionTest::deviationsForNonFloatingPoints(T val1, T val2, const std::string& keyword, const std::string& reference, size_t kw_size, size_t cell)
 {
@@ -556,8 +683,10 @@ void ECLRegressionTest::results_init()
 
         deviations.clear();
 
-        init1.loadData();
-        init2.loadData();
+        if (streamBlockSize == 0) {
+            init1.loadData();
+            init2.loadData();
+        }
 
         std::string reference = "Init file";
 
@@ -627,7 +756,26 @@ void ECLRegressionTest::results_init()
                 } else {
                     std::cout << "Comparing " << keywords1[i] << " ... ";
 
-                    if (arrayType1[i] == INTE) {
+                    auto compareStreamed = [&](auto value)
+                    {
+                        using T = decltype(value);
+
+                        compareStreamedVectors<T>
+                            ([&init1, &kw = keywords1[i]](std::size_t first, std::size_t count)
+                             { return init1.getRange<T>(kw, first, count); },
+                             [&init2, &kw = keywords2[ind2]](std::size_t first, std::size_t count)
+                             { return init2.getRange<T>(kw, first, count); },
+                             arraySize(arrayList1, keywords1[i]), arraySize(arrayList2, keywords2[ind2]),
+                             keywords1[i], reference);
+                    };
+
+                    if ((streamBlockSize > 0) && (arrayType1[i] == INTE)) {
+                        compareStreamed(int{});
+                    } else if ((streamBlockSize > 0) && (arrayType1[i] == REAL)) {
+                        compareStreamed(float{});
+                    } else if ((streamBlockSize > 0) && (arrayType1[i] == DOUB)) {
+                        compareStreamed(double{});
+                    } else if (arrayType1[i] == INTE) {
                         auto vect1 = init1.get<int>(keywords1[i]);
                         auto vect2 = init2.get<int>(keywords2[ind2]);
                         compareVectors(vect1, vect2, keywords1[i],reference);
@@ -746,8 +894,10 @@ void ECLRegressionTest::results_rst()
 
             std::string reference = "Restart, sequence "+std::to_string(seqn);
 
-            rst1->loadReportStepNumber(seqn);
-            rst2->loadReportStepNumber(seqn);
+            if (streamBlockSize == 0) {
+                rst1->loadReportStepNumber(seqn);
+                rst2->loadReportStepNumber(seqn);
+            }
 
             auto arrays1 = rst1->listOfRstArrays(seqn);
             auto arrays2 = rst2->listOfRstArrays(seqn);
@@ -821,7 +971,29 @@ void ECLRegressionTest::results_rst()
 
                         std::cout << "Comparing " << keywords1[i] << " ... ";
 
-                        if (arrayType1[i] == INTE) {
+                        // DOUBHEAD is patched before comparison, see below.
+                        const bool streamed = (streamBlockSize > 0) && (keywords1[i] != "DOUBHEAD");
+
+                        auto compareStreamed = [&](auto value)
+                        {
+                            using T = decltype(value);
+
+                            compareStreamedVectors<T>
+                                ([&rst1, &kw = keywords1[i], seqn](std::size_t first, std::size_t count)
+                                 { return rst1->getRestartDataRange<T>(kw, seqn, first, count); },
+                                 [&rst2, &kw = keywords2[ind2], seqn](std::size_t first, std::size_t count)
+                                 { return rst2->getRestartDataRange<T>(kw, seqn, first, count); },
+                                 arraySize(arrays1, keywords1[i]), arraySize(arrays2, keywords2[ind2]),
+                                 keywords1[i], reference);
+                        };
+
+                        if (streamed && (arrayType1[i] == INTE)) {
+                            compareStreamed(int{});
+                        } else if (streamed && (arrayType1[i] == REAL)) {
+                            compareStreamed(float{});
+                        } else if (streamed && (arrayType1[i] == DOUB)) {
+                            compareStreamed(double{});
+                        } else if (arrayType1[i] == INTE) {
                             auto vect1 = rst1->getRestartData<int>(keywords1[i], seqn, 0);
                             auto vect2 = rst2->getRestartData<int>(keywords2[ind2], seqn, 0);
                             compareVectors(vect1, vect2, keywords1[i], reference);
@@ -24,6 +24,8 @@
 
 #include <opm/io/eclipse/EclIOdata.hpp>
 
+#include <cstddef>
+
 namespace Opm { namespace EclIO {
     class EGrid;
 }}
@@ -90,6 +92,15 @@ public:
         this->loadBaseRunData = loadArg;
     }
 
+    // Compare INTE, REAL and DOUB arrays in INIT and unified restart files
+    // block by block, reading 'blockSize' elements of each array at a time
+    // from both cases instead of loading the complete files.  Stops comparing
+    // an array once 'maxDeviations' deviating elements have been reported.
+    void setStreamingComparison(std::size_t blockSize, std::size_t maxDeviations) {
+        this->streamBlockSize = blockSize;
+        this->maxStreamDeviations = maxDeviations;
+    }
+
     void loadGrids();
     void printDeviationReport();
 
@@ -135,6 +146,14 @@ private:
     void compareFloatingPointVectors(const std::vector<T>& t1, const std::vector<T> &t2,
                                      const std::string& keyword, const std::string& reference);
 
+    // Block-wise comparison of two arrays of size 'size1' and 'size2'.
+    // read1(first, count) and read2(first, count) return elements
+    // [first, first + count) of the respective arrays.
+    template <typename T, typename Reader1, typename Reader2>
+    void compareStreamedVectors(Reader1&& read1, Reader2&& read2,
+                                std::size_t size1, std::size_t size2,
+                                const std::string& keyword, const std::string& reference);
+
     // deviationsForCell throws an exception if both the absolute deviation AND the relative deviation
     // are larger than absTolerance and relTolerance, respectively. In addition,
     // if allowNegativeValues is passed as false, an exception will be thrown when the absolute value
@@ -177,6 +196,11 @@ private:
 
     bool loadBaseRunData = false;
 
+    // Number of array elements per block in streaming comparison, zero to
+    // load and compare complete arrays.
+    std::size_t streamBlockSize = 0;
+    std::size_t maxStreamDeviations = 100;
+
     // specific keyword to be compared
     std::string specificKeyword;
 
@@ -20,6 +20,8 @@
 
 #include <opm/common/ErrorMacros.hpp>
 
+#include <cstddef>
+#include <cstdlib>
 #include <iostream>
 #include <string>
 #include <getopt.h>
@@ -40,9 +42,11 @@ static void printHelp() {
               << "   The integration test compares SGAS, SWAT and PRESSURE in unified restart files, and WOPR, WGPR, WWPR and WBHP (all wells) in summary file. \n"
               << "-k Specify specific keyword to compare (capitalized), for examples -k PRESSURE or -k WOPR:A-1H \n"
               << "-l Only do comparison for the last Report Step. This option is only valid for restart files.\n"
+              << "-m Maximum number of deviating elements reported for each array when comparing in blocks (option -s), default 100.\n"
               << "-n Do not throw on errors.\n"
               << "-p Print keywords in both cases and exit.\n"
               << "-r compare a specific report time step number in a restart file.\n"
+              << "-s Compare arrays in init and unified restart files in blocks of this many elements, without loading the complete files.\n"
               << "-t Specify ECLIPSE filetype to compare, (default behaviour is that all files are compared if found). Different possible arguments are:\n"
               << "    -t UNRST \t Compare two unified restart files (.UNRST). This the default value, so it is the same as not passing option -t.\n"
               << "    -t EGRID  \t Compare two EGrid files (.EGRID).\n"
@@ -95,9 +99,11 @@ int main(int argc, char** argv) {
     char* keyword                  = nullptr;
     int c                          = 0;
     int reportStepNumber           = -1;
+    std::size_t streamBlockSize    = 0;
+    std::size_t maxStreamDeviations = 100;
     std::string fileTypeString;
 
-    while ((c = getopt(argc, argv, "hik:alnpt:Rr:xd")) != -1) {
+    while ((c = getopt(argc, argv, "hik:alm:npt:Rr:s:xd")) != -1) {
         switch (c) {
         case 'a':
             analysis = true;
@@ -119,6 +125,9 @@ int main(int argc, char** argv) {
         case 'l':
             onlyLastSequence = true;
             break;
+        case 'm':
+            maxStreamDeviations = std::strtoul(optarg, nullptr, 10);
+            break;
         case 'n':
             throwOnError = false;
             break;
@@ -132,6 +141,9 @@ int main(int argc, char** argv) {
         case 'R':
             restartFile = true;
             break;
+        case 's':
+            streamBlockSize = std::strtoul(optarg, nullptr, 10);
+            break;
         case 't':
             specificFileType = true;
             fileTypeString=optarg;
@@ -212,6 +224,10 @@ int main(int argc, char** argv) {
             comparator.setLoadBaseRunData(true);
         }
 
+        if (streamBlockSize > 0) {
+            comparator.setStreamingComparison(streamBlockSize, maxStreamDeviations);
+        }
+
         comparator.loadGrids();
 
         if (integrationTest && specificFileType) {
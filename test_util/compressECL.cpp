@@ -0,0 +1,161 @@
+/*
+   Copyright 2026 Equinor ASA.
+
+   This file is part of the Open Porous Media project (OPM).
+
+   OPM is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   OPM is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+   */
+
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <getopt.h>
+
+#include <opm/io/eclipse/EclFile.hpp>
+#include <opm/io/eclipse/EclOutput.hpp>
+
+using namespace Opm::EclIO;
+
+namespace {
+
+// Copy all arrays of input file to output file, one array at a time.
+void copyArrays(EclFile& inFile, EclOutput& outFile)
+{
+    const auto arrayList = inFile.getList();
+    const auto& elementSizeList = inFile.getElementSizeList();
+
+    for (std::size_t index = 0; index < arrayList.size(); index++) {
+        const auto& [name, arrType, size] = arrayList[index];
+
+        switch (arrType) {
+        case INTE:
+            outFile.write(name, inFile.get<int>(index));
+            break;
+        case REAL:
+            outFile.write(name, inFile.get<float>(index));
+            break;
+        case DOUB:
+            outFile.write(name, inFile.get<double>(index));
+            break;
+        case LOGI:
+            outFile.write(name, inFile.get<bool>(index));
+            break;
+        case CHAR:
+            outFile.write(name, inFile.get<std::string>(index));
+            break;
+        case C0NN:
+            outFile.write(name, inFile.get<std::string>(index), elementSizeList[index]);
+            break;
+        case MESS:
+            outFile.message(name);
+            break;
+        default:
+            std::cout << "unknown array type " << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+
+        inFile.clearData();
+    }
+}
+
+double seconds(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+double megaBytes(std::uintmax_t bytes)
+{
+    return static_cast<double>(bytes) / (1024.0 * 1024.0);
+}
+
+void printHelp() {
+
+    std::cout << "\ncompressECL copies a binary ECLIPSE file (e.g. .INIT or .UNRST) to the compressed binary format, or back. Needs two arguments, the input and the output file.\n"
+              << "\nIn addition, the program takes these options (which must be given before the arguments):\n\n"
+              << "-h Print help and exit.\n"
+              << "-d Decompress, i.e., write an uncompressed output file.\n"
+              << "-b Benchmark, i.e., report file sizes, compression ratio and write and read throughput.\n\n";
+}
+
+} // Anonymous namespace
+
+int main(int argc, char **argv) {
+
+    int c             = 0;
+    bool decompress   = false;
+    bool benchmark    = false;
+
+    while ((c = getopt(argc, argv, "hdb")) != -1) {
+        switch (c) {
+        case 'h':
+            printHelp();
+            return 0;
+        case 'd':
+            decompress = true;
+            break;
+        case 'b':
+            benchmark = true;
+            break;
+        default:
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (argc - optind != 2) {
+        printHelp();
+        return EXIT_FAILURE;
+    }
+
+    const std::string inputName = argv[optind];
+    const std::string outputName = argv[optind + 1];
+
+    EclFile inFile(inputName);
+
+    if (inFile.formattedInput()) {
+        std::cout << "\n!ERROR, input file '" << inputName << "' is formatted, only binary files are supported\n" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    {
+        EclOutput outFile(outputName, false, std::ios::out, !decompress);
+        copyArrays(inFile, outFile);
+    }
+    const double writeTime = seconds(start);
+
+    if (benchmark) {
+        // Time reading of every array from the new file, excluding the
+        // initial scan of its array headers.
+        EclFile outFile(outputName);
+
+        start = std::chrono::steady_clock::now();
+        outFile.loadData();
+        const double readTime = seconds(start);
+
+        const auto inputSize = std::filesystem::file_size(inputName);
+        const auto outputSize = std::filesystem::file_size(outputName);
+        const auto rawSize = decompress ? outputSize : inputSize;
+
+        std::cout << std::fixed << std::setprecision(2)
+                  << "input size      : " << megaBytes(inputSize) << " MB\n"
+                  << "output size     : " << megaBytes(outputSize) << " MB\n"
+                  << "ratio           : " << static_cast<double>(inputSize) / outputSize << "\n"
+                  << "write           : " << megaBytes(rawSize) / writeTime << " MB/s (uncompressed)\n"
+                  << "read            : " << megaBytes(rawSize) / readTime << " MB/s (uncompressed)\n";
+    }
+
+    return 0;
+}
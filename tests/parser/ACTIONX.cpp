@@ -25,6 +25,8 @@
 #include <boost/test/unit_test.hpp>
 #include <boost/test/tools/floating_point_comparison.hpp>
 
+#include <fmt/format.h>
+
 #include <opm/common/utility/TimeService.hpp>
 #include <opm/common/utility/OpmInputError.hpp>
 
@@ -227,6 +229,124 @@ COMPDAT
     Action::Result action_result(true);
     const auto& action1 = sched[0].actions.get()["ACTION"];
     BOOST_CHECK_NO_THROW( sched.applyAction(0, action1, {}, {}));
+    BOOST_CHECK_NO_THROW( sched.back() );
+}
+
+BOOST_AUTO_TEST_CASE(DeferredReplay) {
+    const auto deck_string = std::string{ R"(
+SCHEDULE
+
+WELSPECS
+  'W0'  'OP'  1 1 3.33  'OIL' 7*/
+/
+
+ACTIONX
+   'A' 10 /
+   WWCT OPX  > 0.75 /
+/
+
+WELSPECS
+  'W1'  'OP'  1 1 3.33  'OIL' 7*/
+/
+
+ENDACTIO
+
+TSTEP
+   10 /
+
+WCONPROD
+ 'W*'      'OPEN'      'ORAT'      1000.0      0.000      0.000  5* /
+/
+
+TSTEP
+   10 /
+
+TSTEP
+   10 /
+
+TSTEP
+   10 /
+)"};
+
+    Schedule sched = make_schedule(deck_string);
+    const auto num_steps = sched.size();
+    BOOST_CHECK_EQUAL(num_steps, 5U);
+    BOOST_CHECK( !sched.hasWell("W1", 4) );
+
+    const auto action = sched[0].actions.get()["A"];
+    sched.applyAction(0, action, {}, {});
+
+    // The report steps after the action are reprocessed on demand, one
+    // request at a time, and see the well created by the action.
+    BOOST_CHECK_EQUAL(sched.size(), num_steps);
+    BOOST_CHECK( sched.hasWell("W1", 0) );
+    BOOST_CHECK( sched.getWell("W1", 1).getProductionProperties().controlMode == Well::ProducerCMode::ORAT );
+    BOOST_CHECK( sched.getWell("W1", 2).getProductionProperties().controlMode == Well::ProducerCMode::ORAT );
+
+    // Requesting later report steps must not invalidate references to the
+    // steps which have already been processed.
+    const auto& step2 = sched[2];
+    const auto& well2 = sched.getWell("W1", 2);
+    sched.back();
+    BOOST_CHECK( &step2 == &sched[2] );
+    BOOST_CHECK( &well2 == &sched.getWell("W1", 2) );
+
+    sched.applyAction(2, action, {}, {});
+    BOOST_CHECK_EQUAL(sched.size(), num_steps);
+    BOOST_CHECK( sched.getWell("W1", 3).getProductionProperties().controlMode == Well::ProducerCMode::ORAT );
+    BOOST_CHECK_EQUAL( sched.wellNames().size(), 2U );
+    BOOST_CHECK_EQUAL( std::distance(sched.begin(), sched.end()), static_cast<std::ptrdiff_t>(num_steps) );
+    BOOST_CHECK_EQUAL( sched.seconds(4), 40 * 86400.0 );
+}
+
+BOOST_AUTO_TEST_CASE(DeferredReplayPatterns) {
+    const auto deck_string = std::string{ R"(
+SCHEDULE
+
+WELSPECS
+  'W0'  'OP'  1 1 3.33  'OIL' 7*/
+/
+
+ACTIONX
+   'A' 10 /
+   WWCT OPX  > 0.75 /
+/
+
+WELSPECS
+  'W1'  'OP'  1 1 3.33  'OIL' 7*/
+/
+
+ENDACTIO
+
+TSTEP
+   10 /
+
+GCONPROD
+  'OP'  'ORAT'  1000 /
+/
+
+WLIFTOPT
+  'W*'  YES  150000  1.01  -1.0 /
+/
+
+TSTEP
+   10 /
+
+TSTEP
+   10 /
+)"};
+
+    Schedule sched = make_schedule(deck_string);
+    const auto action = sched[0].actions.get()["A"];
+    sched.applyAction(0, action, {}, {});
+
+    // The group and well name patterns of the replayed keywords are
+    // resolved against the report step being replayed.
+    BOOST_CHECK( sched.getGroup("OP", 1).has_control(Group::ProductionCMode::ORAT) );
+    BOOST_CHECK( sched.glo(1).has_well("W0") );
+    BOOST_CHECK( sched.glo(1).has_well("W1") );
+    BOOST_CHECK( sched.getGroup("OP", 3).has_control(Group::ProductionCMode::ORAT) );
+    BOOST_CHECK_EQUAL( sched.wellNames("W*").size(), 2U );
 }
 
 BOOST_AUTO_TEST_CASE(EMPTY) {
@@ -742,6 +862,89 @@ BOOST_AUTO_TEST_CASE(TestWLIST) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(TestWellSetUpdate) {
+    WListManager wlm;
+    Action::AST ast_pattern({"WOPR", "OP*", ">", "1.0"});
+    Action::AST ast_wlist({"WOPR", "*LIST1", ">", "1.0", "OR", "WOPR", "W1", ">", "1.0"});
+    SummaryState st(TimeService::now());
+    Action::Context context(st, wlm);
+
+    auto sorted_wells = [](const Action::Result& res) {
+        auto wells = res.wells();
+        std::sort(wells.begin(), wells.end());
+        return wells;
+    };
+
+    st.update_well_var("OP1", "WOPR", 2.0);
+    st.update_well_var("OP2", "WOPR", 0.5);
+    st.update_well_var("W1", "WOPR", 0.5);
+    st.update_well_var("W2", "WOPR", 2.0);
+    wlm.newList("*LIST1", {"W2"});
+    {
+        const auto res_pattern = ast_pattern.eval(context);
+        const auto res_wlist = ast_wlist.eval(context);
+        BOOST_CHECK(res_pattern);
+        BOOST_CHECK(res_wlist);
+        BOOST_CHECK(sorted_wells(res_pattern) == std::vector<std::string>{"OP1"});
+        BOOST_CHECK(sorted_wells(res_wlist) == std::vector<std::string>{"W2"});
+    }
+
+    // New well matching the pattern, changed WLIST and changed values.
+    st.update_well_var("OP3", "WOPR", 3.0);
+    st.update_well_var("W1", "WOPR", 2.0);
+    wlm.newList("*LIST1", {"OP1", "OP2"});
+    {
+        const auto res_pattern = ast_pattern.eval(context);
+        const auto res_wlist = ast_wlist.eval(context);
+        BOOST_CHECK(sorted_wells(res_pattern) == (std::vector<std::string>{"OP1", "OP3"}));
+        BOOST_CHECK(sorted_wells(res_wlist) == (std::vector<std::string>{"OP1", "W1"}));
+    }
+
+    st.update_well_var("OP1", "WOPR", 0.0);
+    st.update_well_var("OP3", "WOPR", 0.0);
+    BOOST_CHECK(!ast_pattern.eval(context));
+}
+
+BOOST_AUTO_TEST_CASE(TestCopiedConditions) {
+    WListManager wlm;
+    Action::AST ast({"WOPR", "OP*", ">", "1.0"});
+    SummaryState st1(TimeService::now());
+    SummaryState st2(TimeService::now());
+
+    // More wells than fit in one word of the well bitset.
+    std::vector<std::string> expected1;
+    for (int w = 0; w < 70; w++) {
+        const auto well = fmt::format("OP{:02d}", w);
+        st1.update_well_var(well, "WOPR", (w % 3 == 0) ? 2.0 : 0.5);
+        if (w % 3 == 0)
+            expected1.push_back(well);
+    }
+    st2.update_well_var("OP99", "WOPR", 5.0);
+    st2.update_well_var("OPXX", "WOPR", 0.0);
+
+    auto sorted_wells = [](const Action::Result& res) {
+        auto wells = res.wells();
+        std::sort(wells.begin(), wells.end());
+        return wells;
+    };
+
+    Action::Context context1(st1, wlm);
+    Action::Context context2(st2, wlm);
+    BOOST_CHECK(sorted_wells(ast.eval(context1)) == expected1);
+
+    // The copy has its own cached well sets, evaluating it with a different
+    // state does not disturb the original.
+    Action::AST copy = ast;
+    BOOST_CHECK(sorted_wells(copy.eval(context2)) == std::vector<std::string>{"OP99"});
+    BOOST_CHECK(sorted_wells(ast.eval(context1)) == expected1);
+
+    Action::AST assigned;
+    assigned = copy;
+    BOOST_CHECK(sorted_wells(assigned.eval(context1)) == expected1);
+    BOOST_CHECK(sorted_wells(copy.eval(context2)) == std::vector<std::string>{"OP99"});
+    BOOST_CHECK(assigned == ast);
+}
+
 BOOST_AUTO_TEST_CASE(TestFieldAND) {
     Action::AST ast({"FMWPR", ">=", "4", "AND", "WUPR3", "OP*", "=", "1"});
     SummaryState st(TimeService::now());
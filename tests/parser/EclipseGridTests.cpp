@@ -723,6 +723,82 @@ BOOST_AUTO_TEST_CASE(ResetACTNUM) {
     BOOST_CHECK_EQUAL(grid.getGlobalIndex(1,2,3), 321U);
 }
 
+BOOST_AUTO_TEST_CASE(CompressedStorage) {
+    Opm::EclipseGrid grid(10, 10, 10, 1.0, 1.0, 1234.567);
+    const Opm::EclipseGrid ref_grid(grid);
+
+    std::vector<int> actnum(1000, 1);
+    for (std::size_t g = 0; g < actnum.size(); g += 7)
+        actnum[g] = 0;
+
+    grid.resetACTNUM(actnum);
+    const auto active_map = grid.getActiveMap();
+    const auto num_active = grid.getNumActive();
+
+    grid.compressACTNUM();
+    BOOST_CHECK_EQUAL(grid.getNumActive(), num_active);
+    BOOST_CHECK(grid.getACTNUM() == actnum);
+    BOOST_CHECK(grid.getActiveMap() == active_map);
+    for (std::size_t g = 0; g < actnum.size(); g++) {
+        BOOST_CHECK_EQUAL(grid.cellActive(g), actnum[g] == 1);
+        if (actnum[g] == 1)
+            BOOST_CHECK_EQUAL(grid.getGlobalIndex(grid.activeIndex(g)), g);
+        else
+            BOOST_CHECK_THROW(grid.activeIndex(g), std::invalid_argument);
+    }
+    BOOST_CHECK_THROW(grid.getGlobalIndex(num_active), std::out_of_range);
+
+    // Still compressed after resetting ACTNUM.
+    grid.resetACTNUM();
+    BOOST_CHECK_EQUAL(grid.getNumActive(), 1000U);
+    BOOST_CHECK_EQUAL(grid.getGlobalIndex(999), 999U);
+
+    // The largest depth is 12345.67 m; single precision can not represent
+    // all the depths to within 1e-6 m.
+    BOOST_CHECK(!grid.compressZCORN(1.0e-6));
+    BOOST_CHECK(grid.compressZCORN(1.0e-2));
+    BOOST_CHECK_EQUAL(grid.getZCORN().size(), ref_grid.getZCORN().size());
+    BOOST_CHECK_CLOSE(grid.getCellVolume(123), ref_grid.getCellVolume(123), 1.0e-3);
+    BOOST_CHECK_CLOSE(grid.getCellDepth(999), ref_grid.getCellDepth(999), 1.0e-3);
+}
+
+BOOST_AUTO_TEST_CASE(CompressedStorageConcurrentAccess) {
+    Opm::EclipseGrid grid(10, 10, 10, 1.0, 1.0, 1234.5);
+    std::vector<int> actnum(1000, 1);
+    for (std::size_t g = 0; g < actnum.size(); g += 3)
+        actnum[g] = 0;
+
+    grid.resetACTNUM(actnum);
+    const auto active_map = grid.getActiveMap();
+    const auto zcorn = grid.getZCORN();
+    grid.compressACTNUM();
+    BOOST_REQUIRE(grid.compressZCORN(1.0e-2));
+
+    // The expanded arrays are created on first access, which may happen
+    // from several threads at the same time.
+    const auto& cgrid = grid;
+    const int num_tasks = 64;
+    std::vector<const void*> actnum_ptr(num_tasks), active_ptr(num_tasks), zcorn_ptr(num_tasks);
+    std::vector<char> equal(num_tasks, 0);
+#pragma omp parallel for
+    for (int task = 0; task < num_tasks; ++task) {
+        const auto& a = cgrid.getACTNUM();
+        const auto& m = cgrid.getActiveMap();
+        const auto& z = cgrid.getZCORN();
+        actnum_ptr[task] = &a;
+        active_ptr[task] = &m;
+        zcorn_ptr[task] = &z;
+        equal[task] = (a == actnum) && (m == active_map) && (z.size() == zcorn.size());
+    }
+
+    for (int task = 0; task < num_tasks; ++task) {
+        BOOST_CHECK(equal[task]);
+        BOOST_CHECK_EQUAL(actnum_ptr[task], actnum_ptr[0]);
+        BOOST_CHECK_EQUAL(active_ptr[task], active_ptr[0]);
+        BOOST_CHECK_EQUAL(zcorn_ptr[task], zcorn_ptr[0]);
+    }
+}
+
 BOOST_AUTO_TEST_CASE(TestCP_example) {
     const char* deckData =
 
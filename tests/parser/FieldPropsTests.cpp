@@ -136,6 +136,55 @@ PERMX
 
 
 
+BOOST_AUTO_TEST_CASE(SharedFieldPropsCopy) {
+    std::string deck_string = R"(
+GRID
+
+PORO
+   1000*0.10 /
+
+PERMX
+   1000*1 /
+
+)";
+    EclipseGrid grid(10,10,10);
+    Deck deck = Parser{}.parseString(deck_string);
+    FieldPropsManager fpm1(deck, Phases{true, true, true}, grid, TableManager());
+
+    const auto fpm2 = fpm1;
+    BOOST_CHECK(fpm1 == fpm2);
+    BOOST_CHECK_EQUAL(fpm1.try_get<double>("PORO"), fpm2.try_get<double>("PORO"));
+
+    // Keywords where all cells have the same status are finalized when
+    // the deck has been processed, and are restored before modification.
+    BOOST_CHECK(fpm1.get_double_field_data("PORO").uniform_status.has_value());
+
+    const auto defaulted = fpm1.defaulted<double>("PORO");
+    BOOST_CHECK(std::none_of(defaulted.begin(), defaulted.end(), [](bool d) { return d; }));
+
+    std::vector<int> actnum(1000, 1);
+    actnum[0] = 0;
+    fpm1.reset_actnum(actnum);
+
+    BOOST_CHECK_EQUAL(fpm1.active_size(), 999U);
+    BOOST_CHECK_EQUAL(fpm1.get_double("PORO").size(), 999U);
+    BOOST_CHECK_EQUAL(fpm2.active_size(), 1000U);
+    BOOST_CHECK_EQUAL(fpm2.get_double("PORO").size(), 1000U);
+    BOOST_CHECK(fpm1.try_get<double>("PERMX") != fpm2.try_get<double>("PERMX"));
+
+    // Reading the field data does not modify - or detach - the keyword.
+    const auto fpm3 = fpm2;
+    const auto& field_data = fpm2.get_double_field_data("PERMX");
+    BOOST_CHECK_EQUAL(field_data.size(), 1000U);
+    BOOST_CHECK(field_data.uniform_status.has_value());
+    BOOST_CHECK(field_data.value_status.empty());
+    BOOST_CHECK(field_data.status(999) == value::status::deck_value);
+    BOOST_CHECK_EQUAL(fpm2.try_get<double>("PERMX"), fpm3.try_get<double>("PERMX"));
+    BOOST_CHECK_EQUAL(&fpm3.get_double_field_data("PERMX"), &field_data);
+}
+
+
+
 BOOST_AUTO_TEST_CASE(CreateFieldPropsForActnum) {
     std::string deck_string = R"(
 GRID
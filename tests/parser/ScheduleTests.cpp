@@ -48,6 +48,8 @@
 #include <opm/input/eclipse/EclipseState/Tables/TableManager.hpp>
 #include <opm/input/eclipse/Schedule/Schedule.hpp>
 #include <opm/input/eclipse/Schedule/OilVaporizationProperties.hpp>
+#include <opm/input/eclipse/Schedule/PreparedKeywords.hpp>
+#include <opm/input/eclipse/Schedule/ScheduleDeck.hpp>
 #include <opm/input/eclipse/Schedule/Well/WellConnections.hpp>
 #include <opm/input/eclipse/Schedule/Well/Well.hpp>
 #include <opm/input/eclipse/Schedule/GasLiftOpt.hpp>
@@ -647,6 +649,32 @@ BOOST_AUTO_TEST_CASE(WellsIterator_HasWells_WellsReturned) {
     BOOST_CHECK( unique[1].second == schedule[3].well_order());
 }
 
+BOOST_AUTO_TEST_CASE(WellsView_OrderedAsWellOrder) {
+    const auto& schedule = make_schedule( createDeckWithWells() );
+
+    const auto view_t0 = schedule.getWellsView(0);
+    BOOST_CHECK_EQUAL(view_t0.size(), 1U);
+    BOOST_CHECK(!view_t0.empty());
+
+    const auto view = schedule.getWellsViewatEnd();
+    const auto wells = schedule.getWellsatEnd();
+    const auto& well_order = schedule.back().well_order();
+    BOOST_REQUIRE_EQUAL(view.size(), wells.size());
+    BOOST_REQUIRE_EQUAL(view.size(), well_order.size());
+    for (std::size_t index = 0; index < view.size(); index++) {
+        BOOST_CHECK_EQUAL(view.name(index), well_order[index]);
+        BOOST_CHECK(view[index] == wells[index]);
+        BOOST_CHECK_EQUAL(&view[index], &schedule.getWellatEnd(well_order[index]));
+    }
+
+    std::size_t count = 0;
+    for (const auto& well : view)
+        BOOST_CHECK_EQUAL(well.name(), well_order[count++]);
+    BOOST_CHECK_EQUAL(count, view.size());
+
+    BOOST_CHECK_THROW(schedule.getWellsView(schedule.size()), std::invalid_argument);
+}
+
 
 
 BOOST_AUTO_TEST_CASE(ReturnNumWellsTimestep) {
@@ -3396,6 +3424,68 @@ VFPINJ
     }
 }
 
+BOOST_AUTO_TEST_CASE(PreparedKeywordsTest) {
+    const std::string input = R"(
+START
+8 MAR 1998 /
+
+SCHEDULE
+VFPINJ
+       5  32.9   WAT   THP METRIC   BHP /
+1 3 5 /
+7 11 /
+1 1.5 2.5 3.5 /
+2 4.5 5.5 6.5 /
+TSTEP
+10 /
+ACTIONX
+ACT1 /
+WWCT OPX > 0.75 /
+/
+VFPINJ
+       6  32.9   WAT   THP METRIC   BHP /
+1 3 5 /
+7 11 /
+1 1.5 2.5 3.5 /
+2 4.5 5.5 6.5 /
+ENDACTIO
+VFPINJ
+       7  32.9   WAT   THP METRIC   BHP /
+1 3 5 /
+7 11 /
+1 1.5 2.5 3.5 /
+/
+)";
+
+    const auto deck = Parser{}.parseString(input);
+    const auto unit_system = UnitSystem::newMETRIC();
+    const ScheduleDeck sched_deck(TimeService::from_time_t(asTimeT(TimeStampUTC(1998, 3, 8))), deck, {});
+    const auto& vfp0 = sched_deck[0][0];
+    const auto& vfp_action = sched_deck[1][1];
+    const auto& vfp_invalid = sched_deck[1][3];
+    BOOST_REQUIRE_EQUAL(vfp0.name(), "VFPINJ");
+    BOOST_REQUIRE_EQUAL(vfp_action.name(), "VFPINJ");
+    BOOST_REQUIRE_EQUAL(vfp_invalid.name(), "VFPINJ");
+
+    // The keywords in the ACTIONX block and the invalid table are not prepared.
+    PreparedKeywords prepared(sched_deck, 0, sched_deck.size(), false, unit_system);
+    BOOST_CHECK_EQUAL(prepared.size(), 1U);
+    BOOST_CHECK_EQUAL(PreparedKeywords(prepared).size(), 0U);
+    BOOST_CHECK(!prepared.take<VFPInjTable>(vfp_action).has_value());
+    BOOST_CHECK(!prepared.take<VFPInjTable>(vfp_invalid).has_value());
+
+    const auto table = prepared.take<VFPInjTable>(vfp0);
+    BOOST_REQUIRE(table.has_value());
+    BOOST_CHECK(*table == VFPInjTable(vfp0, unit_system));
+    BOOST_CHECK_EQUAL(prepared.size(), 0U);
+    BOOST_CHECK(!prepared.take<VFPInjTable>(vfp0).has_value());
+
+    PreparedKeywords later_steps(sched_deck, 1, sched_deck.size(), false, unit_system);
+    BOOST_CHECK_EQUAL(later_steps.size(), 0U);
+
+    BOOST_CHECK_THROW(make_schedule(input), std::exception);
+}
+
 // tests for the polymer injectivity case
 BOOST_AUTO_TEST_CASE(POLYINJ_TEST) {
     const std::string deckData = R"(
@@ -3706,6 +3796,28 @@ BOOST_AUTO_TEST_CASE(WellOrderTest) {
     BOOST_CHECK( !wo.has("G1"));
 }
 
+BOOST_AUTO_TEST_CASE(WellOrderMatch) {
+    NameOrder wo({"PROD2", "INJ1", "PROD10", "PROD1", "P1"});
+
+    BOOST_CHECK( wo.match("PROD*") == std::vector<std::string>({"PROD2", "PROD10", "PROD1"}) );
+    BOOST_CHECK( wo.match("PROD1*") == std::vector<std::string>({"PROD10", "PROD1"}) );
+    BOOST_CHECK( wo.match("P*1") == std::vector<std::string>({"PROD1", "P1"}) );
+    BOOST_CHECK( wo.match("*1") == std::vector<std::string>({"INJ1", "PROD1", "P1"}) );
+    BOOST_CHECK( wo.match("X*").empty() );
+
+    // Memoized results are discarded when a name is added, copies are independent.
+    const auto copy = wo;
+    wo.add("PROD3");
+    BOOST_CHECK( wo.match("PROD*") == std::vector<std::string>({"PROD2", "PROD10", "PROD1", "PROD3"}) );
+    BOOST_CHECK( copy.match("PROD*") == std::vector<std::string>({"PROD2", "PROD10", "PROD1"}) );
+
+    GroupOrder go(5);
+    go.add("G1");
+    go.add("OP");
+    go.add("G2");
+    BOOST_CHECK( go.match("G*") == std::vector<std::string>({"G1", "G2"}) );
+}
+
 BOOST_AUTO_TEST_CASE(GroupOrderTest) {
     const std::size_t max_groups = 9;
     GroupOrder go(max_groups);
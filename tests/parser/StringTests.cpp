@@ -149,4 +149,23 @@ BOOST_AUTO_TEST_CASE(match_test) {
     BOOST_CHECK( !shmatch("NAME.*", "NAME") );
 }
 
+BOOST_AUTO_TEST_CASE(shell_pattern) {
+    const ShellPattern prod("PROD*1?");
+    BOOST_CHECK_EQUAL( prod.prefix(), "PROD" );
+    BOOST_CHECK( prod.match("PROD1X") );
+    BOOST_CHECK( prod.match("PRODA1B1C") );
+    BOOST_CHECK( !prod.match("PROD1") );
+    BOOST_CHECK( !prod.match("XPROD11") );
+
+    const ShellPattern any("*");
+    BOOST_CHECK_EQUAL( any.prefix(), "" );
+    BOOST_CHECK( any.match("") );
+    BOOST_CHECK( any.match("W1") );
+
+    const ShellPattern regex("NAME[0-9]?");
+    BOOST_CHECK_EQUAL( regex.prefix(), "" );
+    BOOST_CHECK( regex.match("NAME13") );
+    BOOST_CHECK( !regex.match("NAME13X") );
+}
+
 
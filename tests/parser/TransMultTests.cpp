@@ -74,4 +74,12 @@ MULTZ
 
     transMult.applyMULT(fp.get_global_double("MULTZ"), Opm::FaceDir::ZPlus);
     BOOST_CHECK_EQUAL( transMult.getMultiplier(0,0,0 , Opm::FaceDir::ZPlus) , 4.0 );
+
+    std::vector<double> multipliers;
+    const std::vector<std::size_t> cells = {0, 7, 124};
+    transMult.getMultipliers(cells, Opm::FaceDir::ZPlus, multipliers);
+    BOOST_CHECK( multipliers == std::vector<double>({4.0, 4.0, 4.0}) );
+
+    transMult.getMultipliers(cells, Opm::FaceDir::XMinus, multipliers);
+    BOOST_CHECK( multipliers == std::vector<double>({1.0, 1.0, 1.0}) );
 }
@@ -30,11 +30,13 @@ Copyright 2018 Statoil ASA.
 #include <opm/input/eclipse/Schedule/SummaryState.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQActive.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQAssign.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQASTNode.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQConfig.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQContext.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQEnums.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQFunction.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQFunctionTable.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQProgram.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQSet.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQState.hpp>
 #include <opm/input/eclipse/Schedule/Well/NameOrder.hpp>
@@ -55,6 +57,7 @@ Copyright 2018 Statoil ASA.
 #include <limits>
 #include <stdexcept>
 #include <string>
+#include <tuple>
 #include <vector>
 
 using namespace Opm;
@@ -241,6 +244,110 @@ BOOST_AUTO_TEST_CASE(UDQFieldSetTest) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(UDQProgramEvalTest) {
+    UDQParams udqp;
+    UDQFunctionTable udqft(udqp);
+    SummaryState st(TimeService::now());
+    UDQState udq_state(udqp.undefinedValue());
+    UDQContext context(udqft, WellMatcher(NameOrder({"P1", "P2", "I1", "I2"})), st, udq_state);
+
+    st.update("FOPR", 20);
+    for (const auto& [well, wopr, wwpr] : {std::make_tuple("P1", 1.0, 5.0),
+                                           std::make_tuple("P2", 2.0, 6.0),
+                                           std::make_tuple("I1", 3.0, 7.0),
+                                           std::make_tuple("I2", 4.0, 8.0)}) {
+        st.update_well_var(well, "WOPR", wopr);
+        st.update_well_var(well, "WWPR", wwpr);
+    }
+
+    const UDQASTNode wopr(UDQTokenType::ecl_expr, std::string("WOPR"), std::vector<std::string>{});
+    const UDQASTNode wwpr_p(UDQTokenType::ecl_expr, std::string("WWPR"), std::vector<std::string>{"P*"});
+    const UDQASTNode wopr_p1(UDQTokenType::ecl_expr, std::string("WOPR"), std::vector<std::string>{"P1"});
+    const UDQASTNode fopr(UDQTokenType::ecl_expr, std::string("FOPR"), std::vector<std::string>{});
+
+    // -WOPR + 2 * WWPR 'P*'
+    const UDQASTNode well_expr(UDQTokenType::binary_op_add, std::string("+"), -1.0 * wopr,
+                               UDQASTNode(UDQTokenType::binary_op_mul, std::string("*"), UDQASTNode(2.0), wwpr_p));
+
+    // SUM(ABS(-WOPR + 2 * WWPR 'P*')) / FOPR
+    const UDQASTNode scalar_expr(UDQTokenType::binary_op_div, std::string("/"),
+                                 UDQASTNode(UDQTokenType::scalar_func_sum, std::string("SUM"),
+                                            UDQASTNode(UDQTokenType::elemental_func_abs, std::string("ABS"), well_expr)),
+                                 fopr);
+
+    // WOPR 'P1' * WOPR
+    const UDQASTNode named_expr(UDQTokenType::binary_op_mul, std::string("*"), wopr_p1, wopr);
+
+    {
+        const UDQProgram program(well_expr);
+        BOOST_CHECK_EQUAL(program.size(), 5U);
+        BOOST_CHECK_EQUAL(program.stack_depth(), 3U);
+
+        const auto res = program.eval(UDQVarType::WELL_VAR, context);
+        BOOST_CHECK(res == well_expr.eval(UDQVarType::WELL_VAR, context));
+        BOOST_CHECK_EQUAL(res["P1"].get(), 9.0);
+        BOOST_CHECK_EQUAL(res["P2"].get(), 10.0);
+        BOOST_CHECK(!res["I1"].defined());
+    }
+
+    {
+        const UDQProgram program(scalar_expr);
+        const auto res = program.eval(UDQVarType::SCALAR, context);
+        BOOST_CHECK(res == scalar_expr.eval(UDQVarType::SCALAR, context));
+        BOOST_CHECK_EQUAL(res[0].get(), 19.0 / 20);
+    }
+
+    {
+        const UDQProgram program(named_expr);
+        const auto res = program.eval(UDQVarType::WELL_VAR, context);
+        BOOST_CHECK(res == named_expr.eval(UDQVarType::WELL_VAR, context));
+        BOOST_CHECK_EQUAL(res["I2"].get(), 4.0);
+    }
+
+    {
+        // WOPR / (WOPR - 1) - FOPR; undefined for P1 where the division is by zero.
+        const UDQASTNode div_expr(UDQTokenType::binary_op_sub, std::string("-"),
+                                  UDQASTNode(UDQTokenType::binary_op_div, std::string("/"), wopr,
+                                             UDQASTNode(UDQTokenType::binary_op_sub, std::string("-"), wopr, UDQASTNode(1.0))),
+                                  fopr);
+
+        // Evaluate repeatedly through one workspace, so that later
+        // evaluations run on recycled scratch sets.
+        UDQWorkspace workspace(context);
+        for (std::size_t iter = 0; iter < 3; iter++) {
+            const auto well_res = UDQProgram(well_expr).eval(UDQVarType::WELL_VAR, workspace);
+            BOOST_CHECK(well_res == well_expr.eval(UDQVarType::WELL_VAR, context));
+
+            const auto div_res = UDQProgram(div_expr).eval(UDQVarType::WELL_VAR, workspace);
+            BOOST_CHECK(div_res == div_expr.eval(UDQVarType::WELL_VAR, context));
+            BOOST_CHECK(!div_res["P1"].defined());
+            BOOST_CHECK_EQUAL(div_res["I2"].get(), 4.0 / 3 - 20);
+
+            const auto scalar_res = UDQProgram(scalar_expr).eval(UDQVarType::SCALAR, workspace);
+            BOOST_CHECK(scalar_res == scalar_expr.eval(UDQVarType::SCALAR, context));
+
+            workspace.recycle(UDQSet(well_res));
+            workspace.recycle(UDQSet(div_res));
+        }
+    }
+
+    {
+        // The summary handles are registered by the first evaluation and
+        // reused by the later ones.
+        const UDQProgram program(scalar_expr);
+        program.eval(UDQVarType::SCALAR, context);
+        const auto num_handles = st.num_handles();
+
+        st.update_well_var("P1", "WWPR", 15.0);
+        const auto res = program.eval(UDQVarType::SCALAR, context);
+        BOOST_CHECK_EQUAL(st.num_handles(), num_handles);
+        BOOST_CHECK(res == scalar_expr.eval(UDQVarType::SCALAR, context));
+        BOOST_CHECK_EQUAL(res[0].get(), 39.0 / 20);
+    }
+
+    BOOST_CHECK_THROW(UDQProgram().eval(UDQVarType::WELL_VAR, context), std::logic_error);
+}
+
 BOOST_AUTO_TEST_CASE(UDQWellSetNANTest) {
     std::vector<std::string> wells = {"P1", "P2", "I1", "I2"};
     UDQSet ws = UDQSet::wells("NAME", wells);
@@ -305,6 +412,40 @@ BOOST_AUTO_TEST_CASE(UDQWellSetTest) {
     BOOST_CHECK_EQUAL(empty.size() , 0U);
 }
 
+BOOST_AUTO_TEST_CASE(UDQ_SET_NAME_INDEX) {
+    const std::vector<std::string> wells = {"P1", "P2", "I1", "I2"};
+    const auto index = UDQSet::make_index(wells);
+    BOOST_CHECK_EQUAL(index->size(), 4U);
+
+    UDQSet ws1 = UDQSet::wells("WU1", wells, index);
+    UDQSet ws2 = UDQSet::wells("WU2", wells, index);
+    BOOST_CHECK_EQUAL(ws1.index("I1").value(), 2U);
+    BOOST_CHECK(!ws1.index("NO_SUCH_WELL").has_value());
+    BOOST_CHECK(ws2.has("P2"));
+    BOOST_CHECK(!ws2.has("P*"));
+
+    ws1.assign("P2", 2.0);
+    BOOST_CHECK_EQUAL(ws1["P2"].get(), 2.0);
+    BOOST_CHECK(!ws1["P1"].defined());
+
+    ws2.assign_matching("I*", 3.0);
+    BOOST_CHECK_EQUAL(ws2["I1"].get(), 3.0);
+    BOOST_CHECK_EQUAL(ws2["I2"].get(), 3.0);
+    BOOST_CHECK(!ws2["P1"].defined());
+    BOOST_REQUIRE_THROW(ws2.assign_matching("X*", 1.0), std::out_of_range);
+
+    const auto sum = ws1 + ws2;
+    BOOST_CHECK_EQUAL(sum.index("I2").value(), 3U);
+
+    BOOST_REQUIRE_THROW(UDQSet::wells("WU3", {"P1"}, index), std::logic_error);
+
+#ifndef NDEBUG
+    // Same size, but the index was built for a different name list.
+    BOOST_REQUIRE_THROW(UDQSet::wells("WU4", {"P1", "P2", "I3", "I2"}, index), std::logic_error);
+    BOOST_REQUIRE_THROW(UDQSet::wells("WU5", {"P2", "P1", "I1", "I2"}, index), std::logic_error);
+#endif
+}
+
 
 BOOST_AUTO_TEST_CASE(UDQ_GROUP_TEST) {
     std::vector<std::string> groups = {"G1", "G2", "G3", "G4"};
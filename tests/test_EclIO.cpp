@@ -21,14 +21,18 @@
 #include <stdio.h>
 
 #include <algorithm>
+#include <cstring>
+#include <filesystem>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
 #include <limits>
 #include <tuple>
+#include <type_traits>
 #include <cmath>
 #include <numeric>
 
+#include <opm/io/eclipse/EclCompression.hpp>
 #include <opm/io/eclipse/EclFile.hpp>
 #include <opm/io/eclipse/EclUtil.hpp>
 #include "WorkArea.hpp"
@@ -358,6 +362,308 @@ BOOST_AUTO_TEST_CASE(TestEcl_Write_formatted_not_finite) {
 }
 
 
+BOOST_AUTO_TEST_CASE(TestEcl_Write_chunked) {
+    // Arrays spanning several record blocks, written in one go and in
+    // chunks not aligned with the record blocks, must give identical files.
+    std::vector<int> ints(2503);
+    std::vector<float> floats(1234);
+    std::vector<double> doubles(2001);
+
+    std::iota(ints.begin(), ints.end(), -100);
+    for (std::size_t i = 0; i < floats.size(); i++)
+        floats[i] = 0.25f * i - 17.0f;
+
+    for (std::size_t i = 0; i < doubles.size(); i++)
+        doubles[i] = 1.0e-3 * i * i;
+
+    WorkArea work;
+    for (bool formatted : {false, true}) {
+        {
+            EclOutput reference("REFERENCE.DAT", formatted);
+            reference.write("INTS", ints);
+            reference.write("FLOATS", floats);
+            reference.write("EMPTY", std::vector<float>{});
+            reference.write("DOUBLES", doubles);
+        }
+
+        {
+            EclOutput chunked("CHUNKED.DAT", formatted);
+
+            chunked.beginArray<int>("INTS", ints.size());
+            for (std::size_t offset = 0; offset < ints.size(); offset += 7)
+                chunked.appendChunk(ints.data() + offset, std::min<std::size_t>(7, ints.size() - offset));
+            chunked.endArray();
+
+            chunked.beginArray<float>("FLOATS", floats.size());
+            chunked.appendChunk(floats.data(), 1000);
+            chunked.appendChunk(floats.data() + 1000, floats.size() - 1000);
+            chunked.endArray();
+
+            chunked.beginArray<float>("EMPTY", 0);
+            chunked.endArray();
+
+            chunked.writeGenerated<double>("DOUBLES", doubles.size(),
+                                           [&doubles](std::size_t i) { return doubles[i]; }, 333);
+        }
+
+        BOOST_CHECK_MESSAGE(compare_files("REFERENCE.DAT", "CHUNKED.DAT"),
+                            "Chunked output differs, formatted = " << formatted);
+    }
+
+    EclOutput output("ERROR.DAT", false);
+    BOOST_CHECK_THROW(output.endArray(), std::logic_error);
+    BOOST_CHECK_THROW(output.appendChunk(ints), std::logic_error);
+
+    output.beginArray<int>("INTS", 10);
+    BOOST_CHECK_THROW(output.beginArray<int>("OTHER", 10), std::logic_error);
+    BOOST_CHECK_THROW(output.appendChunk(floats), std::logic_error);
+    BOOST_CHECK_THROW(output.appendChunk(ints), std::logic_error);
+    output.appendChunk(ints.data(), 5);
+    BOOST_CHECK_THROW(output.endArray(), std::logic_error);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(TestEclFile_getSubset) {
+    // Reading a subset of the elements must give the same values as picking
+    // them from the full array, also when the subset spans several record
+    // blocks and the array is not loaded.
+    std::vector<int> ints(2503);
+    std::vector<float> floats(1234);
+    std::vector<double> doubles(2001);
+
+    std::iota(ints.begin(), ints.end(), -100);
+    for (std::size_t i = 0; i < floats.size(); i++)
+        floats[i] = 0.25f * i - 17.0f;
+
+    for (std::size_t i = 0; i < doubles.size(); i++)
+        doubles[i] = 1.0e-3 * i * i;
+
+    const std::vector<std::size_t> indices = {0, 1, 17, 999, 1000, 1001, 1233};
+    const auto pick = [&indices](const auto& values) {
+        std::decay_t<decltype(values)> subset;
+        for (auto index : indices)
+            subset.push_back(values[index]);
+        return subset;
+    };
+
+    WorkArea work;
+    for (bool formatted : {false, true}) {
+        {
+            EclOutput output("SUBSET.DAT", formatted);
+            output.write("INTS", ints);
+            output.write("FLOATS", floats);
+            output.write("DOUBLES", doubles);
+        }
+
+        EclFile file("SUBSET.DAT", EclFile::Formatted{formatted});
+        const auto int_subset = file.getSubset<int>(0, indices);
+        const auto float_subset = file.getSubset<float>(1, indices);
+        const auto double_subset = file.getSubset<double>(2, indices);
+
+        // Formatted output does not round-trip all digits, so compare with
+        // the values of the fully loaded arrays.
+        EclFile full("SUBSET.DAT", EclFile::Formatted{formatted}, true);
+
+        BOOST_CHECK(int_subset == pick(ints));
+        BOOST_CHECK(float_subset == pick(full.get<float>(1)));
+        BOOST_CHECK(double_subset == pick(full.get<double>(2)));
+        BOOST_CHECK(file.getSubset<double>(2, {}).empty());
+
+        BOOST_CHECK_THROW(file.getSubset<float>(0, indices), std::runtime_error);
+        BOOST_CHECK_THROW(file.getSubset<int>(0, {5, 3}), std::invalid_argument);
+        BOOST_CHECK_THROW(file.getSubset<float>(1, {1234}), std::invalid_argument);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(TestEclFile_getRange) {
+    // Ranges spanning several record blocks, read without loading the
+    // arrays, must give the same values as the loaded arrays.
+    std::vector<int> ints(2503);
+    std::vector<double> doubles(2001);
+
+    std::iota(ints.begin(), ints.end(), -100);
+    for (std::size_t i = 0; i < doubles.size(); i++)
+        doubles[i] = 1.0e-3 * i * i;
+
+    WorkArea work;
+    for (bool formatted : {false, true}) {
+        {
+            EclOutput output("RANGE.DAT", formatted);
+            output.write("INTS", ints);
+            output.write("DOUBLES", doubles);
+        }
+
+        EclFile file("RANGE.DAT", EclFile::Formatted{formatted});
+        EclFile full("RANGE.DAT", EclFile::Formatted{formatted}, true);
+
+        const auto& all_ints = full.get<int>(0);
+        const auto& all_doubles = full.get<double>(1);
+
+        const std::vector<std::pair<std::size_t, std::size_t>> ranges = {
+            {0, 1}, {0, 1000}, {999, 2}, {17, 1500}, {1000, 1001}, {1990, 11}, {5, 0}
+        };
+
+        for (const auto& [first, count] : ranges) {
+            const auto int_range = file.getRange<int>("INTS", first, count);
+            const auto double_range = file.getRange<double>(1, first, count);
+
+            BOOST_CHECK(int_range == std::vector<int>(all_ints.begin() + first,
+                                                      all_ints.begin() + first + count));
+            BOOST_CHECK(double_range == std::vector<double>(all_doubles.begin() + first,
+                                                            all_doubles.begin() + first + count));
+        }
+
+        BOOST_CHECK_THROW(file.getRange<float>(0, 0, 10), std::runtime_error);
+        BOOST_CHECK_THROW(file.getRange<int>(0, 2500, 4), std::invalid_argument);
+        BOOST_CHECK_THROW(file.getRange<int>("NOSUCH", 0, 1), std::invalid_argument);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(TestEclCompression_Codec) {
+    std::vector<char> random(3 * Compression::chunkSize / 2);
+    std::vector<char> repeated(100000);
+    std::vector<char> doubles(8 * 50000);
+
+    unsigned int state = 12345;
+    for (auto& c : random) {
+        state = state * 1103515245u + 12345u;
+        c = static_cast<char>(state >> 16);
+    }
+
+    for (std::size_t i = 0; i < repeated.size(); i++)
+        repeated[i] = "ABCDEFGH"[i % 5];
+
+    for (std::size_t i = 0; i < doubles.size() / 8; i++) {
+        const double value = 250.0 + 1.0e-3 * i;
+        std::memcpy(doubles.data() + 8 * i, &value, sizeof(value));
+    }
+
+    for (const auto& [data, stride] : { std::pair{random, 1}, std::pair{repeated, 1},
+                                        std::pair{repeated, 4}, std::pair{doubles, 8},
+                                        std::pair{std::vector<char>(7, 'x'), 4} }) {
+        const auto compressed = Compression::compress(data.data(), data.size(), stride);
+
+        std::vector<char> raw(data.size());
+        Compression::decompress(compressed.data(), compressed.size(), raw.data(), raw.size(), stride);
+        BOOST_CHECK(raw == data);
+    }
+
+    const auto compressed = Compression::compress(repeated.data(), repeated.size(), 1);
+    BOOST_CHECK(compressed.size() < repeated.size() / 10);
+
+    std::vector<char> raw(repeated.size() + 1);
+    BOOST_CHECK_THROW(Compression::decompress(compressed.data(), compressed.size(), raw.data(), raw.size(), 1),
+                      std::runtime_error);
+    BOOST_CHECK_THROW(Compression::decompress(compressed.data(), compressed.size() / 2, raw.data(), repeated.size(), 1),
+                      std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(TestEclFile_Compressed) {
+    std::vector<int> ints(300000);
+    std::vector<float> floats(1001);
+    std::vector<double> doubles(200000);
+    std::vector<bool> bools(1500);
+    std::vector<std::string> strings = {"A", "BB", "CCCCCCCC", "", "DD"};
+    std::vector<std::string> long_strings = {"LONG STRING NUMBER 1", "2", "LONG STRING 3"};
+
+    std::iota(ints.begin(), ints.end(), -1000);
+    for (std::size_t i = 0; i < floats.size(); i++)
+        floats[i] = 0.5f * i;
+    for (std::size_t i = 0; i < doubles.size(); i++)
+        doubles[i] = 1.0e5 + std::sin(1.0e-3 * i);
+    for (std::size_t i = 0; i < bools.size(); i++)
+        bools[i] = (i % 3) == 0;
+
+    WorkArea work;
+    {
+        EclOutput output("PLAIN.INIT", false);
+        EclOutput compressed("COMPRESSED.INIT", false, std::ios::out, true);
+
+        for (auto* out : { &output, &compressed }) {
+            out->write("INTS", ints);
+            out->write("EMPTY", std::vector<int>{});
+            out->message("MESSAGE");
+            out->write("FLOATS", floats);
+            out->write("DOUBLES", doubles);
+            out->write("BOOLS", bools);
+            out->write("STRINGS", strings);
+            out->write("C0NN", long_strings, 24);
+            out->writeGenerated<double>("GEN", 150000, [](int64_t i) { return 2.0 * i; });
+        }
+    }
+
+    BOOST_CHECK_THROW(EclOutput("FORMATTED.FINIT", true, std::ios::out, true), std::invalid_argument);
+
+    EclFile plain("PLAIN.INIT");
+    EclFile file("COMPRESSED.INIT");
+
+    BOOST_CHECK(!plain.formattedInput());
+    BOOST_CHECK(!plain.compressedInput());
+    BOOST_CHECK(file.compressedInput());
+    BOOST_CHECK(std::filesystem::file_size("COMPRESSED.INIT") < std::filesystem::file_size("PLAIN.INIT") / 2);
+
+    const auto list = file.getList();
+    const auto plainList = plain.getList();
+    BOOST_CHECK(list == plainList);
+
+    BOOST_CHECK(file.get<int>("INTS") == ints);
+    BOOST_CHECK(file.get<int>("EMPTY").empty());
+    BOOST_CHECK(file.get<float>("FLOATS") == floats);
+    BOOST_CHECK(file.get<double>("DOUBLES") == doubles);
+    BOOST_CHECK(file.get<bool>("BOOLS") == bools);
+    BOOST_CHECK(file.get<std::string>("STRINGS") == plain.get<std::string>("STRINGS"));
+    BOOST_CHECK(file.get<std::string>("C0NN") == long_strings);
+    BOOST_CHECK(file.get<double>("GEN") == plain.get<double>("GEN"));
+    BOOST_CHECK_EQUAL(file.is_ix(), plain.is_ix());
+
+    EclFile ranges("COMPRESSED.INIT");
+    BOOST_CHECK(ranges.getRange<int>("INTS", 1000, 2000) ==
+                std::vector<int>(ints.begin() + 1000, ints.begin() + 3000));
+    BOOST_CHECK(ranges.getSubset<double>(4, {0, 99999, 199999}) ==
+                std::vector<double>({doubles[0], doubles[99999], doubles[199999]}));
+
+    // Decompressing gives the original file.
+    {
+        EclOutput output("DECOMPRESSED.INIT", false);
+        file.loadData();
+
+        for (std::size_t i = 0; i < list.size(); i++) {
+            const auto& [name, arrType, size] = list[i];
+
+            if (arrType == INTE)
+                output.write(name, file.get<int>(i));
+            else if (arrType == REAL)
+                output.write(name, file.get<float>(i));
+            else if (arrType == DOUB)
+                output.write(name, file.get<double>(i));
+            else if (arrType == LOGI)
+                output.write(name, file.get<bool>(i));
+            else if (arrType == CHAR)
+                output.write(name, file.get<std::string>(i));
+            else if (arrType == C0NN)
+                output.write(name, file.get<std::string>(i), file.getElementSizeList()[i]);
+            else
+                output.message(name);
+        }
+    }
+
+    BOOST_CHECK(compare_files("PLAIN.INIT", "DECOMPRESSED.INIT"));
+
+    // Arrays appended to an existing compressed file.
+    {
+        EclOutput output("COMPRESSED.INIT", false, std::ios::app, true);
+        output.write("APPENDED", doubles);
+        output.write("LAST", std::vector<int>{1, 2, 3});
+    }
+
+    EclFile appended("COMPRESSED.INIT");
+    BOOST_CHECK_EQUAL(appended.size(), list.size() + 2);
+    BOOST_CHECK(appended.get<int>("INTS") == ints);
+    BOOST_CHECK(appended.get<double>("APPENDED") == doubles);
+    BOOST_CHECK(appended.get<int>("LAST") == std::vector<int>({1, 2, 3}));
+}
+
 BOOST_AUTO_TEST_CASE(TestEcl_getList) {
 
     std::string inputFile="ECLFILE.INIT";
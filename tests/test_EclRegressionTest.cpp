@@ -558,6 +558,11 @@ BOOST_AUTO_TEST_CASE(results_init_2) {
     ECLRegressionTest test2("TMP1", "TMP2", 1e-3, 1e-3);
     test2.results_init();
 
+    // block-wise comparison, block size not dividing array size
+    ECLRegressionTest test2s("TMP1", "TMP2", 1e-3, 1e-3);
+    test2s.setStreamingComparison(5, 100);
+    test2s.results_init();
+
     porv2=porv1;
     porv2[2]=999.998;    // relativ deviation 2e-6 > tolerances, abs deviaton 2e-3 > tolerances
 
@@ -579,6 +584,14 @@ BOOST_AUTO_TEST_CASE(results_init_2) {
     // should be one keyword with failure
     BOOST_CHECK_EQUAL(test2a.countDev(),1);
 
+    ECLRegressionTest test2b("TMP1", "TMP2", 1e-3, 1e-3);
+    test2b.setStreamingComparison(5, 100);
+    BOOST_CHECK_THROW(test2b.results_init(),std::runtime_error);
+
+    test2b.doAnalysis(true);
+    test2b.results_init();
+    BOOST_CHECK_EQUAL(test2b.countDev(),1);
+
     // ---------------------------------------------------------------------------
     // compare specific keyword, should be ok sinze PORV not checked in this case
 
@@ -613,6 +626,9 @@ BOOST_AUTO_TEST_CASE(results_init_2) {
     ECLRegressionTest test3("TMP1", "TMP2", 1e-3, 1e-3);
 
     BOOST_CHECK_THROW(test3.results_init(),std::runtime_error);
+
+    test3.setStreamingComparison(5, 100);
+    BOOST_CHECK_THROW(test3.results_init(),std::runtime_error);
 }
 
 BOOST_AUTO_TEST_CASE(results_unrst_1) {
@@ -939,6 +955,15 @@ BOOST_AUTO_TEST_CASE(results_unrst_3) {
     // should get deviations for two keywords
     BOOST_CHECK_EQUAL(test2.countDev(),2);
 
+    // same result when comparing arrays block by block
+    ECLRegressionTest test3("TMP1", "TMP2", 1e-3, 1e-3);
+    test3.setStreamingComparison(4, 100);
+    BOOST_CHECK_THROW(test3.results_rst(),std::runtime_error);
+
+    test3.doAnalysis(true);
+    test3.results_rst();
+    BOOST_CHECK_EQUAL(test3.countDev(),2);
+
 }
 
 
@@ -295,6 +295,11 @@ BOOST_AUTO_TEST_CASE(EclipseIOIntegration) {
 
         EclipseIO eclWriter( es, eclGrid , schedule, summary_config);
 
+        std::vector<ResultsBus::Snapshot> snapshots;
+        eclWriter.resultsBus().subscribe([&snapshots](const ResultsBus::Snapshot& snapshot)
+                                         { snapshots.push_back(snapshot); },
+                                         { "PRESSURE" });
+
         using measure = UnitSystem::measure;
         using TargetType = data::TargetType;
         auto start_time = ecl_util_make_date( 10, 10, 2008 );
@@ -344,6 +349,16 @@ BOOST_AUTO_TEST_CASE(EclipseIOIntegration) {
             checkRestartFile( i );
         }
 
+        BOOST_REQUIRE_EQUAL( snapshots.size(), static_cast<std::size_t>( last - first ) );
+        for( std::size_t n = 0; n < snapshots.size(); ++n ) {
+            const auto& snapshot = *snapshots[n];
+            BOOST_CHECK_EQUAL( snapshot.reportStep, first + static_cast<int>( n ) );
+            BOOST_CHECK_EQUAL( snapshot.solution.size(), 1U );
+            BOOST_CHECK_CLOSE( snapshot.solution.data("PRESSURE")[26],
+                               (first + n)*1e5 + 1e4 + 26, 1.0e-10 );
+        }
+        BOOST_CHECK( eclWriter.resultsBus().latest() == snapshots.back() );
+
         checkInitFile( deck , eGridProps);
         checkEgridFile( eclGrid );
 
@@ -24,6 +24,7 @@
 #include <opm/io/eclipse/OutputStream.hpp>
 
 #include <opm/io/eclipse/EclFile.hpp>
+#include <opm/io/eclipse/EclFileIndex.hpp>
 #include <opm/io/eclipse/EclOutput.hpp>
 #include <opm/io/eclipse/ERst.hpp>
 #include <opm/io/eclipse/PaddedOutputString.hpp>
@@ -34,6 +35,7 @@
 #include <algorithm>
 #include <chrono>
 #include <ctime>
+#include <filesystem>
 #include <iterator>
 #include <ostream>
 #include <string>
@@ -811,6 +813,162 @@ BOOST_AUTO_TEST_CASE(Unformatted_Unified)
     }
 }
 
+BOOST_AUTO_TEST_CASE(Unformatted_Unified_Index)
+{
+    const auto rset = RSet("CASE");
+    const auto fmt  = ::Opm::EclIO::OutputStream::Formatted{ false };
+    const auto unif = ::Opm::EclIO::OutputStream::Unified  { true };
+
+    const auto fname = ::Opm::EclIO::OutputStream::
+        outputFileName(rset, "UNRST");
+
+    const auto idx = ::Opm::EclIO::EclFileIndex::fileName(fname);
+
+    auto writeStep = [&rset, &fmt, &unif](const int seqnum)
+    {
+        auto rst = ::Opm::EclIO::OutputStream::Restart {
+            rset, seqnum, fmt, unif
+        };
+
+        rst.write("I", std::vector<int>   (seqnum, seqnum));
+        rst.message("STARTSOL");
+        rst.write("D", std::vector<double>(2 * seqnum, 0.5 * seqnum));
+        rst.message("ENDSOL");
+    };
+
+    // Compare array directory and contents of report steps when the file
+    // is opened through its index and by scanning it.
+    auto checkIndexed = [&fname, &idx](const std::vector<int>& expect_seqnum)
+    {
+        BOOST_REQUIRE(std::filesystem::exists(idx));
+        BOOST_REQUIRE(::Opm::EclIO::EclFileIndex::load(fname).has_value());
+
+        auto indexed = ::Opm::EclIO::ERst{fname};
+        const auto indexedList = indexed.getList();
+
+        std::filesystem::copy_file(idx, idx + ".save");
+        std::filesystem::remove(idx);
+
+        auto scanned = ::Opm::EclIO::ERst{fname};
+        const auto scannedList = scanned.getList();
+
+        std::filesystem::rename(idx + ".save", idx);
+
+        BOOST_CHECK_EQUAL_COLLECTIONS(indexedList.begin(), indexedList.end(),
+                                      scannedList.begin(), scannedList.end());
+
+        const auto seqnum = indexed.listOfReportStepNumbers();
+        BOOST_CHECK_EQUAL_COLLECTIONS(seqnum.begin(), seqnum.end(),
+                                      expect_seqnum.begin(), expect_seqnum.end());
+
+        for (const auto step : expect_seqnum) {
+            const auto& I = indexed.getRestartData<int>("I", step, 0);
+            const auto& D = indexed.getRestartData<double>("D", step, 0);
+
+            BOOST_CHECK(I == scanned.getRestartData<int>("I", step, 0));
+            BOOST_CHECK(D == scanned.getRestartData<double>("D", step, 0));
+            BOOST_CHECK_EQUAL(I.size(), static_cast<std::size_t>(step));
+        }
+    };
+
+    writeStep(1);
+    writeStep(2);
+    writeStep(3);
+    checkIndexed({1, 2, 3});
+
+    // Restart from step 2 drops the index entries of steps 2 and 3.
+    writeStep(2);
+    checkIndexed({1, 2});
+
+    writeStep(5);
+    checkIndexed({1, 2, 5});
+
+    // Index no longer describes the file after another writer appended
+    // to it.  ERst must fall back to scanning the file.
+    {
+        auto out = ::Opm::EclIO::EclOutput{fname, false, std::ios_base::app};
+        out.write("SEQNUM", std::vector<int>{ 7 });
+        out.write("I", std::vector<int>(7, 7));
+        out.write("D", std::vector<double>(14, 3.5));
+    }
+
+    BOOST_CHECK(! ::Opm::EclIO::EclFileIndex::load(fname).has_value());
+
+    {
+        auto rst = ::Opm::EclIO::ERst{fname};
+
+        const auto seqnum = rst.listOfReportStepNumbers();
+        const auto expect_seqnum = std::vector<int>{1, 2, 5, 7};
+
+        BOOST_CHECK_EQUAL_COLLECTIONS(seqnum.begin(), seqnum.end(),
+                                      expect_seqnum.begin(), expect_seqnum.end());
+    }
+
+    // Next restart output rebuilds the index from the file contents.
+    writeStep(8);
+    checkIndexed({1, 2, 5, 7, 8});
+}
+
+BOOST_AUTO_TEST_CASE(Unformatted_Unified_Compressed)
+{
+    const auto rset = RSet("CASE");
+    const auto fmt  = ::Opm::EclIO::OutputStream::Formatted { false };
+    const auto unif = ::Opm::EclIO::OutputStream::Unified   { true };
+    const auto comp = ::Opm::EclIO::OutputStream::Compressed{ true };
+
+    const auto fname = ::Opm::EclIO::OutputStream::
+        outputFileName(rset, "UNRST");
+
+    auto writeStep = [&rset, &fmt, &unif, &comp](const int seqnum)
+    {
+        auto rst = ::Opm::EclIO::OutputStream::Restart {
+            rset, seqnum, fmt, unif, comp
+        };
+
+        rst.write("I", std::vector<int>   (1000 * seqnum, seqnum));
+        rst.message("STARTSOL");
+        rst.write("D", std::vector<double>(2000 * seqnum, 0.5 * seqnum));
+        rst.message("ENDSOL");
+    };
+
+    auto checkSteps = [&fname](const std::vector<int>& expect_seqnum)
+    {
+        auto rst = ::Opm::EclIO::ERst{fname};
+        BOOST_CHECK(rst.compressedInput());
+
+        const auto seqnum = rst.listOfReportStepNumbers();
+        BOOST_CHECK_EQUAL_COLLECTIONS(seqnum.begin(), seqnum.end(),
+                                      expect_seqnum.begin(), expect_seqnum.end());
+
+        for (const auto step : expect_seqnum) {
+            BOOST_CHECK(rst.getRestartData<int>("I", step, 0) ==
+                        std::vector<int>(1000 * step, step));
+            BOOST_CHECK(rst.getRestartData<double>("D", step, 0) ==
+                        std::vector<double>(2000 * step, 0.5 * step));
+        }
+    };
+
+    writeStep(1);
+    writeStep(2);
+    writeStep(3);
+    checkSteps({1, 2, 3});
+
+    writeStep(2);
+    checkSteps({1, 2});
+
+    // Without the sidecar index the file is scanned.
+    ::Opm::EclIO::EclFileIndex::remove(fname);
+    checkSteps({1, 2});
+
+    writeStep(4);
+    checkSteps({1, 2, 4});
+
+    // Existing file must not get arrays in a different format.
+    BOOST_CHECK_THROW(::Opm::EclIO::OutputStream::Restart(rset, 5, fmt, unif),
+                      std::invalid_argument);
+    checkSteps({1, 2, 4});
+}
+
 BOOST_AUTO_TEST_CASE(Formatted_Separate)
 {
     const auto rset = RSet("CASE.T01.");
@@ -50,10 +50,13 @@
 #include <opm/input/eclipse/Units/Units.hpp>
 #include <opm/input/eclipse/Units/UnitSystem.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <ctime>
+#include <fstream>
 #include <map>
 #include <iomanip>
+#include <iterator>
 #include <ostream>
 #include <string>
 #include <tuple>
@@ -2457,4 +2460,56 @@ BOOST_AUTO_TEST_CASE(PVT_M_Units)
     }
 }
 
+BOOST_AUTO_TEST_CASE(Reuse_Gather_Plans)
+{
+    const auto rsetNew = RSet { "TESTRFT" };
+    const auto rsetReuse = RSet { "TESTRFT" };
+    const auto model = Setup{ "testrft.DATA" };
+    const auto& grid = model.es.getInputGrid();
+
+    auto plans = ::Opm::RftIO::GatherPlans{};
+
+    for (const auto reportStep : { 2, 3 }) {
+        const auto elapsed = model.sched.seconds(reportStep);
+
+        auto xw = wellSol(grid);
+        if (reportStep == 3) {
+            // Results in different order than at previous step.
+            auto& xcon = xw["OP_1"].connections;
+            std::reverse(xcon.begin(), xcon.end());
+        }
+
+        for (const auto* rset : { &rsetNew, &rsetReuse }) {
+            auto rftFile = ::Opm::EclIO::OutputStream::RFT {
+                *rset, ::Opm::EclIO::OutputStream::Formatted  { false },
+                ::Opm::EclIO::OutputStream::RFT::OpenExisting{ reportStep > 2 }
+            };
+
+            if (rset == &rsetNew) {
+                ::Opm::RftIO::write(reportStep, elapsed, model.es.getUnits(),
+                                    grid, model.sched, xw, rftFile);
+            }
+            else {
+                ::Opm::RftIO::write(reportStep, elapsed, model.es.getUnits(),
+                                    grid, model.sched, xw, plans, rftFile);
+            }
+        }
+
+        BOOST_CHECK_EQUAL(plans.numWells(), std::size_t{2});
+    }
+
+    auto contents = [](const RSet& rset)
+    {
+        std::ifstream is(::Opm::EclIO::OutputStream::outputFileName(rset, "RFT"),
+                         std::ios::binary);
+
+        return std::string { std::istreambuf_iterator<char>{is},
+                             std::istreambuf_iterator<char>{} };
+    };
+
+    const auto expect = contents(rsetNew);
+    BOOST_CHECK(! expect.empty());
+    BOOST_CHECK(contents(rsetReuse) == expect);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // Using_Direct_Write
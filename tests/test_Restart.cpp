@@ -26,6 +26,7 @@
 #include <opm/output/eclipse/EclipseIO.hpp>
 #include <opm/output/eclipse/RestartIO.hpp>
 #include <opm/output/eclipse/RestartValue.hpp>
+#include <opm/output/eclipse/WriteRestartHelpers.hpp>
 #include <opm/output/data/Cells.hpp>
 #include <opm/output/data/Wells.hpp>
 #include <opm/output/data/Groups.hpp>
@@ -51,9 +52,17 @@
 #include <opm/io/eclipse/EclIOdata.hpp>
 #include <opm/io/eclipse/ERst.hpp>
 
+#include <fstream>
+#include <iterator>
 #include <sstream>
 #include <tuple>
 
+#include <fmt/format.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #include <opm/common/utility/TimeService.hpp>
 
 #include <tests/WorkArea.hpp>
@@ -539,6 +548,19 @@ BOOST_AUTO_TEST_CASE(ECL_FORMATTED) {
 
                 BOOST_CHECK_MESSAGE(rst.hasKey("SWAT"), "Restart file must have SWAT vector");
                 BOOST_CHECK_MESSAGE(rst.hasKey("EXTRA"), "Restart file must have EXTRA vector");
+
+                // Values are converted to output units while written;
+                // the caller's RestartValue is left in SI units.
+                const auto& units = base_setup.es.getUnits();
+                BOOST_CHECK_EQUAL(restart_value.solution.data("PRESSURE")[0], 6.0);
+                BOOST_CHECK_EQUAL(restart_value.getExtra("EXTRA")[0], 10.0);
+
+                const auto& pressure = rst.getRestartData<double>("PRESSURE", 1);
+                BOOST_CHECK_EQUAL(pressure.size(), num_cells);
+                BOOST_CHECK_EQUAL(pressure[0], units.from_si(UnitSystem::measure::pressure, 6.0));
+
+                const auto& extra = rst.getRestartData<double>("EXTRA", 1);
+                BOOST_CHECK_EQUAL(extra[0], units.from_si(UnitSystem::measure::pressure, 10.0));
             }
 
             io_config.setEclCompatibleRST( true );
@@ -571,6 +593,11 @@ BOOST_AUTO_TEST_CASE(ECL_FORMATTED) {
 
                 BOOST_CHECK_MESSAGE(rst.hasKey("SWAT"), "Restart file must have SWAT vector");
                 BOOST_CHECK_MESSAGE(!rst.hasKey("EXTRA"), "Restart file must NOT have EXTRA vector");
+
+                // ECLIPSE compatible output is single precision.
+                const auto& units = base_setup.es.getUnits();
+                const auto& pressure = rst.getRestartData<float>("PRESSURE", 1);
+                BOOST_CHECK_EQUAL(pressure[0], static_cast<float>(units.from_si(UnitSystem::measure::pressure, 6.0)));
                 BOOST_CHECK_MESSAGE(!rst.hasKey("OPM_IWEL"), "Restart file must NOT have OPM_IWEL vector");
                 BOOST_CHECK_MESSAGE(!rst.hasKey("OPM_XWEL"), "Restart file must NOT have OPM_XWEL vector");
             }
@@ -580,6 +607,204 @@ BOOST_AUTO_TEST_CASE(ECL_FORMATTED) {
 
 
 
+namespace {
+
+std::string manyWellsDeck(const int num_wells)
+{
+    std::ostringstream deck;
+
+    deck << R"(RUNSPEC
+OIL
+GAS
+WATER
+DISGAS
+VAPOIL
+UNIFOUT
+UNIFIN
+DIMENS
+ 10 10 3 /
+
+START
+1 NOV 1979 /
+
+WELLDIMS
+)" << num_wells << R"( 3 2 )" << num_wells << R"( /
+
+UDQDIMS
+ 10 10 2 2 2 2 0 2 /
+
+UDADIMS
+ 10 1* 10 /
+
+GRID
+DXV
+10*100 /
+DYV
+10*100 /
+DZV
+3*10 /
+TOPS
+100*2000 /
+PORO
+300*0.2 /
+PERMX
+300*100 /
+PERMY
+300*100 /
+PERMZ
+300*10 /
+
+SCHEDULE
+UDQ
+  DEFINE WUOPRL WOPR '*' * 1.5 /
+  ASSIGN FUX 1.0 /
+/
+
+GRUPTREE
+  'G1' 'FIELD' /
+  'G2' 'FIELD' /
+/
+
+WELSPECS
+)";
+
+    for (int w = 0; w < num_wells; ++w) {
+        deck << fmt::format("  'W{:02d}' 'G{}' {} {} 1* 'OIL' /\n",
+                            w, 1 + (w % 2), 1 + (w % 10), 1 + (w / 10));
+    }
+
+    deck << "/\nCOMPDAT\n";
+    for (int w = 0; w < num_wells; ++w) {
+        deck << fmt::format("  'W{:02d}' 2* 1 3 'OPEN' 2* 0.2 /\n", w);
+    }
+
+    deck << R"(/
+WCONPROD
+  'W*' 'OPEN' 'ORAT' 100.0 4* 50.0 /
+/
+
+ACTIONX
+  'CLOSE' 10 /
+  WWCT 'W*' > 0.8 /
+/
+WELOPEN
+  '?' 'SHUT' /
+/
+ENDACTIO
+
+DATES
+ 1 DEC 1979 /
+/
+)";
+
+    return deck.str();
+}
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(ConcurrentAggregation_IdenticalOutput)
+{
+    namespace OS = ::Opm::EclIO::OutputStream;
+
+    const auto num_wells = 72;
+    const auto deck = Parser{}.parseString(manyWellsDeck(num_wells));
+    auto es = EclipseState { deck };
+    es.getIOConfig().setEclCompatibleRST(false);
+    const auto& grid = es.getInputGrid();
+    const auto schedule = Schedule { deck, es, std::make_shared<Python>() };
+
+    const auto report_step = 1;
+    const auto sim_step = std::size_t{0};
+
+    auto sumState = SummaryState { TimeService::now() };
+    auto wells = data::Wells{};
+    for (const auto& wname : schedule.wellNames(sim_step)) {
+        const auto w = static_cast<double>(wname.back() - '0');
+
+        sumState.update_well_var(wname, "WOPR", 10.0 + w);
+        sumState.update_well_var(wname, "WWPR", 2.0 * w);
+        sumState.update_well_var(wname, "WWCT", 0.1 * w);
+        sumState.update_well_var(wname, "WOPT", 1000.0 + w);
+        sumState.update_well_var(wname, "WBHP", 200.0 - w);
+
+        auto& xw = wells[wname];
+        xw.bhp = 200.0 - w;
+        xw.rates.set(data::Rates::opt::oil, -(10.0 + w));
+        xw.rates.set(data::Rates::opt::wat, -2.0 * w);
+        xw.rates.set(data::Rates::opt::gas, -5.0 * w);
+        xw.dynamicStatus = Well::Status::OPEN;
+
+        for (const auto& conn : schedule.getWell(wname, sim_step).getConnections()) {
+            auto rc = data::Rates{};
+            rc.set(data::Rates::opt::wat, -w);
+            rc.set(data::Rates::opt::oil, -(5.0 + w));
+            rc.set(data::Rates::opt::gas, -2.5 * w);
+
+            xw.connections.push_back({ conn.global_index(), rc, 150.0 + w, 12.3, 250.0, 0.5, 0.25, 1.0, 1.5 });
+        }
+    }
+    sumState.update_group_var("G1", "GOPR", 123.0);
+    sumState.update_group_var("G2", "GOPR", 321.0);
+
+    auto udqState = UDQState { 0.0 };
+    schedule.getUDQConfig(sim_step)
+        .eval(report_step, schedule.wellMatcher(sim_step), sumState, udqState);
+
+    Action::State action_state;
+    WellTestState wtest_state;
+
+    WorkArea test_area("test_Restart_concurrent");
+    const auto outputDir = test_area.currentWorkingDirectory();
+
+    const auto save = [&](const std::string& basename)
+    {
+        auto aquiferData = std::optional<RestartIO::Helpers::AggregateAquiferData>{};
+        auto rstFile = OS::Restart {
+            OS::ResultSet{ outputDir, basename }, report_step,
+            OS::Formatted{ false }, OS::Unified{ true }
+        };
+
+        RestartIO::save(rstFile, report_step, 86400.0 * 30,
+                        RestartValue { mkSolution(grid.getNumActive()), wells, {}, {} },
+                        es, grid, schedule, action_state, wtest_state,
+                        sumState, udqState, aquiferData, true);
+
+        std::ifstream file(OS::outputFileName({ outputDir, basename }, "UNRST"),
+                           std::ios::binary);
+
+        return std::string { std::istreambuf_iterator<char>{file},
+                             std::istreambuf_iterator<char>{} };
+    };
+
+#ifdef _OPENMP
+    const auto max_threads = omp_get_max_threads();
+
+    omp_set_num_threads(1);
+    BOOST_CHECK(!RestartIO::Helpers::useConcurrentAggregation(schedule, sim_step, sumState, num_wells));
+    const auto sequential = save("SEQUENTIAL");
+
+    omp_set_num_threads(4);
+    BOOST_CHECK(RestartIO::Helpers::useConcurrentAggregation(schedule, sim_step, sumState, num_wells));
+    const auto concurrent = save("CONCURRENT");
+
+    omp_set_num_threads(max_threads);
+#else
+    const auto sequential = save("SEQUENTIAL");
+    const auto concurrent = save("CONCURRENT");
+#endif
+
+    BOOST_CHECK(! sequential.empty());
+    BOOST_CHECK_MESSAGE(sequential == concurrent,
+                        "Restart file must not depend on concurrent aggregation");
+
+    EclIO::ERst rst { OS::outputFileName({ outputDir, "CONCURRENT" }, "UNRST") };
+    BOOST_CHECK(rst.hasKey("IWEL"));
+    BOOST_CHECK(rst.hasKey("ICON"));
+    BOOST_CHECK(rst.hasKey("IACT"));
+    BOOST_CHECK(rst.hasKey("IUDQ"));
+}
+
+
 
 
 void compare_equal( const RestartValue& fst,
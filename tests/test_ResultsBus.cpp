@@ -0,0 +1,128 @@
+/*
+  Copyright (c) 2026 Equinor ASA
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#define BOOST_TEST_MODULE Results_Bus
+
+#include <boost/test/unit_test.hpp>
+
+#include <opm/output/eclipse/ResultsBus.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace {
+    Opm::ResultsBus::Snapshot makeSnapshot(const int reportStep)
+    {
+        auto snapshot = std::make_shared<Opm::ResultSnapshot>();
+        snapshot->reportStep = reportStep;
+
+        return snapshot;
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(Results_Bus)
+
+BOOST_AUTO_TEST_CASE(No_Subscribers)
+{
+    auto bus = Opm::ResultsBus{};
+
+    BOOST_CHECK(! bus.hasSubscribers());
+    BOOST_CHECK(bus.solutionKeys().empty());
+    BOOST_CHECK(bus.latest() == nullptr);
+
+    bus.publish(makeSnapshot(1));
+
+    BOOST_REQUIRE(bus.latest() != nullptr);
+    BOOST_CHECK_EQUAL(bus.latest()->reportStep, 1);
+}
+
+BOOST_AUTO_TEST_CASE(Shared_Snapshot)
+{
+    auto bus = Opm::ResultsBus{};
+
+    auto received1 = std::vector<Opm::ResultsBus::Snapshot>{};
+    auto received2 = std::vector<Opm::ResultsBus::Snapshot>{};
+
+    bus.subscribe([&received1](const Opm::ResultsBus::Snapshot& s)
+                  { received1.push_back(s); }, { "PRESSURE", "SWAT" });
+
+    bus.subscribe([&received2](const Opm::ResultsBus::Snapshot& s)
+                  { received2.push_back(s); }, { "SWAT", "SGAS" });
+
+    BOOST_CHECK(bus.hasSubscribers());
+
+    const auto expectKeys = std::set<std::string> { "PRESSURE", "SGAS", "SWAT" };
+    BOOST_CHECK(bus.solutionKeys() == expectKeys);
+
+    bus.publish(makeSnapshot(1));
+    bus.publish(makeSnapshot(2));
+
+    BOOST_REQUIRE_EQUAL(received1.size(), std::size_t{2});
+    BOOST_REQUIRE_EQUAL(received2.size(), std::size_t{2});
+
+    for (std::size_t i = 0; i < received1.size(); ++i) {
+        BOOST_CHECK_EQUAL(received1[i]->reportStep, static_cast<int>(i + 1));
+
+        // Same object delivered to both subscribers.
+        BOOST_CHECK(received1[i] == received2[i]);
+    }
+
+    BOOST_CHECK(bus.latest() == received1.back());
+}
+
+BOOST_AUTO_TEST_CASE(Unsubscribe)
+{
+    auto bus = Opm::ResultsBus{};
+
+    auto count1 = 0;
+    auto count2 = 0;
+
+    const auto id1 = bus.subscribe([&count1](const Opm::ResultsBus::Snapshot&)
+                                   { ++count1; }, { "PRESSURE" });
+
+    auto id2 = Opm::ResultsBus::SubscriptionId{};
+    id2 = bus.subscribe([&count2, &bus, &id2](const Opm::ResultsBus::Snapshot&)
+    {
+        // Unsubscribing from within the callback is allowed.
+        ++count2;
+        bus.unsubscribe(id2);
+    });
+
+    BOOST_CHECK(id1 != id2);
+
+    bus.publish(makeSnapshot(1));
+    bus.publish(makeSnapshot(2));
+
+    BOOST_CHECK_EQUAL(count1, 2);
+    BOOST_CHECK_EQUAL(count2, 1);
+
+    bus.unsubscribe(id1);
+    bus.unsubscribe(id1);
+
+    BOOST_CHECK(! bus.hasSubscribers());
+    BOOST_CHECK(bus.solutionKeys().empty());
+
+    bus.publish(makeSnapshot(3));
+    BOOST_CHECK_EQUAL(count1, 2);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Results_Bus
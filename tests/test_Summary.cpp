@@ -30,6 +30,8 @@
 #include <cctype>
 #include <ctime>
 #include <filesystem>
+#include <fstream>
+#include <sstream>
 
 #include <fmt/format.h>
 
@@ -59,6 +61,10 @@
 
 #include <tests/WorkArea.hpp>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 using namespace Opm;
 using rt = data::Rates::opt;
 using p_cmode = Opm::Group::ProductionCMode;
@@ -939,6 +945,28 @@ BOOST_AUTO_TEST_CASE(well_keywords_dynamic_close) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(well_shut_in_schedule_same_step) {
+    setup cfg( "test_summary_well_shut" );
+
+    SummaryState st(TimeService::now());
+
+    out::Summary writer( cfg.es, cfg.config, cfg.grid, cfg.schedule, cfg.name );
+    writer.eval(st, 1, 1*day, cfg.wells, cfg.grp_nwrk, {}, {}, {}, {});
+    BOOST_CHECK_CLOSE( 10.11, st.get_well_var("W_1", "WPI"), 1.0e-5 );
+
+    // Shutting the well replaces the schedule's Well object at the current
+    // report step, i.e., the step preceding report step 1.  The next
+    // evaluation of the same step must see the new object and its status.
+    cfg.schedule.shut_well("W_1", 0);
+    writer.eval(st, 1, 1*day, cfg.wells, cfg.grp_nwrk, {}, {}, {}, {});
+    BOOST_CHECK_CLOSE( 0.0, st.get_well_var("W_1", "WPI"), 1.0e-5 );
+    BOOST_CHECK_CLOSE( 20.11, st.get_well_var("W_2", "WPI"), 1.0e-5 );
+
+    cfg.schedule.open_well("W_1", 0);
+    writer.eval(st, 1, 1*day, cfg.wells, cfg.grp_nwrk, {}, {}, {}, {});
+    BOOST_CHECK_CLOSE( 10.11, st.get_well_var("W_1", "WPI"), 1.0e-5 );
+}
+
 BOOST_AUTO_TEST_CASE(udq_keywords) {
     setup cfg( "test_summary_udq" );
 
@@ -1121,6 +1149,98 @@ BOOST_AUTO_TEST_CASE(group_keywords) {
     BOOST_CHECK_EQUAL( 0, ecl_sum_get_group_var( resp, 1, "G_2", "GMWPR" ) );
 }
 
+BOOST_AUTO_TEST_CASE(group_guiderate_before_rate) {
+    // The group guide rate GOPGR is evaluated without the wells of the
+    // group, whereas GOPR needs them.  Requesting the guide rate first must
+    // not leave GOPR without wells.
+    std::string deck_string;
+    {
+        std::ifstream deck_file("summary_deck.DATA");
+        std::stringstream buffer;
+        buffer << deck_file.rdbuf();
+        deck_string = buffer.str();
+    }
+
+    const auto summary_begin = deck_string.find("\nSUMMARY\n") + 1;
+    const auto schedule_begin = deck_string.find("\nSCHEDULE\n") + 1;
+    deck_string.replace(summary_begin, schedule_begin - summary_begin,
+                        "SUMMARY\nGOPGR\n 'G_1' /\nGOPR\n 'G_1' /\nGOPT\n 'G_1' /\n\n");
+
+    const auto deck = Parser().parseString(deck_string);
+    const auto es = EclipseState { deck };
+    const auto schedule = Schedule { deck, es, std::make_shared<Python>() };
+    const auto config = SummaryConfig { deck, schedule, es.fieldProps(), es.aquifer() };
+    WorkArea ta { "summary_test" };
+
+    out::Summary writer( es, config, es.getInputGrid(), schedule, "GUIDERATE_BEFORE_RATE" );
+    SummaryState st(TimeService::now());
+    writer.eval( st, 1, 1 * day, result_wells(), result_group_nwrk(), {}, {}, {}, {});
+
+    BOOST_CHECK_CLOSE( 1111.2222, st.get_group_var("G_1", "GOPGR"), 1e-5 );
+    BOOST_CHECK_CLOSE( 10.1 + 20.1, st.get_group_var("G_1", "GOPR"), 1e-5 );
+    BOOST_CHECK_CLOSE( (10.1 + 20.1) * 1.0, st.get_group_var("G_1", "GOPT"), 1e-5 );
+}
+
+BOOST_AUTO_TEST_CASE(parallel_evaluation) {
+#ifdef _OPENMP
+    // The summary vectors are evaluated concurrently when there are at
+    // least 512 of them and more than one thread.  The result must be the
+    // same as for the sequential evaluation, including the totals and the
+    // ROEW vectors which are computed from other vectors of the same step.
+    std::string deck_string;
+    {
+        std::ifstream deck_file("summary_deck.DATA");
+        std::stringstream buffer;
+        buffer << deck_file.rdbuf();
+        deck_string = buffer.str();
+    }
+    deck_string.insert(deck_string.find("\nSCHEDULE\n") + 1, "ROEW\n 1 2 3 4 5 6 7 8 9 10 11 12 13 14 15 16 17 18 19 20 /\n\n");
+
+    const auto deck = Parser().parseString(deck_string);
+    const auto es = EclipseState { deck };
+    const auto schedule = Schedule { deck, es, std::make_shared<Python>() };
+    const auto config = SummaryConfig { deck, schedule, es.fieldProps(), es.aquifer() };
+    BOOST_REQUIRE_GE(config.size(), 512U);
+    WorkArea ta { "summary_test" };
+
+    auto initial_inplace = Inplace{};
+    for (std::size_t region = 1; region <= 20; ++region)
+        initial_inplace.add("FIPNUM", Inplace::Phase::OIL, region, 1.0e6 * region);
+
+    const auto wells = result_wells();
+    const auto grp_nwrk = result_group_nwrk();
+    const auto evaluate = [&](const int num_threads)
+    {
+        omp_set_num_threads(num_threads);
+
+        out::Summary writer( es, config, es.getInputGrid(), schedule, "PARALLEL_EVALUATION" );
+        SummaryState st(TimeService::from_time_t(0));
+        for (int step = 1; step <= 3; ++step)
+            writer.eval( st, step, step * day, wells, grp_nwrk, {}, initial_inplace, {}, {});
+
+        return st;
+    };
+
+    const auto max_threads = omp_get_max_threads();
+    const auto sequential = evaluate(1);
+    const auto parallel = evaluate(2);
+    omp_set_num_threads(max_threads);
+
+    auto roew = 0.0;
+    for (int region = 1; region <= 20; ++region)
+        roew += sequential.get(fmt::format("ROEW:{}", region));
+    BOOST_CHECK(roew > 0.0);
+    BOOST_CHECK(sequential.get_well_var("W_1", "WOPT") > 0.0);
+
+    BOOST_CHECK_EQUAL(sequential.size(), parallel.size());
+    for (const auto& [key, value] : sequential) {
+        BOOST_REQUIRE_MESSAGE(parallel.has(key), "Missing " << key << " in parallel evaluation");
+        BOOST_CHECK_MESSAGE(parallel.get(key) == value,
+                            key << ": " << parallel.get(key) << " != " << value);
+    }
+#endif
+}
+
 BOOST_AUTO_TEST_CASE(group_group) {
     setup cfg( "test_summary_group_group" , "group_group.DATA");
 
@@ -4157,5 +4277,75 @@ BOOST_AUTO_TEST_CASE(append_summary_state) {
     BOOST_CHECK_EQUAL(st_both.get_group_var("G1", "WOPR"), 3000);
 }
 
+BOOST_AUTO_TEST_CASE(SummaryState_Handles) {
+    SummaryState st(TimeService::now());
+
+    const auto fopr = st.handle("FOPR");
+    const auto fopt = st.handle("FOPT");
+    const auto wopr = st.well_var_handle("OP1", "WOPR");
+    const auto wopt = st.well_var_handle("OP1", "WOPT");
+    const auto gopr = st.group_var_handle("G1", "GOPR");
+    BOOST_CHECK_EQUAL(st.num_handles(), 5U);
+    BOOST_CHECK_EQUAL(st.well_var_handle("OP1", "WOPR").slot, wopr.slot);
+    BOOST_CHECK(st.handle("WOPR:OP1").slot != wopr.slot);
+
+    BOOST_CHECK(!st.has(wopr));
+    BOOST_CHECK_THROW(st.get(wopr), std::out_of_range);
+    BOOST_CHECK_EQUAL(st.get(wopr, -1), -1);
+    BOOST_CHECK(!st.has("WOPR:OP1"));
+
+    for (int i = 0; i < 2; i++) {
+        st.update(fopr, 100);
+        st.update(fopt, 100);
+        st.update(wopr, 10);
+        st.update(wopt, 10);
+        st.update(gopr, 50);
+    }
+
+    BOOST_CHECK_EQUAL(st.get("FOPR"), 100);
+    BOOST_CHECK_EQUAL(st.get(fopt), 200);
+    BOOST_CHECK_EQUAL(st.get("FOPT"), 200);
+    BOOST_CHECK_EQUAL(st.get_well_var("OP1", "WOPR"), 10);
+    BOOST_CHECK_EQUAL(st.get("WOPR:OP1"), 10);
+    BOOST_CHECK_EQUAL(st.get_well_var("OP1", "WOPT"), 20);
+    BOOST_CHECK_EQUAL(st.get("WOPT:OP1"), 20);
+    BOOST_CHECK_EQUAL(st.get_group_var("G1", "GOPR"), 50);
+    BOOST_CHECK_EQUAL(st.wells().size(), 1U);
+
+    // Values updated with the string api are visible through the handle
+    st.update_well_var("OP1", "WOPR", 20);
+    BOOST_CHECK_EQUAL(st.get(wopr), 20);
+
+    // Copies keep the handles, but resolve them against their own storage.
+    SummaryState copy = st;
+    copy.update(wopr, 30);
+    BOOST_CHECK_EQUAL(copy.get_well_var("OP1", "WOPR"), 30);
+    BOOST_CHECK_EQUAL(st.get(wopr), 20);
+
+    BOOST_CHECK(st.erase_well_var("OP1", "WOPR"));
+    BOOST_CHECK(!st.has(wopr));
+    st.update(wopr, 40);
+    BOOST_CHECK_EQUAL(st.get_well_var("OP1", "WOPR"), 40);
+    BOOST_CHECK_EQUAL(st.get("WOPR:OP1"), 40);
+
+    // A well variable which only exists in the general map is seen by the
+    // handle in the same way as by has(key) and get(key).
+    const auto wgor = st.well_var_handle("OP2", "WGOR");
+    st.set("WGOR:OP2", 1.5);
+    BOOST_CHECK(st.has("WGOR:OP2"));
+    BOOST_CHECK(!st.has_well_var("OP2", "WGOR"));
+    BOOST_CHECK_EQUAL(st.has(wgor), st.has("WGOR:OP2"));
+    BOOST_CHECK_EQUAL(st.get(wgor), 1.5);
+    BOOST_CHECK_EQUAL(st.get(wgor, -1), 1.5);
+
+    st.update(wgor, 2.5);
+    BOOST_CHECK(st.has_well_var("OP2", "WGOR"));
+    BOOST_CHECK_EQUAL(st.get_well_var("OP2", "WGOR"), 2.5);
+    BOOST_CHECK_EQUAL(st.get("WGOR:OP2"), 2.5);
+    st.update(wgor, 3.5);
+    BOOST_CHECK_EQUAL(st.get_well_var("OP2", "WGOR"), 3.5);
+    BOOST_CHECK_EQUAL(st.get(wgor), 3.5);
+}
+
 
 BOOST_AUTO_TEST_SUITE_END()
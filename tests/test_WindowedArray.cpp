@@ -155,4 +155,69 @@ BOOST_AUTO_TEST_CASE(Matrix)
     }
 }
 
+// ====================================================================
+
+BOOST_AUTO_TEST_CASE(Reset_Array)
+{
+    using Wa = Opm::RestartIO::Helpers::WindowedArray<int>;
+
+    auto wa = Wa{ Wa::NumWindows{ 4 }, Wa::WindowSize{ 3 } };
+    for (auto n = wa.numWindows(), w = 0*n; w < n; ++w) {
+        auto win = wa[w];
+        std::fill(std::begin(win), std::end(win), 17);
+    }
+
+    const auto* storage = wa.data().data();
+
+    // Smaller array reuses the existing storage.
+    wa.reset(Wa::NumWindows{ 2 }, Wa::WindowSize{ 5 });
+
+    BOOST_CHECK_EQUAL(wa.numWindows(), Wa::Idx{2});
+    BOOST_CHECK_EQUAL(wa.windowSize(), Wa::Idx{5});
+    BOOST_CHECK(wa.data().data() == storage);
+
+    {
+        const auto expect = std::vector<int>(10, 0);
+        const auto& actual = wa.data();
+
+        BOOST_CHECK_EQUAL_COLLECTIONS(std::begin(actual), std::end(actual),
+                                      std::begin(expect), std::end(expect));
+    }
+
+    BOOST_CHECK_THROW(wa.reset(Wa::NumWindows{ 2 }, Wa::WindowSize{ 0 }),
+                      std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(Reset_Matrix)
+{
+    using Wm = Opm::RestartIO::Helpers::WindowedMatrix<int>;
+
+    auto wm = Wm{};
+    wm.reset(Wm::NumRows{ 3 }, Wm::NumCols{ 2 }, Wm::WindowSize{ 4 });
+
+    BOOST_CHECK_EQUAL(wm.numRows(), Wm::Idx{3});
+    BOOST_CHECK_EQUAL(wm.numCols(), Wm::Idx{2});
+
+    {
+        auto w = wm(2, 1);
+        std::fill(std::begin(w), std::end(w), 42);
+    }
+
+    const auto* storage = wm.data().data();
+
+    wm.reset(Wm::NumRows{ 2 }, Wm::NumCols{ 3 }, Wm::WindowSize{ 4 });
+
+    BOOST_CHECK_EQUAL(wm.numRows(), Wm::Idx{2});
+    BOOST_CHECK_EQUAL(wm.numCols(), Wm::Idx{3});
+    BOOST_CHECK(wm.data().data() == storage);
+
+    {
+        const auto expect = std::vector<int>(24, 0);
+        const auto& actual = wm.data();
+
+        BOOST_CHECK_EQUAL_COLLECTIONS(std::begin(actual), std::end(actual),
+                                      std::begin(expect), std::end(expect));
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END ()
@@ -239,6 +239,43 @@ TSTEP            -- 8
         return Opm::Parser{}.parseString(input);
     }
 
+    // One vertical producer with 'num_conn' connections per column of the
+    // grid, spread round-robin over ten groups.
+    Opm::Deck many_wells(const int num_wells, const int num_conn)
+    {
+        auto nx = 1;
+        while (nx * nx < num_wells) { ++nx; }
+
+        const auto num_cells = std::to_string(nx * nx * num_conn);
+
+        auto input = std::string { "RUNSPEC\nOIL\nGAS\nWATER\nUNIFOUT\n" };
+        input += "DIMENS\n " + std::to_string(nx) + " " + std::to_string(nx)
+            + " " + std::to_string(num_conn) + " /\n";
+        input += "WELLDIMS\n " + std::to_string(num_wells) + " " + std::to_string(num_conn)
+            + " 10 " + std::to_string(num_wells) + " /\n";
+        input += "GRID\nDXV\n" + std::to_string(nx) + "*100 /\nDYV\n" + std::to_string(nx)
+            + "*100 /\nDZV\n" + std::to_string(num_conn) + "*10 /\nTOPS\n"
+            + std::to_string(nx * nx) + "*2000 /\n";
+        input += "PORO\n" + num_cells + "*0.2 /\nPERMX\n" + num_cells + "*100 /\n"
+            + "PERMY\n" + num_cells + "*100 /\nPERMZ\n" + num_cells + "*10 /\n";
+        input += "SCHEDULE\nTSTEP\n 1 /\nWELSPECS\n";
+
+        for (auto w = 0; w < num_wells; ++w) {
+            input += " 'W" + std::to_string(w + 1) + "' 'G" + std::to_string(w % 10 + 1) + "' "
+                + std::to_string(w % nx + 1) + " " + std::to_string(w / nx + 1) + " 1* 'OIL' /\n";
+        }
+
+        input += "/\nCOMPDAT\n";
+        for (auto w = 0; w < num_wells; ++w) {
+            input += " 'W" + std::to_string(w + 1) + "' 2* 1 " + std::to_string(num_conn)
+                + " 'OPEN' 2* 0.3 /\n";
+        }
+
+        input += "/\nWCONPROD\n 'W*' 'OPEN' 'ORAT' 100 4* 50 /\n/\nTSTEP\n 1 /\n";
+
+        return Opm::Parser{}.parseString(input);
+    }
+
     void writeRstFile(const SimulationCase& simCase,
                       const std::string&    baseName,
                       const std::size_t     rptStep)
@@ -403,6 +440,31 @@ BOOST_AUTO_TEST_CASE(State_test)
     BOOST_CHECK_THROW(well.segment(10), std::invalid_argument);
 }
 
+BOOST_AUTO_TEST_CASE(State_Many_Wells)
+{
+    // Enough wells for the wells to be loaded concurrently.
+    const auto simCase = SimulationCase{many_wells(150, 3)};
+
+    const auto state =
+        makeRestartState(simCase, "MANY_WELLS", 2, "test_rstate_many_wells");
+
+    BOOST_REQUIRE_EQUAL(state.wells.size(), std::size_t{150});
+
+    for (auto w = 0*state.wells.size(); w < state.wells.size(); ++w) {
+        const auto& well = state.wells[w];
+
+        BOOST_CHECK_EQUAL(well.name, "W" + std::to_string(w + 1));
+        BOOST_CHECK_EQUAL(well.group, "G" + std::to_string(w % 10 + 1));
+        BOOST_REQUIRE_EQUAL(well.connections.size(), std::size_t{3});
+
+        for (auto c = 0*well.connections.size(); c < well.connections.size(); ++c) {
+            BOOST_CHECK_EQUAL(well.connections[c].ijk[2], static_cast<int>(c));
+        }
+    }
+
+    BOOST_CHECK_EQUAL(state.get_well("W77").name, "W77");
+}
+
 BOOST_AUTO_TEST_CASE(Well_Economic_Limits)
 {
     const auto simCase = SimulationCase{first_sim()};